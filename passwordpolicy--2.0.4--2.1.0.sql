@@ -0,0 +1,57 @@
+/* passwordpolicy/passwordpolicy--2.0.4--2.1.0.sql */
+
+-- complain if script is sourced in psql
+\echo Use "ALTER EXTENSION passwordpolicy UPDATE TO '2.1.0'" to load this file. \quit
+
+
+--
+CREATE FUNCTION passwordpolicy.failure_delay_stats (
+  OUT sleeping integer,
+  OUT delayed bigint,
+  OUT shed bigint
+)
+RETURNS record
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT VOLATILE;
+
+REVOKE ALL ON FUNCTION passwordpolicy.failure_delay_stats() FROM PUBLIC;
+
+
+--
+CREATE FUNCTION passwordpolicy.history_slab_stats (
+  OUT slots integer,
+  OUT used integer,
+  OUT entries_per_slot integer,
+  OUT bytes bigint
+)
+RETURNS record
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT VOLATILE;
+
+REVOKE ALL ON FUNCTION passwordpolicy.history_slab_stats() FROM PUBLIC;
+
+
+-- the background worker applies the changes of accounts_lockable as soon as they are committed
+CREATE FUNCTION passwordpolicy.accounts_lockable_changed()
+RETURNS trigger
+AS 'MODULE_PATHNAME'
+LANGUAGE C;
+
+CREATE TRIGGER accounts_lockable_changed
+  AFTER INSERT OR UPDATE OR DELETE ON passwordpolicy.accounts_lockable
+  FOR EACH ROW EXECUTE FUNCTION passwordpolicy.accounts_lockable_changed();
+
+CREATE TRIGGER accounts_lockable_truncated
+  AFTER TRUNCATE ON passwordpolicy.accounts_lockable
+  FOR EACH STATEMENT EXECUTE FUNCTION passwordpolicy.accounts_lockable_changed();
+
+
+-- the next password change of the user ignores password_policy_history.min_password_age
+CREATE FUNCTION passwordpolicy.min_password_age_bypass (
+  usename name
+)
+RETURNS void
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT VOLATILE;
+
+REVOKE ALL ON FUNCTION passwordpolicy.min_password_age_bypass(name) FROM PUBLIC;
@@ -0,0 +1,36 @@
+/* passwordpolicy/passwordpolicy--2.1.0--3.0.0.sql */
+
+-- complain if script is sourced in psql
+\echo Use "ALTER EXTENSION passwordpolicy UPDATE TO '3.0.0'" to load this file. \quit
+
+
+-- The password history is keyed by role (regrole, an Oid) with binary SHA-256 digests, it follows renamed
+-- roles and the history of a dropped role can't be inherited by a new role with the same name.
+-- The rows are copied to a new table and the indexes are built once, after the copy; the
+-- history of roles that don't exist anymore is not migrated.
+CREATE TABLE passwordpolicy.accounts_password_history_new (
+  roleid regrole NOT NULL,
+  password_hash bytea NOT NULL,
+  changed_at timestamp with time zone NOT NULL
+);
+
+INSERT INTO passwordpolicy.accounts_password_history_new (roleid, password_hash, changed_at)
+SELECT r.oid, decode(h.password_hash, 'hex'), h.changed_at
+FROM passwordpolicy.accounts_password_history h
+JOIN pg_catalog.pg_roles r ON r.rolname = h.usename
+WHERE h.password_hash ~ '^[0-9a-fA-F]{64}$'
+  AND h.changed_at IS NOT NULL;
+
+DROP TABLE passwordpolicy.accounts_password_history;
+
+ALTER TABLE passwordpolicy.accounts_password_history_new RENAME TO accounts_password_history;
+
+ALTER TABLE passwordpolicy.accounts_password_history
+  ADD CONSTRAINT pk_accounts_password_history PRIMARY KEY (roleid, password_hash);
+
+-- load and prune of the history of a role
+CREATE INDEX accounts_password_history_roleid_changed_at
+  ON passwordpolicy.accounts_password_history (roleid, changed_at);
+
+-- Include table in pg_dump
+SELECT pg_catalog.pg_extension_config_dump('passwordpolicy.accounts_password_history', '');
@@ -0,0 +1,46 @@
+/* passwordpolicy/passwordpolicy--3.0.0--3.1.0.sql */
+
+-- complain if script is sourced in psql
+\echo Use "ALTER EXTENSION passwordpolicy UPDATE TO '3.1.0'" to load this file. \quit
+
+
+-- A profile overrides some settings for the roles it is assigned to, NULL keeps the GUC value
+CREATE TABLE passwordpolicy.profiles (
+  profile name NOT NULL,
+  min_password_len integer CHECK (min_password_len >= 0),
+  min_special_chars integer CHECK (min_special_chars >= 0),
+  min_numbers integer CHECK (min_numbers >= 0),
+  min_uppercase_letter integer CHECK (min_uppercase_letter >= 0),
+  min_lowercase_letter integer CHECK (min_lowercase_letter >= 0),
+  max_password_history integer CHECK (max_password_history >= 0),
+  number_failures integer CHECK (number_failures >= 0),
+  CONSTRAINT pk_profiles PRIMARY KEY(profile)
+);
+
+-- The members of a role with a profile get it too, unless they have a nearer one. The role is
+-- kept by Oid (regrole is written and dumped as the role name): a renamed role keeps its profile
+-- and the profile of a dropped role isn't inherited by a new role with the same name
+CREATE TABLE passwordpolicy.roles_profile (
+  roleid regrole NOT NULL,
+  profile name NOT NULL REFERENCES passwordpolicy.profiles (profile) ON UPDATE CASCADE ON DELETE CASCADE,
+  CONSTRAINT pk_roles_profile PRIMARY KEY(roleid)
+);
+
+-- Include tables in pg_dump
+SELECT pg_catalog.pg_extension_config_dump('passwordpolicy.profiles', '');
+SELECT pg_catalog.pg_extension_config_dump('passwordpolicy.roles_profile', '');
+
+
+-- the background worker resolves the profiles again as soon as the changes are committed
+CREATE FUNCTION passwordpolicy.profiles_changed()
+RETURNS trigger
+AS 'MODULE_PATHNAME'
+LANGUAGE C;
+
+CREATE TRIGGER profiles_changed
+  AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON passwordpolicy.profiles
+  FOR EACH STATEMENT EXECUTE FUNCTION passwordpolicy.profiles_changed();
+
+CREATE TRIGGER roles_profile_changed
+  AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON passwordpolicy.roles_profile
+  FOR EACH STATEMENT EXECUTE FUNCTION passwordpolicy.profiles_changed();
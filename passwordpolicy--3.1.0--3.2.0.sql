@@ -0,0 +1,32 @@
+/* passwordpolicy/passwordpolicy--3.1.0--3.2.0.sql */
+
+-- complain if script is sourced in psql
+\echo Use "ALTER EXTENSION passwordpolicy UPDATE TO '3.2.0'" to load this file. \quit
+
+
+-- the checks of a password change, without changing the password
+CREATE FUNCTION passwordpolicy.validate (
+  IN password text,
+  IN rolname name,
+  OUT status text,
+  OUT reason text
+)
+RETURNS record
+AS 'MODULE_PATHNAME', 'validate'
+LANGUAGE C STRICT VOLATILE PARALLEL SAFE;
+
+REVOKE ALL ON FUNCTION passwordpolicy.validate(text, name) FROM PUBLIC;
+
+-- the checks of many passwords of a role, candidate is the position in the array
+CREATE FUNCTION passwordpolicy.validate (
+  IN passwords text[],
+  IN rolname name,
+  OUT candidate integer,
+  OUT status text,
+  OUT reason text
+)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME', 'validate_array'
+LANGUAGE C STRICT VOLATILE PARALLEL SAFE;
+
+REVOKE ALL ON FUNCTION passwordpolicy.validate(text[], name) FROM PUBLIC;
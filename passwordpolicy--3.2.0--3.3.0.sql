@@ -0,0 +1,19 @@
+/* passwordpolicy/passwordpolicy--3.2.0--3.3.0.sql */
+
+-- complain if script is sourced in psql
+\echo Use "ALTER EXTENSION passwordpolicy UPDATE TO '3.3.0'" to load this file. \quit
+
+
+-- the password changes of many roles, a row for every role in the order of the arrays
+CREATE FUNCTION passwordpolicy.rotate_passwords (
+  IN roles name[],
+  IN passwords text[],
+  OUT rolname name,
+  OUT status text,
+  OUT reason text
+)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME', 'rotate_passwords'
+LANGUAGE C STRICT VOLATILE;
+
+REVOKE ALL ON FUNCTION passwordpolicy.rotate_passwords(name[], text[]) FROM PUBLIC;
@@ -31,10 +31,27 @@ PG_MODULE_MAGIC;
 #include "passwordpolicy.h"
 #include "passwordpolicy_auth.h"
 #include "passwordpolicy_bgw.h"
+#include "passwordpolicy_changes.h"
 #include "passwordpolicy_check.h"
+#include "passwordpolicy_hash_history.h"
+#include "passwordpolicy_profiles.h"
 #include "passwordpolicy_shmem.h"
 #include "passwordpolicy_vars.h"
 
+static const struct config_enum_entry passwordpolicy_lock_algorithm_options[] = {
+    {"consecutive", PASSWORDPOLICY_LOCK_CONSECUTIVE, false},
+    {"sliding_window", PASSWORDPOLICY_LOCK_SLIDING_WINDOW, false},
+    {"token_bucket", PASSWORDPOLICY_LOCK_TOKEN_BUCKET, false},
+    {"exponential_backoff", PASSWORDPOLICY_LOCK_EXPONENTIAL_BACKOFF, false},
+    {NULL, 0, false}};
+
+static const struct config_enum_entry passwordpolicy_dictionary_engine_options[] = {
+#ifdef USE_CRACKLIB
+    {"cracklib", PASSWORDPOLICY_DICTIONARY_CRACKLIB, false},
+#endif
+    {"native", PASSWORDPOLICY_DICTIONARY_NATIVE, false},
+    {NULL, 0, false}};
+
 /*
  * Module initialization function
  */
@@ -86,6 +103,54 @@ void _PG_init(void)
       NULL, &guc_passwordpolicy_enable_dict_check, false,
       PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
 
+  DefineCustomEnumVariable(
+      "password_policy.dictionary_engine",
+      "Dictionary used by the dictionary check: cracklib or native",
+      NULL, &guc_passwordpolicy_dictionary_engine, PASSWORDPOLICY_DICTIONARY_ENGINE, passwordpolicy_dictionary_engine_options,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomStringVariable(
+      "password_policy.dictionary_path",
+      "Path of the dictionary: cracklib dictionary without the .pwd/.pwi/.hwm extensions, or native dictionary file",
+      NULL, &guc_passwordpolicy_dictionary_path, PASSWORDPOLICY_DICTIONARY_PATH,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy.min_entropy_bits",
+      "Minimum estimated strength of the passwords, in bits. 0 to disable the check",
+      NULL, &guc_passwordpolicy_min_entropy_bits, 0, 0, 256,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomStringVariable(
+      "password_policy.banned_words_file",
+      "File of banned words, one per line, the passwords can't contain them. Empty to disable the check",
+      NULL, &guc_passwordpolicy_banned_words_file, "",
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy.banned_words_max_size",
+      "Shared memory reserved for the banned words automaton",
+      NULL, &guc_passwordpolicy_banned_words_max_size, 1024, 64, INT_MAX / 1024,
+      PGC_POSTMASTER, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY | GUC_UNIT_KB, NULL, NULL, NULL);
+
+  DefineCustomStringVariable(
+      "password_policy.breached_file",
+      "Breached passwords file built by passwordpolicy_breached_build, empty to disable the check",
+      NULL, &guc_passwordpolicy_breached_file, "",
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy.rejection_cache_size",
+      "Number of recently rejected passwords remembered by every backend, 0 to disable the cache",
+      NULL, &guc_passwordpolicy_rejection_cache_size, 16, 0, 1024,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy.rejection_cache_ttl",
+      "Seconds a rejected password is remembered",
+      NULL, &guc_passwordpolicy_rejection_cache_ttl, 300, 1, INT_MAX / 1000,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY | GUC_UNIT_S, NULL, NULL, NULL);
+
   DefineCustomBoolVariable(
       "password_policy.require_validuntil",
       "Require valid until when changing or setting a password",
@@ -105,6 +170,30 @@ void _PG_init(void)
       NULL, &guc_passwordpolicy_lock_after, 5, 1, INT_MAX,
       PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
 
+  DefineCustomEnumVariable(
+      "password_policy_lock.algorithm",
+      "Algorithm used to soft-lock accounts: consecutive, sliding_window, token_bucket or exponential_backoff",
+      NULL, &guc_passwordpolicy_lock_algorithm, PASSWORDPOLICY_LOCK_CONSECUTIVE, passwordpolicy_lock_algorithm_options,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy_lock.window",
+      "Length in seconds of the window where failures are counted, for the sliding_window algorithm",
+      NULL, &guc_passwordpolicy_lock_window, 300, 1, INT_MAX,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy_lock.refill_rate",
+      "Failures forgiven per minute, for the token_bucket algorithm",
+      NULL, &guc_passwordpolicy_lock_refill_rate, 1, 0, INT_MAX,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy_lock.backoff_max",
+      "Maximum number of seconds an account is soft-locked, for the exponential_backoff algorithm",
+      NULL, &guc_passwordpolicy_lock_backoff_max, 3600, 1, INT_MAX,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
   DefineCustomBoolVariable(
       "password_policy_lock.include_all",
       "Consider all the accounts in the system, or only those in the passwordpolicy.accounts_lockable table",
@@ -117,6 +206,18 @@ void _PG_init(void)
       NULL, &guc_passwordpolicy_lock_failure_delay, 5, 0, INT_MAX,
       PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
 
+  DefineCustomBoolVariable(
+      "password_policy_lock.on_demand",
+      "Track accounts from their first failed login instead of reading all the accounts, only with include_all",
+      NULL, &guc_passwordpolicy_lock_on_demand, false,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy_lock.max_delayed_backends",
+      "Maximum number of backends sleeping a failure delay at the same time, rejections above it are immediate",
+      NULL, &guc_passwordpolicy_lock_max_delayed_backends, 10, 0, INT_MAX,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
   DefineCustomBoolVariable(
       "password_policy_lock.auto_unlock",
       "Automatically soft-unlock the accounts",
@@ -129,7 +230,38 @@ void _PG_init(void)
       NULL, &guc_passwordpolicy_lock_auto_unlock_after, 0, 0, INT_MAX,
       PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
 
+  /* Source Address Soft-Lock */
+  DefineCustomIntVariable(
+      "password_policy_lock.address_max_number",
+      "Maximum number of source addresses tracked for soft-locking",
+      NULL, &guc_passwordpolicy_lock_address_max_num, 1024, 8, INT_MAX,
+      PGC_POSTMASTER, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy_lock.address_number_failures",
+      "Number of login failures from a source address before soft-locking the address (0 to disable)",
+      NULL, &guc_passwordpolicy_lock_address_after, 0, 0, INT_MAX,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy_lock.address_failure_delay",
+      "Introduce this delay in seconds after a failed login, if the source address is soft-locked",
+      NULL, &guc_passwordpolicy_lock_address_failure_delay, 5, 0, INT_MAX,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "password_policy_lock.address_auto_unlock_after",
+      "Automatically soft-unlock the source address after this number of seconds since the last failed login",
+      NULL, &guc_passwordpolicy_lock_address_auto_unlock_after, 60, 0, INT_MAX,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
   /* Password History */
+  DefineCustomIntVariable(
+      "password_policy_history.flush_delay",
+      "Milliseconds the background worker waits for other password changes before writing the history",
+      NULL, &guc_passwordpolicy_history_flush_delay, 10, 0, 10000,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY | GUC_UNIT_MS, NULL, NULL, NULL);
+
   DefineCustomIntVariable(
       "password_policy_history.max_number_accounts",
       "Maximum number of accounts with saved histroy",
@@ -142,6 +274,19 @@ void _PG_init(void)
       NULL, &guc_passwordpolicy_history_max_num_entries, 5, 1, INT_MAX,
       PGC_POSTMASTER, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
 
+  DefineCustomIntVariable(
+      "password_policy_history.min_password_age",
+      "Seconds before a user can change the password again (0 to disable this feature)",
+      NULL, &guc_passwordpolicy_history_min_password_age, 0, 0, INT_MAX,
+      PGC_SIGHUP, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY | GUC_UNIT_S, NULL, NULL, NULL);
+
+  /* Profiles */
+  DefineCustomIntVariable(
+      "password_policy_profiles.max_number_roles",
+      "Maximum number of roles with a profile, their own or the one of a group",
+      NULL, &guc_passwordpolicy_profiles_max_num_roles, 1024, 1, INT_MAX / 4,
+      PGC_POSTMASTER, GUC_NOT_IN_SAMPLE | GUC_SUPERUSER_ONLY, NULL, NULL, NULL);
+
   EmitWarningsOnPlaceholders("pgauditlogtofile");
 
   /* background worker */
@@ -172,6 +317,13 @@ void _PG_init(void)
   check_password_hook = passwordpolicy_check_password;
   passwordpolicy_prev_client_authentication_hook = ClientAuthentication_hook;
   ClientAuthentication_hook = passwordpolicy_client_authentication;
+  passwordpolicy_prev_process_utility_hook = ProcessUtility_hook;
+  ProcessUtility_hook = passwordpolicy_changes_process_utility;
+  passwordpolicy_prev_object_access_hook = object_access_hook;
+  object_access_hook = passwordpolicy_hash_history_object_access;
+
+  /* inherited by the backends, they follow the role changes from the start */
+  passwordpolicy_profiles_register();
 }
 
 void _PG_fini(void)
@@ -179,4 +331,6 @@ void _PG_fini(void)
   shmem_startup_hook = passwordpolicy_prev_shmem_startup_hook;
   check_password_hook = passwordpolicy_prev_check_password_hook;
   ClientAuthentication_hook = passwordpolicy_prev_client_authentication_hook;
+  ProcessUtility_hook = passwordpolicy_prev_process_utility_hook;
+  object_access_hook = passwordpolicy_prev_object_access_hook;
 }
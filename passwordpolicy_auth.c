@@ -12,19 +12,39 @@
 
 #include "passwordpolicy_auth.h"
 
-#include <utils/hsearch.h>
+#include <miscadmin.h>
+#include <storage/ipc.h>
+#include <storage/latch.h>
+#include <utils/acl.h>
 #include <utils/timestamp.h>
-
+#if (PG_VERSION_NUM >= 140000)
+#include <utils/wait_event.h>
+#else
+#include <pgstat.h>
+#endif
+
+#include "passwordpolicy_hash_accounts.h"
+#include "passwordpolicy_hash_addresses.h"
+#include "passwordpolicy_profiles.h"
+#include "passwordpolicy_ratelimit.h"
 #include "passwordpolicy_shmem.h"
 #include "passwordpolicy_vars.h"
 
+/* forward declaration private functions */
+static void passwordpolicy_auth_delay(int64 delay);
+static void passwordpolicy_auth_delay_cleanup(int code, Datum arg);
+
 void passwordpolicy_client_authentication(Port *port, int status)
 {
-  bool found;
+  bool address_locked = false;
   int failures, microsecs;
+  int64 delay;
   long int secs;
-  TimestampTz last_failure;
+  TimestampTz last_failure, now;
+  Oid roleid;
   PasswordPolicyAccount *entry;
+  PasswordPolicyAddress *address;
+  PasswordPolicyProfile profile;
 
   /*
       Client Authentication hook executes after the authentication is done (ok or error),
@@ -40,76 +60,155 @@ void passwordpolicy_client_authentication(Port *port, int status)
   if (!passwordpolicy_shmem_check())
     return;
 
-  if (guc_passwordpolicy_lock_after == 0)
-    return;
-
-  entry = (PasswordPolicyAccount *)hash_search(passwordpolicy_hash_accounts, port->user_name, HASH_FIND, &found);
-  if (!found)
-  {
-    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' not found in account table", port->user_name)));
-    return;
-  }
-
-  if (pg_atomic_read_u64(&(entry->deleted)) == 1)
-  {
-    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' marked for deletion, ignoring account", port->user_name)));
-    return;
-  }
-
-  // Soft-lock
-  failures = pg_atomic_read_u64(&(entry->failures));
-  // account soft-locked
-  if (failures >= guc_passwordpolicy_lock_after)
+  /*
+   * Source address soft-lock, checked before the account: a password spray tries
+   * a few passwords against many (even non existing) accounts from the same host.
+   * Only failures claim a slot, successful logins just look up the address.
+   */
+  if (guc_passwordpolicy_lock_address_after > 0 &&
+      (address = passwordpolicy_hash_addresses_find(&(port->raddr), status != STATUS_OK)) != NULL)
   {
-    // auto soft-unlock enabled
-    if (guc_passwordpolicy_lock_auto_unlock)
+    failures = pg_atomic_read_u64(&(address->failures));
+    if (failures >= guc_passwordpolicy_lock_address_after)
     {
-      // auto soft-unlock delay
-      last_failure = pg_atomic_read_u64(&(entry->last_failure));
+      last_failure = pg_atomic_read_u64(&(address->last_failure));
       TimestampDifference(last_failure, GetCurrentTimestamp(), &secs, &microsecs);
-      if (secs < guc_passwordpolicy_lock_auto_unlock_after)
+      if (secs < guc_passwordpolicy_lock_address_auto_unlock_after)
       {
-        ereport(DEBUG3, (errmsg("passwordpolicy: maximum number of failed connections exceeded for '%s' and auto unlock time not passed",
-                                port->user_name)));
+        ereport(DEBUG3, (errmsg("passwordpolicy: maximum number of failed connections exceeded for source address and auto unlock time not passed")));
+        address_locked = true;
         goto error;
       }
     }
-    else
+
+    if (status != STATUS_OK)
     {
-      // auto soft-unlock disabled
-      ereport(DEBUG3, (errmsg("passwordpolicy: maximum number of failed connections exceeded for '%s' and auto unlock disabled",
-                              port->user_name)));
-      goto error;
+      failures = pg_atomic_add_fetch_u64(&(address->failures), 1);
+      pg_atomic_write_u64(&(address->last_failure), GetCurrentTimestamp());
+      pg_atomic_fetch_add_u64(&(passwordpolicy_shm->lock_changes), 1);
+      ereport(DEBUG3, (errmsg("passwordpolicy: source address failures '%d/%d",
+                              failures, guc_passwordpolicy_lock_address_after)));
+      if (failures >= guc_passwordpolicy_lock_address_after)
+      {
+        address_locked = true;
+        goto error;
+      }
     }
   }
 
-  if (status == STATUS_OK)
+  /* the role was already read from the syscache during authentication */
+  roleid = get_role_oid(port->user_name, true);
+  /* a profile can disable the soft-lock of its roles */
+  passwordpolicy_profiles_resolve(roleid, &profile);
+  if (profile.lock_after == 0)
+    return;
+
+  entry = passwordpolicy_hash_accounts_find(roleid);
+  /* on-demand mode: an account is tracked from its first failure */
+  if (entry == NULL && status != STATUS_OK &&
+      guc_passwordpolicy_lock_all_accounts && guc_passwordpolicy_lock_on_demand)
+    entry = passwordpolicy_hash_accounts_claim(roleid, port->user_name);
+  if (entry == NULL)
   {
-    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' failures reset", port->user_name)));
-    pg_atomic_write_u64(&(entry->failures), 0);
+    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' not found in account table", port->user_name)));
+    return;
   }
+
+  // Soft-lock
+  now = GetCurrentTimestamp();
+  if (passwordpolicy_ratelimit_locked(entry, port->user_name, now, profile.lock_after))
+    goto error;
+
+  if (status == STATUS_OK)
+    passwordpolicy_ratelimit_success(entry, port->user_name);
   else
   {
-    failures = pg_atomic_add_fetch_u64(&(entry->failures), 1);
-    pg_atomic_write_u64(&(entry->last_failure), GetCurrentTimestamp());
-    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' failures '%d/%d",
-                            port->user_name, failures, guc_passwordpolicy_lock_after)));
-    if (failures >= guc_passwordpolicy_lock_after)
-    {
+    pg_atomic_write_u32(&(entry->usage), 1);
+    if (passwordpolicy_ratelimit_failure(entry, port->user_name, now, profile.lock_after))
       goto error;
-    }
   }
 
   goto end;
 
 error:
   /* introduce a delay, poor man method to reduce impact on sequential attacks */
-  if (guc_passwordpolicy_lock_failure_delay > 0)
-    pg_usleep(guc_passwordpolicy_lock_failure_delay * USECS_PER_SEC);
+  if (address_locked)
+    delay = (int64)guc_passwordpolicy_lock_address_failure_delay * 1000;
+  else
+    delay = passwordpolicy_ratelimit_delay(guc_passwordpolicy_lock_failure_delay);
+  passwordpolicy_auth_delay(delay);
   /* terminate the backend */
+  if (address_locked)
+    ereport(FATAL, (errmsg("passwordpolicy: maximum number of failed connections exceeded from this source address")));
   ereport(FATAL, (errmsg("passwordpolicy: maximum number of failed connections exceeded for '%s'",
                          port->user_name)));
 
 end:
   return;
-}
\ No newline at end of file
+}
+
+/* private functions */
+
+/**
+ * @brief Sleep before rejecting a login, unless too many backends already are
+ * @param delay: milliseconds
+ * @return void
+ */
+static void passwordpolicy_auth_delay(int64 delay)
+{
+  uint32 sleeping;
+  long timeout;
+  TimestampTz deadline;
+#if (PG_VERSION_NUM >= 170000)
+  static uint32 wait_event_info = 0;
+
+  if (wait_event_info == 0)
+    wait_event_info = WaitEventExtensionNew("PasswordPolicyFailureDelay");
+#else
+  const uint32 wait_event_info = PG_WAIT_EXTENSION;
+#endif
+
+  if (delay <= 0)
+    return;
+
+  /* every sleeping backend holds a connection slot, cap them */
+  sleeping = pg_atomic_read_u32(&(passwordpolicy_shm->delay_sleeping));
+  do
+  {
+    if (sleeping >= (uint32)guc_passwordpolicy_lock_max_delayed_backends)
+    {
+      pg_atomic_fetch_add_u64(&(passwordpolicy_shm->delay_shed), 1);
+      ereport(DEBUG3, (errmsg("passwordpolicy: '%u' backends in failure delay, rejecting without delay", sleeping)));
+      return;
+    }
+  } while (!pg_atomic_compare_exchange_u32(&(passwordpolicy_shm->delay_sleeping), &sleeping, sleeping + 1));
+
+  pg_atomic_fetch_add_u64(&(passwordpolicy_shm->delay_total), 1);
+
+  /* the counter must be released even if the backend is terminated while sleeping */
+  PG_ENSURE_ERROR_CLEANUP(passwordpolicy_auth_delay_cleanup, (Datum)0);
+  {
+    deadline = TimestampTzPlusMilliseconds(GetCurrentTimestamp(), delay);
+    while ((timeout = TimestampDifferenceMilliseconds(GetCurrentTimestamp(), deadline)) > 0)
+    {
+      (void)WaitLatch(MyLatch, WL_LATCH_SET | WL_TIMEOUT | WL_EXIT_ON_PM_DEATH, timeout, wait_event_info);
+      ResetLatch(MyLatch);
+      /* termination requests and authentication_timeout end the delay */
+      CHECK_FOR_INTERRUPTS();
+    }
+  }
+  PG_END_ENSURE_ERROR_CLEANUP(passwordpolicy_auth_delay_cleanup, (Datum)0);
+
+  passwordpolicy_auth_delay_cleanup(0, (Datum)0);
+}
+
+/**
+ * @brief Release the failure delay slot
+ * @param code: exit code
+ * @param arg: unused
+ * @return void
+ */
+static void passwordpolicy_auth_delay_cleanup(int code, Datum arg)
+{
+  pg_atomic_fetch_sub_u32(&(passwordpolicy_shm->delay_sleeping), 1);
+}
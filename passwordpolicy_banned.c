@@ -0,0 +1,295 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_banned.c
+ *      Banned words check of the passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_banned.h"
+
+#include <sys/stat.h>
+
+#include <storage/fd.h>
+#include <storage/shmem.h>
+#include <utils/memutils.h>
+
+/*
+ * The banned words of password_policy.banned_words_file are compiled into an Aho-Corasick
+ * automaton in shared memory, by the first backend checking a password after the file
+ * changed. The checks scan the password once, whatever the number of banned words.
+ * The words and the passwords are compared without case, ASCII only: the automaton is
+ * shared by all the databases, whatever their locale.
+ */
+#define PASSWORDPOLICY_BANNED_MAX_WORD 256
+
+/* Private functions forward declaration */
+PasswordPolicyBanned *passwordpolicy_banned_compile(const char *path);
+bool passwordpolicy_banned_current(const char *path, const struct stat *st);
+int passwordpolicy_banned_word_cmp(const void *a, const void *b);
+
+/*
+ * @brief Automaton of password_policy.banned_words_file, compiled again if the file changed
+ * @return NULL if there are no banned words, otherwise the automaton, locked until
+ * passwordpolicy_banned_release()
+ **/
+const PasswordPolicyBanned *passwordpolicy_banned_acquire(void)
+{
+  const char *path = guc_passwordpolicy_banned_words_file;
+  struct stat st;
+  PasswordPolicyBanned *compiled;
+
+  if (path == NULL || path[0] == '\0' || passwordpolicy_banned == NULL)
+    return NULL;
+
+  if (stat(path, &st) < 0)
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not stat banned words file \"%s\": %m", path)));
+
+  LWLockAcquire(passwordpolicy_lock_banned, LW_SHARED);
+  if (passwordpolicy_banned_current(path, &st))
+  {
+    if (passwordpolicy_banned->num_words > 0)
+      return passwordpolicy_banned;
+    LWLockRelease(passwordpolicy_lock_banned);
+    return NULL;
+  }
+  LWLockRelease(passwordpolicy_lock_banned);
+
+  /* compiled without the lock, the checks of the other backends use the previous automaton */
+  compiled = passwordpolicy_banned_compile(path);
+
+  LWLockAcquire(passwordpolicy_lock_banned, LW_EXCLUSIVE);
+  if (!passwordpolicy_banned_current(path, &st))
+  {
+    memcpy(passwordpolicy_banned->classes, compiled->classes, sizeof(compiled->classes));
+    memcpy(passwordpolicy_banned->transitions, compiled->transitions,
+           (Size)compiled->num_states * compiled->num_classes * sizeof(uint32));
+    passwordpolicy_banned->num_words = compiled->num_words;
+    passwordpolicy_banned->num_states = compiled->num_states;
+    passwordpolicy_banned->num_classes = compiled->num_classes;
+    passwordpolicy_banned->dev = st.st_dev;
+    passwordpolicy_banned->ino = st.st_ino;
+    passwordpolicy_banned->mtime = st.st_mtime;
+    passwordpolicy_banned->size = st.st_size;
+    strlcpy(passwordpolicy_banned->path, path, sizeof(passwordpolicy_banned->path));
+
+    ereport(LOG, (errmsg("passwordpolicy: %u banned words of \"%s\" compiled, %u states",
+                         compiled->num_words, path, compiled->num_states)));
+  }
+  LWLockRelease(passwordpolicy_lock_banned);
+  pfree(compiled);
+
+  LWLockAcquire(passwordpolicy_lock_banned, LW_SHARED);
+  if (passwordpolicy_banned->num_words == 0)
+  {
+    LWLockRelease(passwordpolicy_lock_banned);
+    return NULL;
+  }
+  return passwordpolicy_banned;
+}
+
+void passwordpolicy_banned_init(void)
+{
+  bool found;
+
+  passwordpolicy_banned = ShmemInitStruct("passwordpolicy banned", passwordpolicy_banned_memsize(), &found);
+  if (found)
+    return;
+
+  MemSet(passwordpolicy_banned, 0, offsetof(PasswordPolicyBanned, transitions));
+  passwordpolicy_banned->max_transitions = (uint32)(((Size)guc_passwordpolicy_banned_words_max_size * 1024) / sizeof(uint32));
+}
+
+Size passwordpolicy_banned_memsize(void)
+{
+  return add_size(offsetof(PasswordPolicyBanned, transitions), (Size)guc_passwordpolicy_banned_words_max_size * 1024);
+}
+
+/*
+ * @brief Release the automaton returned by passwordpolicy_banned_acquire()
+ **/
+void passwordpolicy_banned_release(void)
+{
+  LWLockRelease(passwordpolicy_lock_banned);
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Compile the banned words file, one word per line, empty lines and lines starting with # are ignored
+ * @return automaton in local memory
+ **/
+PasswordPolicyBanned *passwordpolicy_banned_compile(const char *path)
+{
+  char line[PASSWORDPOLICY_BANNED_MAX_WORD + 2];
+  char **words;
+  uint32 num_words = 0, max_words = 64, num_states, num_classes, i, j, c, len, lcp, state, next;
+  uint32 *fail, *queue, head, tail;
+  bool *terminal;
+  uint8 folded_class[256];
+  Size size;
+  PasswordPolicyBanned *compiled;
+  FILE *file;
+
+  file = AllocateFile(path, "r");
+  if (file == NULL)
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not open banned words file \"%s\": %m", path)));
+
+  /* read the words, without case */
+  words = palloc(max_words * sizeof(char *));
+  MemSet(folded_class, 0, sizeof(folded_class));
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    len = strlen(line);
+    if (len > 0 && line[len - 1] != '\n' && !feof(file))
+    {
+      FreeFile(file);
+      ereport(ERROR, (errcode(ERRCODE_CONFIG_FILE_ERROR),
+                      errmsg("passwordpolicy: banned word longer than %d bytes in \"%s\"",
+                             PASSWORDPOLICY_BANNED_MAX_WORD, path)));
+    }
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+      len--;
+    if (len == 0 || line[0] == '#')
+      continue;
+
+    for (i = 0; i < len; i++)
+    {
+      line[i] = pg_ascii_tolower((unsigned char)line[i]);
+      folded_class[(unsigned char)line[i]] = 1;
+    }
+    line[len] = '\0';
+
+    if (num_words == max_words)
+    {
+      max_words *= 2;
+      words = repalloc(words, max_words * sizeof(char *));
+    }
+    words[num_words++] = pstrdup(line);
+  }
+  if (ferror(file))
+  {
+    FreeFile(file);
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not read banned words file \"%s\": %m", path)));
+  }
+  FreeFile(file);
+
+  /* one class per character of the words, the other characters share class 0 */
+  num_classes = 1;
+  for (c = 0; c < 256; c++)
+  {
+    if (folded_class[c])
+      folded_class[c] = (uint8)num_classes++;
+  }
+
+  /* sorted, a state per distinct prefix */
+  qsort(words, num_words, sizeof(char *), passwordpolicy_banned_word_cmp);
+  num_states = 1;
+  for (i = 0; i < num_words; i++)
+  {
+    lcp = 0;
+    if (i > 0)
+    {
+      while (words[i - 1][lcp] != '\0' && words[i - 1][lcp] == words[i][lcp])
+        lcp++;
+    }
+    num_states += strlen(words[i]) - lcp;
+  }
+
+  if ((uint64)num_states * num_classes > passwordpolicy_banned->max_transitions)
+    ereport(ERROR, (errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+                    errmsg("passwordpolicy: banned words of \"%s\" need %llu kB of shared memory", path,
+                           (unsigned long long)(((uint64)num_states * num_classes * sizeof(uint32) + 1023) / 1024)),
+                    errhint("increase password_policy.banned_words_max_size")));
+
+  size = add_size(offsetof(PasswordPolicyBanned, transitions), mul_size((Size)num_states * num_classes, sizeof(uint32)));
+  compiled = MemoryContextAllocExtended(CurrentMemoryContext, size, MCXT_ALLOC_HUGE | MCXT_ALLOC_ZERO);
+  compiled->num_words = num_words;
+  compiled->num_states = num_states;
+  compiled->num_classes = num_classes;
+  for (c = 0; c < 256; c++)
+    compiled->classes[c] = folded_class[(unsigned char)pg_ascii_tolower((unsigned char)c)];
+
+  /* trie, 0 is the root and no transition */
+  terminal = palloc0(num_states * sizeof(bool));
+  next = 1;
+  for (i = 0; i < num_words; i++)
+  {
+    state = 0;
+    for (j = 0; words[i][j] != '\0'; j++)
+    {
+      c = folded_class[(unsigned char)words[i][j]];
+      if (compiled->transitions[state * num_classes + c] == 0)
+        compiled->transitions[state * num_classes + c] = next++;
+      state = compiled->transitions[state * num_classes + c];
+    }
+    terminal[state] = true;
+    pfree(words[i]);
+  }
+  pfree(words);
+
+  /*
+   * failure links in breadth-first order, the missing transitions of a state are the ones of
+   * its failure state, and a state ends a word if its failure state does
+   */
+  fail = palloc0(num_states * sizeof(uint32));
+  queue = palloc(num_states * sizeof(uint32));
+  head = tail = 0;
+  for (c = 0; c < num_classes; c++)
+  {
+    state = compiled->transitions[c];
+    if (state != 0)
+      queue[tail++] = state;
+  }
+  while (head < tail)
+  {
+    state = queue[head++];
+    terminal[state] = terminal[state] || terminal[fail[state]];
+    for (c = 0; c < num_classes; c++)
+    {
+      next = compiled->transitions[state * num_classes + c];
+      if (next != 0)
+      {
+        fail[next] = compiled->transitions[fail[state] * num_classes + c];
+        queue[tail++] = next;
+      }
+      else
+        compiled->transitions[state * num_classes + c] = compiled->transitions[fail[state] * num_classes + c];
+    }
+  }
+
+  for (i = 0; i < num_states * num_classes; i++)
+  {
+    if (terminal[compiled->transitions[i]])
+      compiled->transitions[i] |= PASSWORDPOLICY_BANNED_MATCH;
+  }
+
+  pfree(fail);
+  pfree(queue);
+  pfree(terminal);
+  return compiled;
+}
+
+/*
+ * @brief Check if the automaton is the one of the file, the lock must be held
+ **/
+bool passwordpolicy_banned_current(const char *path, const struct stat *st)
+{
+  return strcmp(passwordpolicy_banned->path, path) == 0 &&
+         passwordpolicy_banned->dev == st->st_dev &&
+         passwordpolicy_banned->ino == st->st_ino &&
+         passwordpolicy_banned->mtime == st->st_mtime &&
+         passwordpolicy_banned->size == st->st_size;
+}
+
+int passwordpolicy_banned_word_cmp(const void *a, const void *b)
+{
+  return strcmp(*(char *const *)a, *(char *const *)b);
+}
@@ -0,0 +1,33 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_banned.h
+ *      Banned words check of the passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_BANNED_H_
+#define _PASSWORDPOLICY_BANNED_H_
+
+#include <postgres.h>
+
+#include "passwordpolicy_vars.h"
+
+extern PGDLLEXPORT const PasswordPolicyBanned *passwordpolicy_banned_acquire(void);
+extern PGDLLEXPORT void passwordpolicy_banned_init(void);
+extern PGDLLEXPORT Size passwordpolicy_banned_memsize(void);
+extern PGDLLEXPORT void passwordpolicy_banned_release(void);
+
+/*
+ * @brief Next state of the automaton after the character c, the initial state is 0
+ * The PASSWORDPOLICY_BANNED_MATCH bit of the result is set when a banned word ends at c.
+ **/
+static inline uint32 passwordpolicy_banned_next(const PasswordPolicyBanned *banned, uint32 state, unsigned char c)
+{
+  return banned->transitions[(state & ~PASSWORDPOLICY_BANNED_MATCH) * banned->num_classes + banned->classes[c]];
+}
+
+#endif
@@ -29,10 +29,14 @@
 #endif
 #include <utils/guc.h>
 #include <utils/memutils.h>
+#include <utils/timestamp.h>
 
+#include "passwordpolicy_changes.h"
 #include "passwordpolicy_hash_accounts.h"
 #include "passwordpolicy_hash_history.h"
+#include "passwordpolicy_profiles.h"
 #include "passwordpolicy_shmem.h"
+#include "passwordpolicy_snapshot.h"
 #include "passwordpolicy_vars.h"
 
 /* global settings */
@@ -52,8 +56,11 @@ static void passwordpolicy_sigterm(SIGNAL_ARGS);
  */
 void PasswordPolicyBgwMain(Datum arg)
 {
+  bool full_reload;
   int sleep_ms = SECS_PER_MINUTE * 1000;
+  long timeout_ms;
   MemoryContext PasswordPolicyContext = NULL;
+  TimestampTz last_run, now;
 
   pqsignal(SIGHUP, passwordpolicy_sighup);
   pqsignal(SIGINT, SIG_IGN);
@@ -75,34 +82,83 @@ void PasswordPolicyBgwMain(Datum arg)
   /* Disable paralle query */
   SetConfigOption("max_parallel_workers_per_gather", "0", PGC_USERSET, PGC_S_OVERRIDE);
 
+  /* backends wake up the worker when they commit role changes */
+  LWLockAcquire(passwordpolicy_shm->lock, LW_EXCLUSIVE);
+  passwordpolicy_shm->bgw_latch = &MyProc->procLatch;
+  LWLockRelease(passwordpolicy_shm->lock);
+
+  /* changes committed before this point are included */
+  (void)passwordpolicy_changes_apply();
   passwordpolicy_hash_accounts_load();
+  passwordpolicy_profiles_refresh();
 
-  passwordpolicy_hash_history_load();
+  /* after a restart of the worker, write the records it could have lost */
+  if (!passwordpolicy_hash_history_load())
+    passwordpolicy_hash_history_save(true);
 
+  last_run = GetCurrentTimestamp();
   while (1)
   {
     int rc;
 
     CHECK_FOR_INTERRUPTS();
 
+    full_reload = false;
     if (PasswordPolicyReloadConfig)
     {
       ProcessConfigFile(PGC_SIGHUP);
       PasswordPolicyReloadConfig = false;
+      /* include_all could have changed */
+      full_reload = true;
     }
 
-    /* refresh account list */
-    passwordpolicy_hash_accounts_load();
+    /* apply the role changes, read all the accounts only if some were lost */
+    if (!passwordpolicy_changes_apply())
+      full_reload = true;
+    if (full_reload)
+    {
+      passwordpolicy_hash_accounts_load();
+      passwordpolicy_profiles_invalidate();
+    }
+    /* role, membership or profile changes */
+    passwordpolicy_profiles_refresh();
 
-    passwordpolicy_hash_history_save();
+    /* group commit: wait for other password changes, then write them all */
+    if (passwordpolicy_hash_history_queued())
+    {
+      if (guc_passwordpolicy_history_flush_delay > 0)
+      {
+        /* records queued during the delay are written in the same transaction */
+        rc = WaitLatch(&MyProc->procLatch, WL_TIMEOUT | WL_POSTMASTER_DEATH, guc_passwordpolicy_history_flush_delay,
+                       PG_WAIT_EXTENSION);
+        if (rc & WL_POSTMASTER_DEATH)
+          proc_exit(1);
+      }
+      passwordpolicy_hash_history_save(false);
+    }
 
-    /* shutdown if requested */
+    now = GetCurrentTimestamp();
+    if (TimestampDifferenceExceeds(last_run, now, sleep_ms))
+    {
+      /* on-demand mode: clock sweep of the accounts */
+      if (guc_passwordpolicy_lock_all_accounts && guc_passwordpolicy_lock_on_demand)
+        passwordpolicy_hash_accounts_load();
+
+      /* persist soft-lock counters, they must survive a crash */
+      passwordpolicy_snapshot_save();
+
+      last_run = now;
+    }
+
+    /* shutdown if requested, the records committed meanwhile are written first */
     if (got_sigterm)
     {
+      passwordpolicy_hash_history_save(false);
       break;
     }
 
-    rc = WaitLatch(&MyProc->procLatch, WL_LATCH_SET | WL_TIMEOUT | WL_POSTMASTER_DEATH, sleep_ms,
+    timeout_ms = sleep_ms - TimestampDifferenceMilliseconds(last_run, now);
+    rc = WaitLatch(&MyProc->procLatch, WL_LATCH_SET | WL_TIMEOUT | WL_POSTMASTER_DEATH, Max(timeout_ms, 1),
                    PG_WAIT_EXTENSION);
     if (rc & WL_POSTMASTER_DEATH)
       proc_exit(1);
@@ -110,6 +166,10 @@ void PasswordPolicyBgwMain(Datum arg)
     ResetLatch(&MyProc->procLatch);
   }
 
+  LWLockAcquire(passwordpolicy_shm->lock, LW_EXCLUSIVE);
+  passwordpolicy_shm->bgw_latch = NULL;
+  LWLockRelease(passwordpolicy_shm->lock);
+
   MemoryContextReset(PasswordPolicyContext);
 
   ereport(LOG, (errmsg("passwordpolicy: background worker shutting down")));
@@ -0,0 +1,231 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_breached.c
+ *      Check of the passwords against a breached passwords index
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_breached.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if (PG_VERSION_NUM >= 140000)
+#include <common/cryptohash.h>
+#endif
+#include <utils/memutils.h>
+
+#include "passwordpolicy_breached_format.h"
+#include "passwordpolicy_vars.h"
+
+/*
+ * The index is built offline by passwordpolicy_breached_build and mapped read-only by every
+ * backend checking a password, the pages are shared through the page cache. The mapping is
+ * kept until password_policy.breached_file names another file or the file is replaced.
+ */
+typedef struct PasswordPolicyBreachedMap
+{
+  char *path;
+  dev_t dev;
+  ino_t ino;
+  time_t mtime;
+  size_t size;
+  const PasswordPolicyBreachedHeader *header;
+  const uint8 *data;
+} PasswordPolicyBreachedMap;
+
+static PasswordPolicyBreachedMap passwordpolicy_breached_map = {NULL, 0, 0, 0, 0, NULL, NULL};
+
+/* Private functions forward declaration */
+void passwordpolicy_breached_open(const char *path);
+void passwordpolicy_breached_close(void);
+bool passwordpolicy_breached_sorted_contains(const uint8 *digest);
+
+/*
+ * @brief Check if the password is in the breached passwords index of password_policy.breached_file
+ * @return true if the password was found, or may be in the list with a filter
+ **/
+bool passwordpolicy_breached_check(const char *password)
+{
+#if (PG_VERSION_NUM >= 140000)
+  uint8 digest[PASSWORDPOLICY_BREACHED_DIGEST_LENGTH];
+  pg_cryptohash_ctx *ctx;
+
+  if (guc_passwordpolicy_breached_file == NULL || guc_passwordpolicy_breached_file[0] == '\0')
+    return false;
+
+  passwordpolicy_breached_open(guc_passwordpolicy_breached_file);
+
+  ctx = pg_cryptohash_create(PG_SHA1);
+  if (ctx == NULL ||
+      pg_cryptohash_init(ctx) != 0 ||
+      pg_cryptohash_update(ctx, (const uint8 *)password, strlen(password)) != 0 ||
+      pg_cryptohash_final(ctx, digest, sizeof(digest)) != 0)
+  {
+    pg_cryptohash_free(ctx);
+    ereport(ERROR, (errmsg("error generating sha1")));
+    return false;
+  }
+  pg_cryptohash_free(ctx);
+
+  if (passwordpolicy_breached_map.header->format == PASSWORDPOLICY_BREACHED_FUSE)
+    return passwordpolicy_breached_fuse_contains(passwordpolicy_breached_key(digest),
+                                                 passwordpolicy_breached_map.header,
+                                                 passwordpolicy_breached_map.data);
+  return passwordpolicy_breached_sorted_contains(digest);
+#else
+  if (guc_passwordpolicy_breached_file == NULL || guc_passwordpolicy_breached_file[0] == '\0')
+    return false;
+
+  ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+                  errmsg("passwordpolicy: password_policy.breached_file requires PostgreSQL 14 or later")));
+  return false;
+#endif
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Map the index file, unless it's already mapped
+ **/
+void passwordpolicy_breached_open(const char *path)
+{
+  int fd;
+  struct stat st;
+  void *addr;
+  const PasswordPolicyBreachedHeader *header;
+  uint64 expected;
+
+  fd = open(path, O_RDONLY | PG_BINARY, 0);
+  if (fd < 0)
+  {
+    passwordpolicy_breached_close();
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not open breached passwords file \"%s\": %m", path)));
+  }
+  if (fstat(fd, &st) < 0)
+  {
+    close(fd);
+    passwordpolicy_breached_close();
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not stat breached passwords file \"%s\": %m", path)));
+  }
+
+  if (passwordpolicy_breached_map.header != NULL &&
+      strcmp(passwordpolicy_breached_map.path, path) == 0 &&
+      passwordpolicy_breached_map.dev == st.st_dev &&
+      passwordpolicy_breached_map.ino == st.st_ino &&
+      passwordpolicy_breached_map.mtime == st.st_mtime &&
+      passwordpolicy_breached_map.size == (size_t)st.st_size)
+  {
+    close(fd);
+    return;
+  }
+
+  passwordpolicy_breached_close();
+
+  if ((size_t)st.st_size < sizeof(PasswordPolicyBreachedHeader))
+  {
+    close(fd);
+    ereport(ERROR, (errcode(ERRCODE_DATA_CORRUPTED),
+                    errmsg("passwordpolicy: invalid breached passwords file \"%s\"", path)));
+  }
+
+  addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED)
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not map breached passwords file \"%s\": %m", path)));
+
+  header = (const PasswordPolicyBreachedHeader *)addr;
+  if (header->format == PASSWORDPOLICY_BREACHED_FUSE)
+    expected = header->array_length;
+  else
+    expected = header->count * PASSWORDPOLICY_BREACHED_DIGEST_LENGTH;
+  if (header->magic != PASSWORDPOLICY_BREACHED_MAGIC ||
+      header->version != PASSWORDPOLICY_BREACHED_VERSION ||
+      (header->format != PASSWORDPOLICY_BREACHED_SORTED && header->format != PASSWORDPOLICY_BREACHED_FUSE) ||
+      (header->format == PASSWORDPOLICY_BREACHED_FUSE && header->segment_count_length + 2 * header->segment_length > header->array_length) ||
+      sizeof(PasswordPolicyBreachedHeader) + expected != (uint64)st.st_size)
+  {
+    munmap(addr, st.st_size);
+    ereport(ERROR, (errcode(ERRCODE_DATA_CORRUPTED),
+                    errmsg("passwordpolicy: invalid breached passwords file \"%s\"", path),
+                    errhint("build the file again with passwordpolicy_breached_build")));
+  }
+
+  /* random lookups, don't read ahead */
+  (void)madvise(addr, st.st_size, MADV_RANDOM);
+
+  passwordpolicy_breached_map.path = MemoryContextStrdup(TopMemoryContext, path);
+  passwordpolicy_breached_map.dev = st.st_dev;
+  passwordpolicy_breached_map.ino = st.st_ino;
+  passwordpolicy_breached_map.mtime = st.st_mtime;
+  passwordpolicy_breached_map.size = st.st_size;
+  passwordpolicy_breached_map.header = header;
+  passwordpolicy_breached_map.data = (const uint8 *)addr + sizeof(PasswordPolicyBreachedHeader);
+
+  ereport(DEBUG1, (errmsg("passwordpolicy: breached passwords file \"%s\" mapped, " UINT64_FORMAT " entries",
+                          path, (uint64)header->count)));
+}
+
+/*
+ * @brief Unmap the index file
+ **/
+void passwordpolicy_breached_close(void)
+{
+  if (passwordpolicy_breached_map.header != NULL)
+    munmap((void *)passwordpolicy_breached_map.header, passwordpolicy_breached_map.size);
+  if (passwordpolicy_breached_map.path != NULL)
+    pfree(passwordpolicy_breached_map.path);
+  MemSet(&passwordpolicy_breached_map, 0, sizeof(passwordpolicy_breached_map));
+}
+
+/*
+ * @brief Interpolation search of a digest in the sorted file
+ * The digests are uniformly distributed, each probe lands near the digest and a lookup
+ * reads a few pages even with hundreds of millions of entries.
+ **/
+bool passwordpolicy_breached_sorted_contains(const uint8 *digest)
+{
+  int cmp;
+  uint64 key, lo_key, hi_key, lo, hi, pos;
+  const uint8 *entries = passwordpolicy_breached_map.data;
+
+  if (passwordpolicy_breached_map.header->count == 0)
+    return false;
+
+  key = passwordpolicy_breached_key(digest);
+  lo = 0;
+  hi = passwordpolicy_breached_map.header->count - 1;
+  while (lo <= hi)
+  {
+    lo_key = passwordpolicy_breached_key(entries + lo * PASSWORDPOLICY_BREACHED_DIGEST_LENGTH);
+    hi_key = passwordpolicy_breached_key(entries + hi * PASSWORDPOLICY_BREACHED_DIGEST_LENGTH);
+    if (key < lo_key || key > hi_key)
+      return false;
+
+    if (hi_key == lo_key)
+      pos = lo + (hi - lo) / 2;
+    else
+      pos = lo + (uint64)((long double)(key - lo_key) / (hi_key - lo_key) * (hi - lo));
+
+    cmp = memcmp(entries + pos * PASSWORDPOLICY_BREACHED_DIGEST_LENGTH, digest, PASSWORDPOLICY_BREACHED_DIGEST_LENGTH);
+    if (cmp == 0)
+      return true;
+    if (cmp < 0)
+      lo = pos + 1;
+    else if (pos == 0)
+      return false;
+    else
+      hi = pos - 1;
+  }
+  return false;
+}
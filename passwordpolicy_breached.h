@@ -0,0 +1,19 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_breached.h
+ *      Check of the passwords against a breached passwords index
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_BREACHED_H_
+#define _PASSWORDPOLICY_BREACHED_H_
+
+#include <postgres.h>
+
+extern PGDLLEXPORT bool passwordpolicy_breached_check(const char *password);
+
+#endif
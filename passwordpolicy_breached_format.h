@@ -0,0 +1,126 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_breached_format.h
+ *      File format of the breached passwords index
+ *
+ * Shared by the extension and by the offline builder, it doesn't depend on
+ * the PostgreSQL headers.
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_BREACHED_FORMAT_H_
+#define _PASSWORDPOLICY_BREACHED_FORMAT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * The passwords are identified by their SHA-1 digest, the format of the public breach dumps.
+ * The file is a header followed by:
+ *  - PASSWORDPOLICY_BREACHED_SORTED: count digests in ascending order, exact matches
+ *  - PASSWORDPOLICY_BREACHED_FUSE: array_length fingerprints of a binary fuse filter of the
+ *    first 8 bytes of the digests, about 9 bits per entry and 0.4% of false positives
+ * Numbers are written in the byte order of the machine building the file, magic detects a
+ * file built with the other order.
+ */
+#define PASSWORDPOLICY_BREACHED_MAGIC UINT64_C(0x5050425245414348) /* "PPBREACH" */
+#define PASSWORDPOLICY_BREACHED_VERSION 1
+#define PASSWORDPOLICY_BREACHED_DIGEST_LENGTH 20
+
+typedef enum PasswordPolicyBreachedFormat
+{
+  PASSWORDPOLICY_BREACHED_SORTED = 1,
+  PASSWORDPOLICY_BREACHED_FUSE = 2
+} PasswordPolicyBreachedFormat;
+
+typedef struct PasswordPolicyBreachedHeader
+{
+  uint64_t magic;
+  uint32_t version;
+  uint32_t format;
+  uint64_t count;                /* digests in the file or in the filter */
+  /* binary fuse filter */
+  uint64_t seed;
+  uint32_t segment_length;
+  uint32_t segment_length_mask;
+  uint32_t segment_count;
+  uint32_t segment_count_length;
+  uint32_t array_length;
+  uint32_t padding;
+} PasswordPolicyBreachedHeader;
+
+/*
+ * @brief Key of a digest: its first 8 bytes, big-endian so keys and digests sort the same way
+ **/
+static inline uint64_t passwordpolicy_breached_key(const uint8_t *digest)
+{
+  uint64_t key = 0;
+  int i;
+
+  for (i = 0; i < 8; i++)
+    key = (key << 8) | digest[i];
+  return key;
+}
+
+static inline uint64_t passwordpolicy_breached_murmur64(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= UINT64_C(0xff51afd7ed558ccd);
+  h ^= h >> 33;
+  h *= UINT64_C(0xc4ceb9fe1a85ec53);
+  h ^= h >> 33;
+  return h;
+}
+
+static inline uint64_t passwordpolicy_breached_mulhi(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+  return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#else
+  uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+  uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+  uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+  uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+
+  return (hi_lo >> 32) + (cross >> 32) + hi_hi;
+#endif
+}
+
+static inline uint8_t passwordpolicy_breached_fingerprint(uint64_t hash)
+{
+  return (uint8_t)(hash ^ (hash >> 32));
+}
+
+/*
+ * @brief Position of a key hash in the segment index of the filter, index is 0, 1 or 2
+ **/
+static inline uint32_t passwordpolicy_breached_fuse_position(int index, uint64_t hash,
+                                                             const PasswordPolicyBreachedHeader *header)
+{
+  uint64_t h = passwordpolicy_breached_mulhi(hash, header->segment_count_length);
+
+  h += (uint64_t)index * header->segment_length;
+  h ^= ((hash & ((UINT64_C(1) << 36) - 1)) >> (36 - 18 * index)) & header->segment_length_mask;
+  return (uint32_t)h;
+}
+
+/*
+ * @brief Check if a key is in a binary fuse filter, false positives are possible
+ **/
+static inline bool passwordpolicy_breached_fuse_contains(uint64_t key, const PasswordPolicyBreachedHeader *header,
+                                                         const uint8_t *fingerprints)
+{
+  uint64_t hash = passwordpolicy_breached_murmur64(key + header->seed);
+  uint8_t f = passwordpolicy_breached_fingerprint(hash);
+
+  f ^= fingerprints[passwordpolicy_breached_fuse_position(0, hash, header)];
+  f ^= fingerprints[passwordpolicy_breached_fuse_position(1, hash, header)];
+  f ^= fingerprints[passwordpolicy_breached_fuse_position(2, hash, header)];
+  return f == 0;
+}
+
+#endif
@@ -0,0 +1,381 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_changes.c
+ *      Queue of role changes applied by the background worker
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_changes.h"
+
+#include <access/xact.h>
+#include <executor/spi.h>
+#include <nodes/parsenodes.h>
+#include <pgstat.h>
+#include <storage/latch.h>
+#include <storage/shmem.h>
+#include <utils/acl.h>
+#include <utils/memutils.h>
+#include <utils/snapmgr.h>
+
+#include "passwordpolicy_hash_accounts.h"
+#include "passwordpolicy_hash_history.h"
+#include "passwordpolicy_profiles.h"
+#include "passwordpolicy_shmem.h"
+#include "passwordpolicy_vars.h"
+
+/*
+ * CREATE ROLE, ALTER ROLE, DROP ROLE, ALTER ROLE ... RENAME and the changes of
+ * passwordpolicy.accounts_lockable are recorded by the backend running them, and pushed
+ * to a shared ring when its transaction commits; changes of aborted (sub)transactions are
+ * discarded. The background worker is woken up and applies them one role at a time, the
+ * list of all the accounts is only read again when the ring overflows.
+ */
+#define PASSWORDPOLICY_CHANGES_SIZE 1024
+
+StaticAssertDecl((PASSWORDPOLICY_CHANGES_SIZE & (PASSWORDPOLICY_CHANGES_SIZE - 1)) == 0,
+                 "PASSWORDPOLICY_CHANGES_SIZE must be a power of 2");
+
+typedef struct PasswordPolicyPendingChange
+{
+  int nestlevel;
+  PasswordPolicyChange change;
+} PasswordPolicyPendingChange;
+
+/* changes of the current transaction, allocated in TopTransactionContext */
+static List *passwordpolicy_changes_pending = NIL;
+static bool passwordpolicy_changes_callbacks = false;
+
+/* Private functions forward declaration */
+static void passwordpolicy_changes_push(void);
+static void passwordpolicy_changes_subxact_callback(SubXactEvent event, SubTransactionId mySubid,
+                                                    SubTransactionId parentSubid, void *arg);
+static void passwordpolicy_changes_xact_callback(XactEvent event, void *arg);
+
+/**
+ * @brief Record a role change, it will be applied if the transaction commits
+ * @param kind: kind of change
+ * @param roleid: role oid, InvalidOid if unknown
+ * @param usename: role name, can be NULL
+ * @param oldname: previous role name, for renames
+ * @return void
+ */
+void passwordpolicy_changes_add(PasswordPolicyChangeKind kind, Oid roleid, const char *usename, const char *oldname)
+{
+  MemoryContext oldcontext;
+  PasswordPolicyPendingChange *pending;
+
+  if (!passwordpolicy_shmem_check())
+    return;
+
+  if (!passwordpolicy_changes_callbacks)
+  {
+    RegisterXactCallback(passwordpolicy_changes_xact_callback, NULL);
+    RegisterSubXactCallback(passwordpolicy_changes_subxact_callback, NULL);
+    passwordpolicy_changes_callbacks = true;
+  }
+
+  oldcontext = MemoryContextSwitchTo(TopTransactionContext);
+  pending = (PasswordPolicyPendingChange *)palloc0(sizeof(PasswordPolicyPendingChange));
+  pending->nestlevel = GetCurrentTransactionNestLevel();
+  pending->change.kind = kind;
+  pending->change.roleid = roleid;
+  if (usename != NULL)
+    namestrcpy(&(pending->change.usename), usename);
+  if (oldname != NULL)
+    namestrcpy(&(pending->change.oldname), oldname);
+  passwordpolicy_changes_pending = lappend(passwordpolicy_changes_pending, pending);
+  MemoryContextSwitchTo(oldcontext);
+}
+
+/**
+ * @brief Apply the committed changes, called by the background worker
+ * @param void
+ * @return false if changes were lost and all the accounts must be read again
+ */
+bool passwordpolicy_changes_apply(void)
+{
+  bool complete, lost;
+  int ret;
+  uint32 i, num;
+  PasswordPolicyChange *changes;
+
+  LWLockAcquire(passwordpolicy_shm->lock, LW_EXCLUSIVE);
+  lost = passwordpolicy_shm->changes_overflow;
+  num = passwordpolicy_shm->changes_head - passwordpolicy_shm->changes_tail;
+  changes = num > 0 ? (PasswordPolicyChange *)palloc(mul_size(num, sizeof(PasswordPolicyChange))) : NULL;
+  for (i = 0; i < num; i++)
+    changes[i] = passwordpolicy_changes[(passwordpolicy_shm->changes_tail + i) & (PASSWORDPOLICY_CHANGES_SIZE - 1)];
+  passwordpolicy_shm->changes_tail = passwordpolicy_shm->changes_head;
+  passwordpolicy_shm->changes_overflow = false;
+  LWLockRelease(passwordpolicy_shm->lock);
+
+  if (num == 0 && !lost)
+    return true;
+
+  complete = !lost;
+
+  SetCurrentStatementStartTimestamp();
+  StartTransactionCommand();
+  SPI_connect();
+  PushActiveSnapshot(GetTransactionSnapshot());
+
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy checking extension");
+
+  ret = SPI_execute("SELECT 1 FROM pg_extension WHERE extname = 'passwordpolicy'", true, 0);
+  if (ret != SPI_OK_SELECT)
+  {
+    ereport(ERROR, (errmsg("passwordpolicy: failed to check if extension is installed")));
+    goto error;
+  }
+
+  if (SPI_processed == 0)
+  {
+    ereport(DEBUG3, (errmsg("passwordpolicy: extension is not installed, skipping role changes")));
+    goto error;
+  }
+
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy applying role changes");
+
+  /* the history of the roles dropped meanwhile must be deleted */
+  if (lost)
+    passwordpolicy_hash_history_purge();
+
+  for (i = 0; i < num; i++)
+  {
+    /* CreateRole and RenameRole don't make the row visible to the rest of the statement */
+    if (!OidIsValid(changes[i].roleid) && NameStr(changes[i].usename)[0] != '\0' &&
+        (changes[i].kind == PASSWORDPOLICY_CHANGE_ROLE || changes[i].kind == PASSWORDPOLICY_CHANGE_ROLE_RENAME))
+      changes[i].roleid = get_role_oid(NameStr(changes[i].usename), true);
+
+    ereport(DEBUG3, (errmsg("passwordpolicy: applying change '%d' of role '%u'", changes[i].kind, changes[i].roleid)));
+    switch (changes[i].kind)
+    {
+    case PASSWORDPOLICY_CHANGE_ROLE:
+      passwordpolicy_hash_accounts_refresh(changes[i].roleid);
+      break;
+    case PASSWORDPOLICY_CHANGE_ROLE_DROP:
+      passwordpolicy_hash_accounts_remove(changes[i].roleid);
+      passwordpolicy_hash_history_drop(changes[i].roleid);
+      passwordpolicy_profiles_drop(changes[i].roleid);
+      break;
+    case PASSWORDPOLICY_CHANGE_ROLE_RENAME:
+      passwordpolicy_hash_accounts_refresh(changes[i].roleid);
+      break;
+    case PASSWORDPOLICY_CHANGE_LOCKABLE:
+      if (!guc_passwordpolicy_lock_all_accounts)
+        passwordpolicy_hash_accounts_refresh(get_role_oid(NameStr(changes[i].usename), true));
+      break;
+    case PASSWORDPOLICY_CHANGE_PROFILES:
+      passwordpolicy_profiles_invalidate();
+      break;
+    case PASSWORDPOLICY_CHANGE_FULL:
+      complete = false;
+      break;
+    }
+  }
+
+error:
+  SPI_finish();
+  PopActiveSnapshot();
+  CommitTransactionCommand();
+  pgstat_report_stat(true);
+  pgstat_report_activity(STATE_IDLE, NULL);
+
+  if (changes)
+    pfree(changes);
+
+  return complete;
+}
+
+void passwordpolicy_changes_init(void)
+{
+  bool found;
+
+  passwordpolicy_changes = ShmemInitStruct("passwordpolicy changes", passwordpolicy_changes_memsize(), &found);
+  if (!found)
+    MemSet(passwordpolicy_changes, 0, passwordpolicy_changes_memsize());
+}
+
+Size passwordpolicy_changes_memsize(void)
+{
+  return mul_size(PASSWORDPOLICY_CHANGES_SIZE, sizeof(PasswordPolicyChange));
+}
+
+/**
+ * @brief ProcessUtility hook, record the role changes
+ */
+#if (PG_VERSION_NUM >= 140000)
+void passwordpolicy_changes_process_utility(PlannedStmt *pstmt, const char *queryString, bool readOnlyTree,
+                                            ProcessUtilityContext context, ParamListInfo params,
+                                            QueryEnvironment *queryEnv, DestReceiver *dest,
+                                            QueryCompletion *qc)
+#else
+void passwordpolicy_changes_process_utility(PlannedStmt *pstmt, const char *queryString,
+                                            ProcessUtilityContext context, ParamListInfo params,
+                                            QueryEnvironment *queryEnv, DestReceiver *dest,
+                                            QueryCompletion *qc)
+#endif
+{
+  Oid roleid;
+  List *dropped_names = NIL, *dropped_oids = NIL;
+  ListCell *lc, *lc2;
+  Node *parsetree = pstmt->utilityStmt;
+
+  /* the oids of the dropped roles can only be read before they are dropped */
+  if (IsA(parsetree, DropRoleStmt))
+  {
+    foreach (lc, ((DropRoleStmt *)parsetree)->roles)
+    {
+      RoleSpec *rolspec = lfirst(lc);
+
+      if (rolspec->roletype != ROLESPEC_CSTRING)
+        continue;
+      roleid = get_role_oid(rolspec->rolename, true);
+      if (!OidIsValid(roleid))
+        continue;
+      dropped_oids = lappend_oid(dropped_oids, roleid);
+      dropped_names = lappend(dropped_names, rolspec->rolename);
+    }
+  }
+
+#if (PG_VERSION_NUM >= 140000)
+  if (passwordpolicy_prev_process_utility_hook)
+    passwordpolicy_prev_process_utility_hook(pstmt, queryString, readOnlyTree, context, params, queryEnv, dest, qc);
+  else
+    standard_ProcessUtility(pstmt, queryString, readOnlyTree, context, params, queryEnv, dest, qc);
+#else
+  if (passwordpolicy_prev_process_utility_hook)
+    passwordpolicy_prev_process_utility_hook(pstmt, queryString, context, params, queryEnv, dest, qc);
+  else
+    standard_ProcessUtility(pstmt, queryString, context, params, queryEnv, dest, qc);
+#endif
+
+  switch (nodeTag(parsetree))
+  {
+  case T_CreateRoleStmt:
+    roleid = get_role_oid(((CreateRoleStmt *)parsetree)->role, true);
+    passwordpolicy_changes_add(PASSWORDPOLICY_CHANGE_ROLE, roleid, ((CreateRoleStmt *)parsetree)->role, NULL);
+    break;
+  case T_AlterRoleStmt:
+    /* LOGIN / NOLOGIN change the list of accounts */
+    roleid = get_rolespec_oid(((AlterRoleStmt *)parsetree)->role, true);
+    passwordpolicy_changes_add(PASSWORDPOLICY_CHANGE_ROLE, roleid, NULL, NULL);
+    break;
+  case T_DropRoleStmt:
+    forboth(lc, dropped_oids, lc2, dropped_names)
+    {
+      passwordpolicy_changes_add(PASSWORDPOLICY_CHANGE_ROLE_DROP, lfirst_oid(lc), (const char *)lfirst(lc2), NULL);
+    }
+    break;
+  case T_RenameStmt:
+    if (((RenameStmt *)parsetree)->renameType == OBJECT_ROLE)
+    {
+      roleid = get_role_oid(((RenameStmt *)parsetree)->newname, true);
+      passwordpolicy_changes_add(PASSWORDPOLICY_CHANGE_ROLE_RENAME, roleid, ((RenameStmt *)parsetree)->newname,
+                                 ((RenameStmt *)parsetree)->subname);
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Copy the changes of the committed transaction to the shared ring, and wake up the worker
+ **/
+static void passwordpolicy_changes_push(void)
+{
+  Latch *latch;
+  ListCell *lc;
+  PasswordPolicyPendingChange *pending;
+
+  LWLockAcquire(passwordpolicy_shm->lock, LW_EXCLUSIVE);
+  foreach (lc, passwordpolicy_changes_pending)
+  {
+    pending = (PasswordPolicyPendingChange *)lfirst(lc);
+    if (passwordpolicy_shm->changes_head - passwordpolicy_shm->changes_tail >= PASSWORDPOLICY_CHANGES_SIZE)
+    {
+      passwordpolicy_shm->changes_overflow = true;
+      break;
+    }
+    passwordpolicy_changes[passwordpolicy_shm->changes_head & (PASSWORDPOLICY_CHANGES_SIZE - 1)] = pending->change;
+    passwordpolicy_shm->changes_head++;
+  }
+  latch = passwordpolicy_shm->bgw_latch;
+  LWLockRelease(passwordpolicy_shm->lock);
+
+  if (latch)
+    SetLatch(latch);
+}
+
+/*
+ * @brief Forget the changes of aborted subtransactions, move the committed ones to the parent
+ **/
+static void passwordpolicy_changes_subxact_callback(SubXactEvent event, SubTransactionId mySubid,
+                                                    SubTransactionId parentSubid, void *arg)
+{
+  int nestlevel;
+  ListCell *lc;
+  PasswordPolicyPendingChange *pending;
+
+  if (passwordpolicy_changes_pending == NIL)
+    return;
+
+  nestlevel = GetCurrentTransactionNestLevel();
+  switch (event)
+  {
+  case SUBXACT_EVENT_ABORT_SUB:
+    foreach (lc, passwordpolicy_changes_pending)
+    {
+      pending = (PasswordPolicyPendingChange *)lfirst(lc);
+      if (pending->nestlevel >= nestlevel)
+        passwordpolicy_changes_pending = foreach_delete_current(passwordpolicy_changes_pending, lc);
+    }
+    break;
+  case SUBXACT_EVENT_COMMIT_SUB:
+    foreach (lc, passwordpolicy_changes_pending)
+    {
+      pending = (PasswordPolicyPendingChange *)lfirst(lc);
+      if (pending->nestlevel >= nestlevel)
+        pending->nestlevel = nestlevel - 1;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/*
+ * @brief Push the changes when the transaction commits
+ **/
+static void passwordpolicy_changes_xact_callback(XactEvent event, void *arg)
+{
+  if (passwordpolicy_changes_pending == NIL)
+    return;
+
+  switch (event)
+  {
+  case XACT_EVENT_PRE_PREPARE:
+    /* the worker could apply the changes before COMMIT PREPARED */
+    ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+                    errmsg("passwordpolicy: cannot PREPARE a transaction that has changed the accounts tracked by passwordpolicy")));
+    break;
+  case XACT_EVENT_COMMIT:
+    passwordpolicy_changes_push();
+    passwordpolicy_changes_pending = NIL;
+    break;
+  case XACT_EVENT_ABORT:
+    /* memory is released with TopTransactionContext */
+    passwordpolicy_changes_pending = NIL;
+    break;
+  default:
+    break;
+  }
+}
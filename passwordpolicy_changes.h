@@ -0,0 +1,39 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_changes.h
+ *      Queue of role changes applied by the background worker
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_CHANGES_H_
+#define _PASSWORDPOLICY_CHANGES_H_
+
+#include <postgres.h>
+#include <tcop/utility.h>
+
+#include "passwordpolicy_vars.h"
+
+extern PGDLLEXPORT void passwordpolicy_changes_add(PasswordPolicyChangeKind kind, Oid roleid, const char *usename,
+                                                   const char *oldname);
+extern PGDLLEXPORT bool passwordpolicy_changes_apply(void);
+extern PGDLLEXPORT void passwordpolicy_changes_init(void);
+extern PGDLLEXPORT Size passwordpolicy_changes_memsize(void);
+
+/* Hook functions */
+#if (PG_VERSION_NUM >= 140000)
+extern void passwordpolicy_changes_process_utility(PlannedStmt *pstmt, const char *queryString, bool readOnlyTree,
+                                                   ProcessUtilityContext context, ParamListInfo params,
+                                                   QueryEnvironment *queryEnv, DestReceiver *dest,
+                                                   QueryCompletion *qc);
+#else
+extern void passwordpolicy_changes_process_utility(PlannedStmt *pstmt, const char *queryString,
+                                                   ProcessUtilityContext context, ParamListInfo params,
+                                                   QueryEnvironment *queryEnv, DestReceiver *dest,
+                                                   QueryCompletion *qc);
+#endif
+
+#endif
@@ -12,8 +12,6 @@
 
 #include "passwordpolicy_check.h"
 
-#include <ctype.h>
-
 #include <catalog/namespace.h>
 #include <commands/user.h>
 #if (PG_VERSION_NUM >= 140000)
@@ -21,18 +19,94 @@
 #endif
 #include <common/sha2.h>
 #include <fmgr.h>
+#include <mb/pg_wchar.h>
+#include <miscadmin.h>
+#include <portability/instr_time.h>
+#include <utils/acl.h>
 #include <utils/builtins.h>
-
-#ifdef USE_CRACKLIB
-#include <crack.h>
-#endif
-
+#include <utils/datetime.h>
+#include <utils/memutils.h>
+#include <utils/resowner.h>
+
+#include "passwordpolicy_banned.h"
+#include "passwordpolicy_breached.h"
+#include "passwordpolicy_dictionary.h"
+#include "passwordpolicy_entropy.h"
 #include "passwordpolicy_hash_history.h"
+#include "passwordpolicy_profiles.h"
+#include "passwordpolicy_rejections.h"
+#include "passwordpolicy_unicode.h"
 #include "passwordpolicy_vars.h"
 
+/* NULL string GUCs are empty */
+#define PASSWORDPOLICY_CHECK_STR(s) ((s) != NULL ? (s) : "")
+
+/* password being checked, and the settings of its role */
+typedef struct PasswordPolicyCandidate
+{
+  const char *username;
+  const char *password;
+  PasswordType password_type;
+  Oid roleid;                           /* InvalidOid for CREATE ROLE */
+  const PasswordPolicyProfile *profile; /* NULL for encrypted passwords */
+} PasswordPolicyCandidate;
+
+/* a rule returns false and fills the rejection when the password doesn't pass it */
+typedef bool (*PasswordPolicyRuleCheck)(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection);
+
+typedef struct PasswordPolicyRule
+{
+  const char *name;
+  PasswordPolicyRuleCheck check;
+} PasswordPolicyRule;
+
 /* forward declaration private functions */
-void passwordpolicy_check_password_policy(const char *password);
-char *passwordpolicy_generate_sha256_hash(const char *input);
+void passwordpolicy_check_candidate_digest(const PasswordPolicyCandidate *candidate, const uint8 *key, uint8 *digest);
+bool passwordpolicy_check_keyed_digest(const uint8 *key, size_t keylen, const uint8 *input, size_t len, uint8 *digest);
+void passwordpolicy_check_reject(const PasswordPolicyRejection *rejection);
+bool passwordpolicy_check_rejection(PasswordPolicyRejection *rejection, const char *fmt, ...) pg_attribute_printf(2, 3);
+void passwordpolicy_check_rules(const PasswordPolicyRule *rules, int num, const PasswordPolicyCandidate *candidate);
+bool passwordpolicy_check_rules_run(const PasswordPolicyRule *rules, int num, const PasswordPolicyCandidate *candidate,
+                                    PasswordPolicyRejection *rejection);
+bool passwordpolicy_check_rule_breached(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection);
+bool passwordpolicy_check_rule_composition(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection);
+bool passwordpolicy_check_rule_dictionary(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection);
+bool passwordpolicy_check_rule_entropy(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection);
+bool passwordpolicy_check_rule_length(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection);
+bool passwordpolicy_check_rule_username(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection);
+bool passwordpolicy_check_rule_username_encrypted(const PasswordPolicyCandidate *candidate,
+                                                  PasswordPolicyRejection *rejection);
+
+/*
+ * Rules of the plain passwords, cheapest first: a password is rejected by the first rule it
+ * doesn't pass, the expensive lookups only run for the passwords passing the cheap checks.
+ * The time of every rule is logged at DEBUG2. The password history is checked after them.
+ */
+static const PasswordPolicyRule passwordpolicy_check_plaintext_rules[] = {
+    {"length", passwordpolicy_check_rule_length},
+    {"username", passwordpolicy_check_rule_username},
+    {"composition", passwordpolicy_check_rule_composition},
+    {"entropy", passwordpolicy_check_rule_entropy},
+    {"breached", passwordpolicy_check_rule_breached},
+    {"dictionary", passwordpolicy_check_rule_dictionary},
+};
+
+/* rules of the encrypted passwords */
+static const PasswordPolicyRule passwordpolicy_check_encrypted_rules[] = {
+    {"username", passwordpolicy_check_rule_username_encrypted},
+};
+
+#if PG_VERSION_NUM >= 140000
+/*
+ * HMAC context reused by all the password changes of the backend. It's created under its
+ * own resource owner, the transaction resource owners would free it at commit.
+ */
+static pg_hmac_ctx *passwordpolicy_check_hmac = NULL;
+static ResourceOwner passwordpolicy_check_hmac_owner = NULL;
+#endif
+
+/* role whose password change was already checked by passwordpolicy.rotate_passwords */
+static const char *passwordpolicy_check_bypass_username = NULL;
 
 /*
  * check_password
@@ -56,6 +130,9 @@ void passwordpolicy_check_password(const char *username, const char *shadow_pass
                                    PasswordType password_type, Datum validuntil_time,
                                    bool validuntil_null)
 {
+  PasswordPolicyCandidate candidate;
+  PasswordPolicyProfile profile;
+
   if (passwordpolicy_prev_check_password_hook)
     passwordpolicy_prev_check_password_hook(username, shadow_pass, password_type, validuntil_time, validuntil_null);
 
@@ -65,14 +142,17 @@ void passwordpolicy_check_password(const char *username, const char *shadow_pass
                     errmsg("valid until cannot be null")));
   }
 
+  if (passwordpolicy_check_bypass_username != NULL && strcmp(passwordpolicy_check_bypass_username, username) == 0)
+    return;
+
+  candidate.username = username;
+  candidate.password = shadow_pass;
+  candidate.password_type = password_type;
+  candidate.roleid = get_role_oid(username, true);
+  candidate.profile = &profile;
+
   if (password_type != PASSWORD_TYPE_PLAINTEXT)
   {
-#if (PG_VERSION_NUM >= 150000)
-    const char *logdetail = NULL;
-#else
-    char *logdetail = NULL;
-#endif
-
     /*
      * Unfortunately we cannot perform exhaustive checks on encrypted
      * passwords - we are restricted to guessing. (Alternatively, we could
@@ -81,11 +161,9 @@ void passwordpolicy_check_password(const char *username, const char *shadow_pass
      *
      * We only check for username = password.
      */
-    if (plain_crypt_verify(username, shadow_pass, username, &logdetail) == STATUS_OK)
-    {
-      ereport(ERROR, (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-                      errmsg("password cannot contain user name")));
-    }
+    candidate.profile = NULL;
+    passwordpolicy_check_rules(passwordpolicy_check_encrypted_rules, lengthof(passwordpolicy_check_encrypted_rules),
+                               &candidate);
   }
   else
   {
@@ -93,53 +171,39 @@ void passwordpolicy_check_password(const char *username, const char *shadow_pass
      * For unencrypted passwords we can perform better checks
      */
     const char *password = shadow_pass;
-    int pwdlen = strlen(password);
-#ifdef USE_CRACKLIB
-    const char *reason;
-#endif
 
-    /* enforce minimum length */
-    if (pwdlen < guc_passwordpolicy_min_length)
-    {
-      ereport(ERROR, (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-                      errmsg("password is too short.")));
-    }
-
-    /* check if the password contains the username */
-    if (strstr(password, username))
-    {
-      ereport(ERROR, (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-                      errmsg("password cannot contain user name.")));
-    }
+    /* settings of the profile of the role, InvalidOid for CREATE ROLE */
+    passwordpolicy_profiles_resolve(candidate.roleid, &profile);
 
-    passwordpolicy_check_password_policy(password);
+    passwordpolicy_check_rules(passwordpolicy_check_plaintext_rules, lengthof(passwordpolicy_check_plaintext_rules),
+                               &candidate);
 
-#ifdef USE_CRACKLIB
-    if (guc_passwordpolicy_enable_dict_check)
+    /* not cached: the result depends on the previous password changes and on the time */
+    if (profile.history_max_num_entries > 0)
     {
-      /* call cracklib to check password */
-      if ((reason = FascistCheck(password, CRACKLIB_DICTPATH)))
-      {
-        ereport(ERROR, (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-                        errmsg("password is easily cracked."),
-                        errdetail_log("cracklib diagnostic: %s", reason)));
-      }
-    }
-#endif
+      uint8 digest[PG_SHA256_DIGEST_LENGTH];
 
-    if (guc_passwordpolicy_history_max_num_entries > 0)
-    {
-      char *password_hash = passwordpolicy_generate_sha256_hash(password);
-      if (password_hash)
+      if (passwordpolicy_generate_sha256_hash(password, digest))
       {
-        if (passwordpolicy_hash_history_exists(username, password_hash))
+        /* check and add atomically, concurrent changes of the same role can't both pass */
+        /* InvalidOid for CREATE ROLE, the role doesn't exist yet */
+        switch (passwordpolicy_hash_history_add(candidate.roleid, username, digest, GetCurrentTimestamp(),
+                                                superuser() ? 0 : guc_passwordpolicy_history_min_password_age,
+                                                profile.history_max_num_entries))
         {
+        case PASSWORDPOLICY_HISTORY_REUSED:
           ereport(ERROR, (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
                           errmsg("password cannot be one of the last %d password used.",
-                                 guc_passwordpolicy_history_max_num_entries)));
+                                 profile.history_max_num_entries)));
+          break;
+        case PASSWORDPOLICY_HISTORY_TOO_RECENT:
+          ereport(ERROR, (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+                          errmsg("password cannot be changed more than once every %d seconds.",
+                                 guc_passwordpolicy_history_min_password_age)));
+          break;
+        default:
+          break;
         }
-        passwordpolicy_hash_history_add(username, password_hash, GetCurrentTimestamp());
-        pfree(password_hash);
       }
     }
   }
@@ -147,125 +211,449 @@ void passwordpolicy_check_password(const char *username, const char *shadow_pass
   /* all checks passed, password is ok */
 }
 
-void passwordpolicy_check_password_policy(const char *password)
+/*
+ * @brief Skip the checks of the next password change of a role, already checked by the caller
+ * @param username: NULL to check all the password changes again
+ **/
+void passwordpolicy_check_bypass(const char *username)
+{
+  passwordpolicy_check_bypass_username = username;
+}
+
+/*
+ * @brief Run the rules of a plain password, without the password history nor the cache
+ * @param roleid: InvalidOid for a role that doesn't exist
+ * @param profile: filled with the settings of the role
+ * @return true if the password passes the rules, otherwise rejection is filled
+ **/
+bool passwordpolicy_check_candidate(const char *username, Oid roleid, const char *password,
+                                    PasswordPolicyProfile *profile, PasswordPolicyRejection *rejection)
 {
-  int i, pwdlen, letter_count, number_count, spc_char_count, upper_count, lower_count;
+  PasswordPolicyCandidate candidate;
 
-  pwdlen = strlen(password);
+  candidate.username = username;
+  candidate.password = password;
+  candidate.password_type = PASSWORD_TYPE_PLAINTEXT;
+  candidate.roleid = roleid;
+  candidate.profile = profile;
+  passwordpolicy_profiles_resolve(roleid, profile);
 
-  letter_count = 0;
-  number_count = 0;
-  spc_char_count = 0;
-  upper_count = 0;
-  lower_count = 0;
+  return passwordpolicy_check_rules_run(passwordpolicy_check_plaintext_rules,
+                                        lengthof(passwordpolicy_check_plaintext_rules), &candidate, rejection);
+}
 
-  for (i = 0; i < pwdlen; i++)
+/*
+ * @brief Run the checks of a password change without changing it, nor caching the result
+ * The history is only compared when the current user has the privileges of the role, the
+ * minimum password age is not checked. Nothing is written, it can run in parallel workers.
+ * @param username: role of the password, it may not exist
+ * @return true if the password is accepted, otherwise rejection is filled
+ **/
+bool passwordpolicy_check_validate(const char *username, const char *password, PasswordPolicyRejection *rejection)
+{
+  Oid roleid;
+  uint8 digest[PG_SHA256_DIGEST_LENGTH];
+  PasswordPolicyProfile profile;
+
+  roleid = get_role_oid(username, true);
+  if (!passwordpolicy_check_candidate(username, roleid, password, &profile, rejection))
+    return false;
+
+  MemSet(rejection, 0, sizeof(PasswordPolicyRejection));
+  if (profile.history_max_num_entries > 0 && OidIsValid(roleid) &&
+      has_privs_of_role(GetUserId(), roleid) &&
+      passwordpolicy_generate_sha256_hash(password, digest) &&
+      passwordpolicy_hash_history_exists(roleid, digest, profile.history_max_num_entries))
   {
-    /*
-     * isalpha() does not work for multibyte encodings but let's
-     * consider non-ASCII characters non-letters
-     */
-    if (isalpha((unsigned char)password[i]))
+    snprintf(rejection->message, sizeof(rejection->message),
+             "password cannot be one of the last %d password used.", profile.history_max_num_entries);
+    return false;
+  }
+  return true;
+}
+
+/*
+ * @brief Keyed digest of a candidate, for the rejections cache
+ * The settings of the checks are part of the digest, a rejection doesn't apply after they change.
+ **/
+void passwordpolicy_check_candidate_digest(const PasswordPolicyCandidate *candidate, const uint8 *key, uint8 *digest)
+{
+  char settings[64];
+  char *buffer, *p;
+  int settings_len;
+  size_t username_len, password_len, len;
+
+  settings_len = snprintf(settings, sizeof(settings), "%d %d %d %d", candidate->password_type,
+                          guc_passwordpolicy_enable_dict_check, guc_passwordpolicy_dictionary_engine,
+                          guc_passwordpolicy_min_entropy_bits);
+  username_len = strlen(candidate->username) + 1;
+  password_len = strlen(candidate->password) + 1;
+  len = username_len + password_len + settings_len + 1 + sizeof(PasswordPolicyProfile) +
+        strlen(PASSWORDPOLICY_CHECK_STR(guc_passwordpolicy_dictionary_path)) + 1 +
+        strlen(PASSWORDPOLICY_CHECK_STR(guc_passwordpolicy_banned_words_file)) + 1 +
+        strlen(PASSWORDPOLICY_CHECK_STR(guc_passwordpolicy_breached_file)) + 1;
+
+  /* sized once: a repalloc would leave a copy of the password behind */
+  buffer = palloc0(len);
+  p = buffer;
+  memcpy(p, candidate->username, username_len);
+  p += username_len;
+  memcpy(p, candidate->password, password_len);
+  p += password_len;
+  memcpy(p, settings, settings_len + 1);
+  p += settings_len + 1;
+  if (candidate->profile != NULL)
+    memcpy(p, candidate->profile, sizeof(PasswordPolicyProfile));
+  p += sizeof(PasswordPolicyProfile);
+  p += strlcpy(p, PASSWORDPOLICY_CHECK_STR(guc_passwordpolicy_dictionary_path), buffer + len - p) + 1;
+  p += strlcpy(p, PASSWORDPOLICY_CHECK_STR(guc_passwordpolicy_banned_words_file), buffer + len - p) + 1;
+  p += strlcpy(p, PASSWORDPOLICY_CHECK_STR(guc_passwordpolicy_breached_file), buffer + len - p) + 1;
+  Assert(p == buffer + len);
+
+  passwordpolicy_check_keyed_digest(key, PASSWORDPOLICY_REJECTION_KEY_LEN, (const uint8 *)buffer, len, digest);
+
+  explicit_bzero(buffer, len);
+  pfree(buffer);
+}
+
+/*
+ * @brief Report the error of a rejected password
+ **/
+void passwordpolicy_check_reject(const PasswordPolicyRejection *rejection)
+{
+  ereport(ERROR, (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+                  errmsg("%s", rejection->message),
+                  rejection->detail[0] != '\0' ? errdetail("%s", rejection->detail) : 0,
+                  rejection->detail_log[0] != '\0' ? errdetail_log("%s", rejection->detail_log) : 0));
+  pg_unreachable();
+}
+
+/*
+ * @brief Fill the message of a rejection
+ * @return false, the result of a failed rule
+ **/
+bool passwordpolicy_check_rejection(PasswordPolicyRejection *rejection, const char *fmt, ...)
+{
+  va_list args;
+
+  va_start(args, fmt);
+  vsnprintf(rejection->message, sizeof(rejection->message), fmt, args);
+  va_end(args);
+  return false;
+}
+
+/*
+ * @brief Run the rules in order, the first failed rule rejects the password
+ * A rejection is cached, the same candidate is rejected again without running the rules.
+ **/
+void passwordpolicy_check_rules(const PasswordPolicyRule *rules, int num, const PasswordPolicyCandidate *candidate)
+{
+  const uint8 *key;
+  uint8 digest[PG_SHA256_DIGEST_LENGTH];
+  PasswordPolicyRejection rejection;
+
+  key = passwordpolicy_rejections_key();
+  if (key != NULL)
+  {
+    passwordpolicy_check_candidate_digest(candidate, key, digest);
+    if (passwordpolicy_rejections_lookup(digest, &rejection))
     {
-      letter_count++;
-      if (isupper((unsigned char)password[i]))
-      {
-        upper_count++;
-      }
-      else if (islower((unsigned char)password[i]))
-      {
-        lower_count++;
-      }
+      ereport(DEBUG2, (errmsg("passwordpolicy: password of '%s' rejected from the cache", candidate->username)));
+      passwordpolicy_check_reject(&rejection);
+    }
+  }
+
+  if (!passwordpolicy_check_rules_run(rules, num, candidate, &rejection))
+  {
+    if (key != NULL)
+      passwordpolicy_rejections_add(digest, &rejection);
+    passwordpolicy_check_reject(&rejection);
+  }
+}
+
+/*
+ * @brief Run the rules in order until the first failed one, timing every rule
+ * @return false if a rule rejected the password, rejection is filled
+ **/
+bool passwordpolicy_check_rules_run(const PasswordPolicyRule *rules, int num, const PasswordPolicyCandidate *candidate,
+                                    PasswordPolicyRejection *rejection)
+{
+  int i;
+  bool passed;
+  instr_time start, duration;
+
+  for (i = 0; i < num; i++)
+  {
+    MemSet(rejection, 0, sizeof(PasswordPolicyRejection));
+    INSTR_TIME_SET_CURRENT(start);
+    passed = rules[i].check(candidate, rejection);
+    INSTR_TIME_SET_CURRENT(duration);
+    INSTR_TIME_SUBTRACT(duration, start);
+    ereport(DEBUG2, (errmsg("passwordpolicy: rule '%s' %s in %.3f ms", rules[i].name,
+                            passed ? "passed" : "rejected the password", INSTR_TIME_GET_MILLISEC(duration))));
+    if (!passed)
+      return false;
+  }
+  return true;
+}
+
+/*
+ * @brief The password is not in the breached passwords list
+ **/
+bool passwordpolicy_check_rule_breached(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection)
+{
+  if (passwordpolicy_breached_check(candidate->password))
+    return passwordpolicy_check_rejection(rejection, "password appears in a list of breached passwords.");
+  return true;
+}
+
+/*
+ * @brief Number of characters of each class and banned words, in a single pass
+ **/
+bool passwordpolicy_check_rule_composition(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection)
+{
+  int i, j, len, clen, counts[PASSWORDPOLICY_CHAR_MARK + 1];
+  uint32 banned_state = 0;
+  const PasswordPolicyBanned *banned;
+  const PasswordPolicyProfile *profile = candidate->profile;
+  const char *password = candidate->password;
+  const char *utf8;
+
+  /*
+   * classified as Unicode characters, whatever the database encoding. SQL_ASCII has no encoding
+   * to convert from, its bytes would be verified as UTF-8 and a Latin-1 password rejected.
+   */
+  len = strlen(password);
+  if (GetDatabaseEncoding() == PG_SQL_ASCII)
+    utf8 = password;
+  else
+    utf8 = pg_server_to_any(password, len, PG_UTF8);
+  if (utf8 != password)
+    len = strlen(utf8);
+
+  MemSet(counts, 0, sizeof(counts));
+
+  /* banned words are searched in the same pass */
+  banned = passwordpolicy_banned_acquire();
+
+  for (i = 0; i < len; i += clen)
+  {
+    if (len - i >= 16 && passwordpolicy_unicode_ascii16(utf8 + i))
+    {
+      /* fast path, 16 ASCII characters */
+      clen = 16;
+      for (j = i; j < i + clen; j++)
+        counts[passwordpolicy_unicode_ascii[(unsigned char)utf8[j]]]++;
     }
-    else if (isdigit((unsigned char)password[i]))
+    else if (!IS_HIGHBIT_SET(utf8[i]))
     {
-      number_count++;
+      clen = 1;
+      counts[passwordpolicy_unicode_ascii[(unsigned char)utf8[i]]]++;
     }
     else
     {
-      spc_char_count++;
+      clen = pg_utf_mblen((const unsigned char *)utf8 + i);
+      if (clen <= len - i && pg_utf8_islegal((const unsigned char *)utf8 + i, clen))
+        counts[passwordpolicy_unicode_class(utf8_to_unicode((const unsigned char *)utf8 + i))]++;
+      else
+      {
+        /* not UTF-8 in a SQL_ASCII database */
+        clen = 1;
+        counts[PASSWORDPOLICY_CHAR_SPECIAL]++;
+      }
     }
-  }
 
-  if (number_count < guc_passwordpolicy_min_number_char)
-  {
-    ereport(ERROR,
-            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-             errmsg("password must contain at least %d numeric characters.",
-                    guc_passwordpolicy_min_number_char)));
+    if (banned != NULL)
+    {
+      for (j = i; j < i + clen && !(banned_state & PASSWORDPOLICY_BANNED_MATCH); j++)
+        banned_state = passwordpolicy_banned_next(banned, banned_state, (unsigned char)utf8[j]);
+    }
   }
 
-  if (spc_char_count < guc_passwordpolicy_min_spc_char)
+  if (banned != NULL)
+    passwordpolicy_banned_release();
+  if (utf8 != password)
   {
-    ereport(ERROR,
-            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-             errmsg("password must contain at least %d special characters.",
-                    guc_passwordpolicy_min_spc_char)));
+    explicit_bzero((char *)utf8, len);
+    pfree((char *)utf8);
   }
 
-  if (upper_count < guc_passwordpolicy_min_upper_char)
+  if (counts[PASSWORDPOLICY_CHAR_DIGIT] < profile->min_number_char)
+    return passwordpolicy_check_rejection(rejection, "password must contain at least %d numeric characters.",
+                                          profile->min_number_char);
+
+  if (counts[PASSWORDPOLICY_CHAR_SPECIAL] < profile->min_spc_char)
+    return passwordpolicy_check_rejection(rejection, "password must contain at least %d special characters.",
+                                          profile->min_spc_char);
+
+  if (counts[PASSWORDPOLICY_CHAR_UPPER] < profile->min_upper_char)
+    return passwordpolicy_check_rejection(rejection, "password must contain at least %d upper case letters.",
+                                          profile->min_upper_char);
+
+  if (counts[PASSWORDPOLICY_CHAR_LOWER] < profile->min_lower_char)
+    return passwordpolicy_check_rejection(rejection, "password must contain at least %d lower case letters.",
+                                          profile->min_lower_char);
+
+  if (banned_state & PASSWORDPOLICY_BANNED_MATCH)
+    return passwordpolicy_check_rejection(rejection, "password cannot contain a banned word.");
+
+  return true;
+}
+
+/*
+ * @brief The password is not easily cracked, with cracklib or the native dictionary
+ **/
+bool passwordpolicy_check_rule_dictionary(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection)
+{
+  const char *reason;
+
+  if (!guc_passwordpolicy_enable_dict_check)
+    return true;
+
+  if ((reason = passwordpolicy_dictionary_check(candidate->password)))
   {
-    ereport(ERROR,
-            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-             errmsg("password must contain at least %d upper case letters.",
-                    guc_passwordpolicy_min_upper_char)));
+    snprintf(rejection->detail_log, sizeof(rejection->detail_log), "dictionary diagnostic: %s", reason);
+    return passwordpolicy_check_rejection(rejection, "password is easily cracked.");
   }
+  return true;
+}
 
-  if (lower_count < guc_passwordpolicy_min_lower_char)
+/*
+ * @brief The estimated strength of the password is at least password_policy.min_entropy_bits
+ **/
+bool passwordpolicy_check_rule_entropy(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection)
+{
+  PasswordPolicyEntropy estimate;
+  struct pg_tm tm;
+  fsec_t fsec;
+
+  if (guc_passwordpolicy_min_entropy_bits == 0)
+    return true;
+
+  /* dates near the current year are the first ones guessed */
+  if (timestamp2tm(GetCurrentTimestamp(), NULL, &tm, &fsec, NULL, NULL) != 0)
+    tm.tm_year = 2024;
+  passwordpolicy_entropy_estimate(candidate->password, tm.tm_year, &estimate);
+  if (estimate.bits < guc_passwordpolicy_min_entropy_bits)
   {
-    ereport(ERROR,
-            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-             errmsg("password must contain at least %d lower case letters.",
-                    guc_passwordpolicy_min_lower_char)));
+    snprintf(rejection->detail, sizeof(rejection->detail),
+             "password contains %s, estimated strength %.0f bits, required %d bits.",
+             passwordpolicy_entropy_pattern_name(estimate.pattern), estimate.bits,
+             guc_passwordpolicy_min_entropy_bits);
+    return passwordpolicy_check_rejection(rejection, "password is too predictable.");
   }
+  return true;
 }
 
-char *passwordpolicy_generate_sha256_hash(const char *input)
+/*
+ * @brief Minimum length of the password, in characters
+ **/
+bool passwordpolicy_check_rule_length(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection)
+{
+  if (pg_mbstrlen(candidate->password) < candidate->profile->min_length)
+    return passwordpolicy_check_rejection(rejection, "password is too short.");
+  return true;
+}
+
+/*
+ * @brief The password doesn't contain the user name
+ **/
+bool passwordpolicy_check_rule_username(const PasswordPolicyCandidate *candidate, PasswordPolicyRejection *rejection)
+{
+  if (strstr(candidate->password, candidate->username))
+    return passwordpolicy_check_rejection(rejection, "password cannot contain user name.");
+  return true;
+}
+
+/*
+ * @brief The encrypted password is not the user name, the only check possible without the plain password
+ **/
+bool passwordpolicy_check_rule_username_encrypted(const PasswordPolicyCandidate *candidate,
+                                                  PasswordPolicyRejection *rejection)
+{
+#if (PG_VERSION_NUM >= 150000)
+  const char *logdetail = NULL;
+#else
+  char *logdetail = NULL;
+#endif
+
+  if (plain_crypt_verify(candidate->username, candidate->password, candidate->username, &logdetail) == STATUS_OK)
+    return passwordpolicy_check_rejection(rejection, "password cannot contain user name");
+  return true;
+}
+
+/*
+ * @brief Keyed SHA-256 digest of the password, as stored in the password history
+ * @return true if the digest was generated
+ **/
+bool passwordpolicy_generate_sha256_hash(const char *input, uint8 *digest)
 {
-  uint8 hash[SHA256_DIGEST_LENGTH];
-  char *input_hash;
 #if PG_VERSION_NUM >= 140000
 #define KEY_SHA256 "passwordpolicy"
 #define KEY_SHA256_LEN strlen(KEY_SHA256)
-  pg_hmac_ctx *ctx;
+  return passwordpolicy_check_keyed_digest((const uint8 *)KEY_SHA256, KEY_SHA256_LEN, (const uint8 *)input,
+                                           strlen(input), digest);
 #else
-  SHA256_CTX ctx;
+  /* the history of the older versions isn't keyed */
+  return passwordpolicy_check_keyed_digest(NULL, 0, (const uint8 *)input, strlen(input), digest);
 #endif
+}
 
-  input_hash = palloc0(mul_size(sizeof(char), PG_SHA256_DIGEST_STRING_LENGTH));
+/*
+ * @brief HMAC SHA-256 of the input, SHA-256 of the key and the input before PostgreSQL 14
+ * @return true if the digest was generated
+ **/
+bool passwordpolicy_check_keyed_digest(const uint8 *key, size_t keylen, const uint8 *input, size_t len, uint8 *digest)
+{
+#if PG_VERSION_NUM >= 140000
+  MemoryContext oldcontext;
+  ResourceOwner oldowner;
+#else
+  SHA256_CTX ctx;
+#endif
 
 #if PG_VERSION_NUM >= 140000
-  if ((ctx = pg_hmac_create(PG_SHA256)) == NULL)
+  if (passwordpolicy_check_hmac == NULL)
   {
-    ereport(ERROR, (errmsg("error creating hmac sha256")));
-    return NULL;
+    oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+    oldowner = CurrentResourceOwner;
+    if (passwordpolicy_check_hmac_owner == NULL)
+      passwordpolicy_check_hmac_owner = ResourceOwnerCreate(NULL, "passwordpolicy hmac");
+    CurrentResourceOwner = passwordpolicy_check_hmac_owner;
+    passwordpolicy_check_hmac = pg_hmac_create(PG_SHA256);
+    CurrentResourceOwner = oldowner;
+    MemoryContextSwitchTo(oldcontext);
+
+    if (passwordpolicy_check_hmac == NULL)
+    {
+      ereport(ERROR, (errmsg("error creating hmac sha256")));
+      return false;
+    }
   }
 
-  if (pg_hmac_init(ctx, (const uint8 *)KEY_SHA256, KEY_SHA256_LEN) != 0 ||
-      pg_hmac_update(ctx, (const uint8 *)input, strlen(input)) != 0 ||
-      pg_hmac_final(ctx, hash, sizeof(hash)) != 0)
+  /* init resets the context, it can be reused after final */
+  if (pg_hmac_init(passwordpolicy_check_hmac, key, keylen) != 0 ||
+      pg_hmac_update(passwordpolicy_check_hmac, input, len) != 0 ||
+      pg_hmac_final(passwordpolicy_check_hmac, digest, PG_SHA256_DIGEST_LENGTH) != 0)
   {
-    pg_hmac_free(ctx);
+    pg_hmac_free(passwordpolicy_check_hmac);
+    passwordpolicy_check_hmac = NULL;
     ereport(ERROR, (errmsg("error generating sha256")));
-    return NULL;
+    return false;
   }
-
-  pg_hmac_free(ctx);
 #else
   // Initialize the SHA-256 context
   pg_sha256_init(&ctx);
 
-  // Update the context with the input data
-  pg_sha256_update(&ctx, (const uint8 *)input, strlen(input));
+  // Update the context with the key and the input data
+  if (keylen > 0)
+    pg_sha256_update(&ctx, key, keylen);
+  pg_sha256_update(&ctx, input, len);
 
   // Finalize the hash calculation
-  pg_sha256_final(&ctx, hash);
+  pg_sha256_final(&ctx, digest);
 
 #endif
 
-  hex_encode((const char *)hash, SHA256_DIGEST_LENGTH, input_hash);
-  input_hash[PG_SHA256_DIGEST_STRING_LENGTH - 1] = '\0';
-  ereport(DEBUG3, (errmsg("passwordpolicy: password hash '%s'", input_hash)));
-
-  return input_hash;
-}
\ No newline at end of file
+  return true;
+}
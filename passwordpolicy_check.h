@@ -15,8 +15,17 @@
 #include <postgres.h>
 #include <libpq/crypt.h>
 
+#include "passwordpolicy_rejections.h"
+#include "passwordpolicy_vars.h"
+
+extern PGDLLEXPORT void passwordpolicy_check_bypass(const char *username);
+extern PGDLLEXPORT bool passwordpolicy_check_candidate(const char *username, Oid roleid, const char *password,
+                                                       PasswordPolicyProfile *profile, PasswordPolicyRejection *rejection);
 extern PGDLLEXPORT void passwordpolicy_check_password(const char *username, const char *shadow_pass,
                                                       PasswordType password_type, Datum validuntil_time,
                                                       bool validuntil_null);
+extern PGDLLEXPORT bool passwordpolicy_check_validate(const char *username, const char *password,
+                                                      PasswordPolicyRejection *rejection);
+extern PGDLLEXPORT bool passwordpolicy_generate_sha256_hash(const char *input, uint8 *digest);
 
 #endif
@@ -0,0 +1,275 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_dictionary.c
+ *      Dictionary check of the passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_dictionary.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utils/memutils.h>
+
+#ifdef USE_CRACKLIB
+#include <crack.h>
+#include <packer.h>
+#endif
+
+#include "passwordpolicy_dictionary_format.h"
+#include "passwordpolicy_vars.h"
+
+/*
+ * The native dictionary is built offline by passwordpolicy_dictionary_build and mapped
+ * read-only by every backend checking a password, the pages are shared through the page
+ * cache. The mapping is kept until password_policy.dictionary_path names another file or
+ * the file is replaced.
+ */
+typedef struct PasswordPolicyDictionaryMap
+{
+  char *path;
+  dev_t dev;
+  ino_t ino;
+  time_t mtime;
+  size_t size;
+  const PasswordPolicyDictionaryHeader *header;
+  const uint32 *pilots;
+  const uint32 *fingerprints;
+} PasswordPolicyDictionaryMap;
+
+static PasswordPolicyDictionaryMap passwordpolicy_dictionary_map = {NULL, 0, 0, 0, 0, NULL, NULL, NULL};
+
+/* Private functions forward declaration */
+const char *passwordpolicy_dictionary_native_check(const char *password);
+void passwordpolicy_dictionary_map_open(const char *path);
+void passwordpolicy_dictionary_map_close(void);
+
+#ifdef USE_CRACKLIB
+/*
+ * FascistCheck() opens the dictionary and reads its index on every call. The dictionary is
+ * opened once per backend instead, and opened again when password_policy.dictionary_path
+ * changes or when the files are replaced by a rebuilt dictionary (packer writing to a new
+ * file renamed over the old one). The new dictionary is opened before the old one is
+ * closed: a check uses either the old or the new dictionary, never a partial one.
+ */
+typedef struct PasswordPolicyDictionary
+{
+  char *path;
+  ino_t pwd_ino;
+  time_t pwd_mtime;
+  ino_t pwi_ino;
+  time_t pwi_mtime;
+  PWDICT *pwp;
+} PasswordPolicyDictionary;
+
+static PasswordPolicyDictionary passwordpolicy_dictionary = {NULL, 0, 0, 0, 0, NULL};
+
+PWDICT *passwordpolicy_dictionary_open(const char *path);
+#endif
+
+/*
+ * @brief Check the password against the dictionary of password_policy.dictionary_path
+ * @return the reason when the password is easily cracked, NULL otherwise
+ **/
+const char *passwordpolicy_dictionary_check(const char *password)
+{
+#ifdef USE_CRACKLIB
+  char *instring;
+  const char *reason;
+  PWDICT *pwp;
+#endif
+
+  if (guc_passwordpolicy_dictionary_path == NULL || guc_passwordpolicy_dictionary_path[0] == '\0')
+    return NULL;
+
+  if (guc_passwordpolicy_dictionary_engine == PASSWORDPOLICY_DICTIONARY_NATIVE)
+    return passwordpolicy_dictionary_native_check(password);
+
+#ifdef USE_CRACKLIB
+  pwp = passwordpolicy_dictionary_open(guc_passwordpolicy_dictionary_path);
+
+  /* FascistLook() changes its input in some cracklib versions */
+  instring = pstrdup(password);
+  reason = FascistLook(pwp, instring);
+  pfree(instring);
+  return reason;
+#else
+  return NULL;
+#endif
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Look up the normalized password in the native dictionary
+ **/
+const char *passwordpolicy_dictionary_native_check(const char *password)
+{
+  size_t len = strlen(password);
+  char *word;
+  bool found;
+
+  passwordpolicy_dictionary_map_open(guc_passwordpolicy_dictionary_path);
+
+  word = palloc(len + 1);
+  len = passwordpolicy_dictionary_normalize(password, len, word);
+  found = passwordpolicy_dictionary_contains(word, len, passwordpolicy_dictionary_map.header,
+                                             passwordpolicy_dictionary_map.pilots,
+                                             passwordpolicy_dictionary_map.fingerprints);
+  pfree(word);
+
+  return found ? "it is based on a dictionary word" : NULL;
+}
+
+/*
+ * @brief Map the native dictionary file, unless it's already mapped
+ **/
+void passwordpolicy_dictionary_map_open(const char *path)
+{
+  int fd;
+  struct stat st;
+  void *addr;
+  const PasswordPolicyDictionaryHeader *header;
+
+  fd = open(path, O_RDONLY | PG_BINARY, 0);
+  if (fd < 0)
+  {
+    passwordpolicy_dictionary_map_close();
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not open dictionary \"%s\": %m", path)));
+  }
+  if (fstat(fd, &st) < 0)
+  {
+    close(fd);
+    passwordpolicy_dictionary_map_close();
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not stat dictionary \"%s\": %m", path)));
+  }
+
+  if (passwordpolicy_dictionary_map.header != NULL &&
+      strcmp(passwordpolicy_dictionary_map.path, path) == 0 &&
+      passwordpolicy_dictionary_map.dev == st.st_dev &&
+      passwordpolicy_dictionary_map.ino == st.st_ino &&
+      passwordpolicy_dictionary_map.mtime == st.st_mtime &&
+      passwordpolicy_dictionary_map.size == (size_t)st.st_size)
+  {
+    close(fd);
+    return;
+  }
+
+  passwordpolicy_dictionary_map_close();
+
+  if ((size_t)st.st_size < sizeof(PasswordPolicyDictionaryHeader))
+  {
+    close(fd);
+    ereport(ERROR, (errcode(ERRCODE_DATA_CORRUPTED),
+                    errmsg("passwordpolicy: invalid dictionary \"%s\"", path)));
+  }
+
+  addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED)
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not map dictionary \"%s\": %m", path)));
+
+  header = (const PasswordPolicyDictionaryHeader *)addr;
+  if (header->magic != PASSWORDPOLICY_DICTIONARY_MAGIC ||
+      header->version != PASSWORDPOLICY_DICTIONARY_VERSION ||
+      header->bucket_count == 0 ||
+      sizeof(PasswordPolicyDictionaryHeader) + ((uint64)header->bucket_count + header->count) * sizeof(uint32) != (uint64)st.st_size)
+  {
+    munmap(addr, st.st_size);
+    ereport(ERROR, (errcode(ERRCODE_DATA_CORRUPTED),
+                    errmsg("passwordpolicy: invalid dictionary \"%s\"", path),
+                    errhint("build the file again with passwordpolicy_dictionary_build")));
+  }
+
+  /* random lookups, don't read ahead */
+  (void)madvise(addr, st.st_size, MADV_RANDOM);
+
+  passwordpolicy_dictionary_map.path = MemoryContextStrdup(TopMemoryContext, path);
+  passwordpolicy_dictionary_map.dev = st.st_dev;
+  passwordpolicy_dictionary_map.ino = st.st_ino;
+  passwordpolicy_dictionary_map.mtime = st.st_mtime;
+  passwordpolicy_dictionary_map.size = st.st_size;
+  passwordpolicy_dictionary_map.header = header;
+  passwordpolicy_dictionary_map.pilots = (const uint32 *)((const char *)addr + sizeof(PasswordPolicyDictionaryHeader));
+  passwordpolicy_dictionary_map.fingerprints = passwordpolicy_dictionary_map.pilots + header->bucket_count;
+
+  ereport(DEBUG1, (errmsg("passwordpolicy: dictionary \"%s\" mapped, %u words", path, header->count)));
+}
+
+/*
+ * @brief Unmap the native dictionary file
+ **/
+void passwordpolicy_dictionary_map_close(void)
+{
+  if (passwordpolicy_dictionary_map.header != NULL)
+    munmap((void *)passwordpolicy_dictionary_map.header, passwordpolicy_dictionary_map.size);
+  if (passwordpolicy_dictionary_map.path != NULL)
+    pfree(passwordpolicy_dictionary_map.path);
+  MemSet(&passwordpolicy_dictionary_map, 0, sizeof(passwordpolicy_dictionary_map));
+}
+
+#ifdef USE_CRACKLIB
+/*
+ * @brief Dictionary handle of the backend, opened again if the dictionary changed
+ **/
+PWDICT *passwordpolicy_dictionary_open(const char *path)
+{
+  char filename[MAXPGPATH];
+  struct stat pwd_st, pwi_st;
+  PWDICT *pwp;
+
+  snprintf(filename, sizeof(filename), "%s.pwd", path);
+  if (stat(filename, &pwd_st) < 0)
+    MemSet(&pwd_st, 0, sizeof(pwd_st));
+  snprintf(filename, sizeof(filename), "%s.pwi", path);
+  if (stat(filename, &pwi_st) < 0)
+    MemSet(&pwi_st, 0, sizeof(pwi_st));
+
+  if (passwordpolicy_dictionary.pwp != NULL &&
+      strcmp(passwordpolicy_dictionary.path, path) == 0 &&
+      passwordpolicy_dictionary.pwd_ino == pwd_st.st_ino &&
+      passwordpolicy_dictionary.pwd_mtime == pwd_st.st_mtime &&
+      passwordpolicy_dictionary.pwi_ino == pwi_st.st_ino &&
+      passwordpolicy_dictionary.pwi_mtime == pwi_st.st_mtime)
+    return passwordpolicy_dictionary.pwp;
+
+  pwp = PWOpen(path, "r");
+  if (pwp == NULL)
+  {
+    /* a dictionary being rebuilt, keep the previous one of the same path */
+    if (passwordpolicy_dictionary.pwp != NULL && strcmp(passwordpolicy_dictionary.path, path) == 0)
+    {
+      ereport(WARNING, (errmsg("passwordpolicy: could not open dictionary \"%s\", using the previous one", path)));
+      return passwordpolicy_dictionary.pwp;
+    }
+    ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not open dictionary \"%s\": %m", path)));
+  }
+
+  if (passwordpolicy_dictionary.pwp != NULL)
+    PWClose(passwordpolicy_dictionary.pwp);
+  if (passwordpolicy_dictionary.path != NULL)
+    pfree(passwordpolicy_dictionary.path);
+
+  passwordpolicy_dictionary.path = MemoryContextStrdup(TopMemoryContext, path);
+  passwordpolicy_dictionary.pwd_ino = pwd_st.st_ino;
+  passwordpolicy_dictionary.pwd_mtime = pwd_st.st_mtime;
+  passwordpolicy_dictionary.pwi_ino = pwi_st.st_ino;
+  passwordpolicy_dictionary.pwi_mtime = pwi_st.st_mtime;
+  passwordpolicy_dictionary.pwp = pwp;
+
+  ereport(DEBUG1, (errmsg("passwordpolicy: dictionary \"%s\" opened", path)));
+  return pwp;
+}
+#endif
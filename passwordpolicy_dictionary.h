@@ -0,0 +1,19 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_dictionary.h
+ *      Dictionary check of the passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_DICTIONARY_H_
+#define _PASSWORDPOLICY_DICTIONARY_H_
+
+#include <postgres.h>
+
+extern PGDLLEXPORT const char *passwordpolicy_dictionary_check(const char *password);
+
+#endif
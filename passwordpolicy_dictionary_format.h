@@ -0,0 +1,167 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_dictionary_format.h
+ *      File format of the native dictionary
+ *
+ * Shared by the extension, the offline builder and the benchmark, it doesn't
+ * depend on the PostgreSQL headers.
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_DICTIONARY_FORMAT_H_
+#define _PASSWORDPOLICY_DICTIONARY_FORMAT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The words are normalized (see passwordpolicy_dictionary_normalize) and indexed by a minimal
+ * perfect hash function, hash and displace with a pilot per bucket of about 4 words as in
+ * PTHash. The file is a header followed by:
+ *  - bucket_count pilots, the pilot of a bucket moves its words to free slots
+ *  - count fingerprints, one per slot, the low 32 bits of the hash of the word in the slot
+ * A word is in the dictionary when the fingerprint of its slot matches, a word not in the
+ * dictionary matches with a probability of 1 in 2^32. About 5 bytes per word.
+ * Numbers are written in the byte order of the machine building the file, magic detects a
+ * file built with the other order.
+ */
+#define PASSWORDPOLICY_DICTIONARY_MAGIC UINT64_C(0x5050444943544e41) /* "PPDICTNA" */
+#define PASSWORDPOLICY_DICTIONARY_VERSION 1
+/* shorter normalized words aren't indexed, nor looked up */
+#define PASSWORDPOLICY_DICTIONARY_MIN_WORD 4
+
+typedef struct PasswordPolicyDictionaryHeader
+{
+  uint64_t magic;
+  uint32_t version;
+  uint32_t padding;
+  uint64_t seed;
+  uint32_t count;                /* words, and slots */
+  uint32_t bucket_count;
+} PasswordPolicyDictionaryHeader;
+
+/*
+ * @brief Normalize a word: lower case, without trailing digits and symbols, leetspeak decoded
+ * "P@ssw0rd123!" becomes "password". Bytes outside of ASCII are kept as they are.
+ * @return length of the normalized word written to out, which must hold len + 1 bytes
+ **/
+static inline size_t passwordpolicy_dictionary_normalize(const char *in, size_t len, char *out)
+{
+  size_t i;
+  unsigned char c;
+
+  for (i = 0; i < len; i++)
+  {
+    c = (unsigned char)in[i];
+    out[i] = (char)((c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c);
+  }
+
+  /* "word2024!" */
+  while (len > 0)
+  {
+    c = (unsigned char)out[len - 1];
+    if (c >= 0x80 || (c >= 'a' && c <= 'z'))
+      break;
+    len--;
+  }
+
+  for (i = 0; i < len; i++)
+  {
+    switch (out[i])
+    {
+      case '0': out[i] = 'o'; break;
+      case '1': case '!': out[i] = 'i'; break;
+      case '3': out[i] = 'e'; break;
+      case '4': case '@': out[i] = 'a'; break;
+      case '5': case '$': out[i] = 's'; break;
+      case '7': case '+': out[i] = 't'; break;
+      case '8': out[i] = 'b'; break;
+      case '9': out[i] = 'g'; break;
+      case '|': out[i] = 'l'; break;
+    }
+  }
+  out[len] = '\0';
+  return len;
+}
+
+static inline uint64_t passwordpolicy_dictionary_mix64(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= UINT64_C(0xff51afd7ed558ccd);
+  h ^= h >> 33;
+  h *= UINT64_C(0xc4ceb9fe1a85ec53);
+  h ^= h >> 33;
+  return h;
+}
+
+static inline uint64_t passwordpolicy_dictionary_mulhi(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+  return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#else
+  uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+  uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+  uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+  uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+
+  return (hi_lo >> 32) + (cross >> 32) + hi_hi;
+#endif
+}
+
+/*
+ * @brief Hash of a normalized word, FNV-1a with a final mix
+ **/
+static inline uint64_t passwordpolicy_dictionary_hash(const char *word, size_t len, uint64_t seed)
+{
+  uint64_t h = UINT64_C(0xcbf29ce484222325) ^ seed;
+  size_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    h ^= (unsigned char)word[i];
+    h *= UINT64_C(0x100000001b3);
+  }
+  return passwordpolicy_dictionary_mix64(h);
+}
+
+/*
+ * @brief Bucket of a hash, the buckets keep the order of the hashes
+ **/
+static inline uint32_t passwordpolicy_dictionary_bucket(uint64_t hash, const PasswordPolicyDictionaryHeader *header)
+{
+  return (uint32_t)passwordpolicy_dictionary_mulhi(hash, header->bucket_count);
+}
+
+/*
+ * @brief Slot of a hash moved by the pilot of its bucket
+ **/
+static inline uint32_t passwordpolicy_dictionary_slot(uint64_t hash, uint32_t pilot,
+                                                      const PasswordPolicyDictionaryHeader *header)
+{
+  uint64_t h = passwordpolicy_dictionary_mix64(hash ^ passwordpolicy_dictionary_mix64((uint64_t)pilot + header->seed));
+
+  return (uint32_t)passwordpolicy_dictionary_mulhi(h, header->count);
+}
+
+/*
+ * @brief Check if a normalized word is in the dictionary
+ **/
+static inline bool passwordpolicy_dictionary_contains(const char *word, size_t len,
+                                                      const PasswordPolicyDictionaryHeader *header,
+                                                      const uint32_t *pilots, const uint32_t *fingerprints)
+{
+  uint64_t hash;
+
+  if (header->count == 0 || len < PASSWORDPOLICY_DICTIONARY_MIN_WORD)
+    return false;
+  hash = passwordpolicy_dictionary_hash(word, len, header->seed);
+  return fingerprints[passwordpolicy_dictionary_slot(hash, pilots[passwordpolicy_dictionary_bucket(hash, header)], header)] ==
+         (uint32_t)hash;
+}
+
+#endif
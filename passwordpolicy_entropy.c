@@ -0,0 +1,701 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_entropy.c
+ *      Strength estimate of the passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_entropy.h"
+
+#include <math.h>
+
+#include "passwordpolicy_entropy_table.h"
+
+/*
+ * Estimate of the guesses needed by an attacker, after zxcvbn (Wheeler, "zxcvbn: Low-Budget
+ * Password Strength Estimation"): the password is matched against common words, keyboard
+ * walks, sequences, repeats and dates, and the sequence of matches and bruteforce segments
+ * needing the fewest guesses is searched. The tables are static and the working memory is
+ * static too, an estimate doesn't allocate nor read any file.
+ */
+#define PASSWORDPOLICY_ENTROPY_MAX_LENGTH 64 /* longer passwords: the rest counts as bruteforce */
+#define PASSWORDPOLICY_ENTROPY_MAX_MATCHES 1024
+#define PASSWORDPOLICY_ENTROPY_BRUTEFORCE_CARDINALITY 10.0
+#define PASSWORDPOLICY_ENTROPY_MIN_GUESSES_GROWING_SEQUENCE 10000.0
+#define PASSWORDPOLICY_ENTROPY_MIN_SUBMATCH_SINGLE_CHAR 10.0
+#define PASSWORDPOLICY_ENTROPY_MIN_SUBMATCH_MULTI_CHAR 50.0
+#define PASSWORDPOLICY_ENTROPY_MIN_YEAR_SPACE 20
+#define PASSWORDPOLICY_ENTROPY_MIN_YEAR 1000
+#define PASSWORDPOLICY_ENTROPY_MAX_YEAR 2050
+
+typedef struct PasswordPolicyEntropyMatch
+{
+  int i;                                /* first character */
+  int j;                                /* last character */
+  PasswordPolicyEntropyPattern pattern;
+  double guesses;
+} PasswordPolicyEntropyMatch;
+
+typedef struct PasswordPolicyEntropyMatches
+{
+  PasswordPolicyEntropyMatch *items;
+  int count;
+  int capacity;
+} PasswordPolicyEntropyMatches;
+
+/* best sequence of l matches ending at a character */
+typedef struct PasswordPolicyEntropyState
+{
+  double pi;                            /* product of the guesses of the matches */
+  double g;                             /* guesses of the sequence */
+  int16 i;                              /* first character of the last match */
+  uint8 pattern;                        /* pattern of the last match */
+  bool valid;
+} PasswordPolicyEntropyState;
+
+static PasswordPolicyEntropyMatch passwordpolicy_entropy_match_items[PASSWORDPOLICY_ENTROPY_MAX_MATCHES];
+static PasswordPolicyEntropyState passwordpolicy_entropy_states[PASSWORDPOLICY_ENTROPY_MAX_LENGTH][PASSWORDPOLICY_ENTROPY_MAX_LENGTH + 1];
+
+/* Private functions forward declaration */
+void passwordpolicy_entropy_add(PasswordPolicyEntropyMatches *matches, int i, int j,
+                                PasswordPolicyEntropyPattern pattern, double guesses);
+double passwordpolicy_entropy_binomial(int n, int k);
+double passwordpolicy_entropy_bruteforce(int length);
+void passwordpolicy_entropy_dates(const char *pw, int n, int reference_year, PasswordPolicyEntropyMatches *matches);
+void passwordpolicy_entropy_dictionary(const char *pw, int n, PasswordPolicyEntropyMatches *matches);
+int passwordpolicy_entropy_lookup(const char *word, int len);
+void passwordpolicy_entropy_match(const char *pw, int n, int reference_year, PasswordPolicyEntropyMatches *matches);
+int passwordpolicy_entropy_number(const char *s, int len);
+double passwordpolicy_entropy_optimal(int n, const PasswordPolicyEntropyMatches *matches,
+                                      PasswordPolicyEntropyPattern *pattern);
+void passwordpolicy_entropy_repeats(const char *pw, int n, int reference_year, PasswordPolicyEntropyMatches *matches);
+void passwordpolicy_entropy_sequences(const char *pw, int n, PasswordPolicyEntropyMatches *matches);
+void passwordpolicy_entropy_spatial(const char *pw, int n, const char *graph, int directions, bool shift,
+                                    double keys, double degree, PasswordPolicyEntropyMatches *matches);
+void passwordpolicy_entropy_update(const double *factorial, const double *growing, int k, int i, int l,
+                                   PasswordPolicyEntropyPattern pattern, double guesses);
+double passwordpolicy_entropy_uppercase_variations(const char *pw, int i, int j);
+double passwordpolicy_entropy_whole(const char *pw, int n, int reference_year);
+int passwordpolicy_entropy_year_guesses(int year, int reference_year);
+
+/*
+ * @brief Estimate the entropy of a password, and the pattern making it weak
+ * @param reference_year: current year, dates near it are easier to guess
+ **/
+void passwordpolicy_entropy_estimate(const char *password, int reference_year, PasswordPolicyEntropy *estimate)
+{
+  int len = strlen(password);
+  int n = Min(len, PASSWORDPOLICY_ENTROPY_MAX_LENGTH);
+  double guesses;
+  PasswordPolicyEntropyMatches matches;
+
+  matches.items = passwordpolicy_entropy_match_items;
+  matches.count = 0;
+  matches.capacity = PASSWORDPOLICY_ENTROPY_MAX_MATCHES;
+
+  if (n == 0)
+  {
+    estimate->bits = 0;
+    estimate->pattern = PASSWORDPOLICY_ENTROPY_BRUTEFORCE;
+    return;
+  }
+
+  passwordpolicy_entropy_match(password, n, reference_year, &matches);
+  passwordpolicy_entropy_repeats(password, n, reference_year, &matches);
+
+  guesses = passwordpolicy_entropy_optimal(n, &matches, &estimate->pattern);
+  estimate->bits = log2(guesses) + (len - n) * log2(PASSWORDPOLICY_ENTROPY_BRUTEFORCE_CARDINALITY);
+}
+
+/*
+ * @brief Pattern name for the messages
+ **/
+const char *passwordpolicy_entropy_pattern_name(PasswordPolicyEntropyPattern pattern)
+{
+  switch (pattern)
+  {
+  case PASSWORDPOLICY_ENTROPY_DICTIONARY:
+    return "a common word or password";
+  case PASSWORDPOLICY_ENTROPY_SPATIAL:
+    return "a keyboard pattern";
+  case PASSWORDPOLICY_ENTROPY_SEQUENCE:
+    return "a sequence of characters";
+  case PASSWORDPOLICY_ENTROPY_REPEAT:
+    return "repeated characters";
+  case PASSWORDPOLICY_ENTROPY_DATE:
+    return "a date";
+  default:
+    return "too few characters";
+  }
+}
+
+/* PRIVATE FUNCTIONS */
+
+void passwordpolicy_entropy_add(PasswordPolicyEntropyMatches *matches, int i, int j,
+                                PasswordPolicyEntropyPattern pattern, double guesses)
+{
+  if (matches->count == matches->capacity)
+    return;
+  matches->items[matches->count].i = i;
+  matches->items[matches->count].j = j;
+  matches->items[matches->count].pattern = pattern;
+  matches->items[matches->count].guesses = guesses;
+  matches->count++;
+}
+
+double passwordpolicy_entropy_binomial(int n, int k)
+{
+  double r = 1;
+  int d;
+
+  if (k > n)
+    return 0;
+  for (d = 1; d <= k; d++)
+    r = r * (n - k + d) / d;
+  return r;
+}
+
+double passwordpolicy_entropy_bruteforce(int length)
+{
+  double guesses = pow(PASSWORDPOLICY_ENTROPY_BRUTEFORCE_CARDINALITY, length);
+
+  /* a bruteforce segment is never cheaper than a match of the same length */
+  return length == 1 ? guesses + 1 : Max(guesses, PASSWORDPOLICY_ENTROPY_MIN_SUBMATCH_MULTI_CHAR) + 1;
+}
+
+/*
+ * @brief Value of len decimal digits
+ **/
+int passwordpolicy_entropy_number(const char *s, int len)
+{
+  int value = 0;
+
+  while (len-- > 0)
+    value = value * 10 + (*s++ - '0');
+  return value;
+}
+
+/*
+ * @brief Rank of a lower case word in the common words, 0 if it's not there
+ **/
+int passwordpolicy_entropy_lookup(const char *word, int len)
+{
+  int lo = 0, hi = lengthof(passwordpolicy_entropy_words) - 1, mid, cmp;
+  const char *entry;
+
+  while (lo <= hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    entry = passwordpolicy_entropy_words[mid].word;
+    cmp = strncmp(entry, word, len);
+    if (cmp == 0 && entry[len] != '\0')
+      cmp = 1;
+    if (cmp == 0)
+      return passwordpolicy_entropy_words[mid].rank;
+    if (cmp < 0)
+      lo = mid + 1;
+    else
+      hi = mid - 1;
+  }
+  return 0;
+}
+
+/*
+ * @brief Guesses of the case of a word: all lower, capitalized or all upper are tried first
+ **/
+double passwordpolicy_entropy_uppercase_variations(const char *pw, int i, int j)
+{
+  int k, upper = 0, lower = 0;
+  double variations = 0;
+
+  for (k = i; k <= j; k++)
+  {
+    if (pw[k] >= 'A' && pw[k] <= 'Z')
+      upper++;
+    else if (pw[k] >= 'a' && pw[k] <= 'z')
+      lower++;
+  }
+  if (upper == 0)
+    return 1;
+  if (lower == 0 || (upper == 1 && ((pw[i] >= 'A' && pw[i] <= 'Z') || (pw[j] >= 'A' && pw[j] <= 'Z'))))
+    return 2;
+  for (k = 1; k <= Min(upper, lower); k++)
+    variations += passwordpolicy_entropy_binomial(upper + lower, k);
+  return variations;
+}
+
+/*
+ * @brief Common words, as they are, reversed or with leetspeak substitutions
+ **/
+void passwordpolicy_entropy_dictionary(const char *pw, int n, PasswordPolicyEntropyMatches *matches)
+{
+  char lower[PASSWORDPOLICY_ENTROPY_MAX_LENGTH], leet[PASSWORDPOLICY_ENTROPY_MAX_LENGTH];
+  char reversed[PASSWORDPOLICY_ENTROPY_MAX_WORD];
+  int i, j, k, len, rank, subs[PASSWORDPOLICY_ENTROPY_MAX_LENGTH + 1];
+  double upper;
+
+  subs[0] = 0;
+  for (i = 0; i < n; i++)
+  {
+    lower[i] = pg_ascii_tolower((unsigned char)pw[i]);
+    switch (lower[i])
+    {
+    case '0': leet[i] = 'o'; break;
+    case '1': case '!': case '|': leet[i] = 'i'; break;
+    case '3': leet[i] = 'e'; break;
+    case '4': case '@': leet[i] = 'a'; break;
+    case '5': case '$': leet[i] = 's'; break;
+    case '7': case '+': leet[i] = 't'; break;
+    case '8': leet[i] = 'b'; break;
+    case '9': leet[i] = 'g'; break;
+    default: leet[i] = lower[i]; break;
+    }
+    subs[i + 1] = subs[i] + (leet[i] != lower[i] ? 1 : 0);
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = i + PASSWORDPOLICY_ENTROPY_MIN_WORD - 1; j < n && j - i < PASSWORDPOLICY_ENTROPY_MAX_WORD; j++)
+    {
+      len = j - i + 1;
+      upper = passwordpolicy_entropy_uppercase_variations(pw, i, j);
+
+      if ((rank = passwordpolicy_entropy_lookup(lower + i, len)) > 0)
+        passwordpolicy_entropy_add(matches, i, j, PASSWORDPOLICY_ENTROPY_DICTIONARY, rank * upper);
+
+      /* each substitution doubles the guesses, approximately */
+      if (subs[j + 1] > subs[i] && (rank = passwordpolicy_entropy_lookup(leet + i, len)) > 0)
+        passwordpolicy_entropy_add(matches, i, j, PASSWORDPOLICY_ENTROPY_DICTIONARY,
+                                   rank * upper * pow(2, subs[j + 1] - subs[i]));
+
+      for (k = 0; k < len; k++)
+        reversed[k] = lower[j - k];
+      if (memcmp(reversed, lower + i, len) != 0 && (rank = passwordpolicy_entropy_lookup(reversed, len)) > 0)
+        passwordpolicy_entropy_add(matches, i, j, PASSWORDPOLICY_ENTROPY_DICTIONARY, rank * upper * 2);
+    }
+  }
+}
+
+/*
+ * @brief Matches of all the patterns but the repeats
+ **/
+void passwordpolicy_entropy_match(const char *pw, int n, int reference_year, PasswordPolicyEntropyMatches *matches)
+{
+  passwordpolicy_entropy_dictionary(pw, n, matches);
+  passwordpolicy_entropy_spatial(pw, n, &passwordpolicy_entropy_qwerty[0][0], 6, true,
+                                 PASSWORDPOLICY_ENTROPY_QWERTY_KEYS, PASSWORDPOLICY_ENTROPY_QWERTY_DEGREE, matches);
+  passwordpolicy_entropy_spatial(pw, n, &passwordpolicy_entropy_keypad[0][0], 8, false,
+                                 PASSWORDPOLICY_ENTROPY_KEYPAD_KEYS, PASSWORDPOLICY_ENTROPY_KEYPAD_DEGREE, matches);
+  passwordpolicy_entropy_sequences(pw, n, matches);
+  passwordpolicy_entropy_dates(pw, n, reference_year, matches);
+}
+
+/*
+ * @brief Keyboard walks of 3 or more adjacent keys, "qwerty", "1qaz2wsx", "zxcvbn", "7896"
+ **/
+void passwordpolicy_entropy_spatial(const char *pw, int n, const char *graph, int directions, bool shift,
+                                    double keys, double degree, PasswordPolicyEntropyMatches *matches)
+{
+  int i, j, d, a, b, turns, shifted, last_direction, length;
+  unsigned char prev, cur;
+  double guesses;
+
+  for (i = 0; i < n - 1; i = Max(j, i + 1))
+  {
+    turns = 0;
+    shifted = 0;
+    last_direction = -1;
+    prev = (unsigned char)pw[i];
+    if (shift && prev < 128 && passwordpolicy_entropy_qwerty_shift[prev] != 0)
+    {
+      prev = passwordpolicy_entropy_qwerty_shift[prev];
+      shifted++;
+    }
+
+    for (j = i + 1; j < n; j++)
+    {
+      cur = (unsigned char)pw[j];
+      if (prev >= 128 || cur >= 128)
+        break;
+      if (shift && passwordpolicy_entropy_qwerty_shift[cur] != 0)
+        cur = passwordpolicy_entropy_qwerty_shift[cur];
+
+      for (d = 0; d < directions; d++)
+      {
+        if (graph[prev * directions + d] != 0 && (unsigned char)graph[prev * directions + d] == cur)
+          break;
+      }
+      if (d == directions)
+        break;
+      if (d != last_direction)
+      {
+        turns++;
+        last_direction = d;
+      }
+      if (cur != (unsigned char)pw[j])
+        shifted++;
+      prev = cur;
+    }
+
+    length = j - i;
+    if (length < 3)
+      continue;
+
+    guesses = 0;
+    for (a = 2; a <= length; a++)
+    {
+      for (b = 1; b <= Min(turns, a - 1); b++)
+        guesses += passwordpolicy_entropy_binomial(a - 1, b - 1) * keys * pow(degree, b);
+    }
+    if (shifted > 0)
+    {
+      if (shifted == length)
+        guesses *= 2;
+      else
+      {
+        double variations = 0;
+
+        for (a = 1; a <= Min(shifted, length - shifted); a++)
+          variations += passwordpolicy_entropy_binomial(length, a);
+        guesses *= variations;
+      }
+    }
+    passwordpolicy_entropy_add(matches, i, j - 1, PASSWORDPOLICY_ENTROPY_SPATIAL, guesses);
+  }
+}
+
+/*
+ * @brief Runs of 3 or more characters of the same class with a constant step, "abcd", "9753"
+ **/
+void passwordpolicy_entropy_sequences(const char *pw, int n, PasswordPolicyEntropyMatches *matches)
+{
+  int i, j, delta, length;
+  unsigned char first;
+  double base;
+
+#define SEQUENCE_CLASS(c) ((c) >= 'a' && (c) <= 'z' ? 1 : (c) >= 'A' && (c) <= 'Z' ? 2 : (c) >= '0' && (c) <= '9' ? 3 : 0)
+
+  for (i = 0; i < n - 2; i = j)
+  {
+    first = (unsigned char)pw[i];
+    delta = (unsigned char)pw[i + 1] - first;
+    if (SEQUENCE_CLASS(first) == 0 || delta == 0 || Abs(delta) > 5)
+    {
+      j = i + 1;
+      continue;
+    }
+    for (j = i + 1; j < n; j++)
+    {
+      if ((unsigned char)pw[j] - (unsigned char)pw[j - 1] != delta ||
+          SEQUENCE_CLASS((unsigned char)pw[j]) != SEQUENCE_CLASS(first))
+        break;
+    }
+    length = j - i;
+    if (length < 3)
+    {
+      j = i + 1;
+      continue;
+    }
+
+    if (first == 'a' || first == 'A' || first == 'z' || first == 'Z' || first == '0' || first == '1' || first == '9')
+      base = 4;
+    else if (SEQUENCE_CLASS(first) == 3)
+      base = 10;
+    else
+      base = 26;
+    if (delta < 0)
+      base *= 2;
+    passwordpolicy_entropy_add(matches, i, j - 1, PASSWORDPOLICY_ENTROPY_SEQUENCE, base * length);
+
+    /* the last character can start the next run */
+    j--;
+  }
+#undef SEQUENCE_CLASS
+}
+
+int passwordpolicy_entropy_year_guesses(int year, int reference_year)
+{
+  return Max(Abs(year - reference_year), PASSWORDPOLICY_ENTROPY_MIN_YEAR_SPACE);
+}
+
+/*
+ * @brief Years and dates, with or without separators: "1987", "13.05.87", "19870513"
+ **/
+void passwordpolicy_entropy_dates(const char *pw, int n, int reference_year, PasswordPolicyEntropyMatches *matches)
+{
+  int i, len, k, yl, year, rest, dl, ml, a, b, digits, parts[3], lengths[3], p, sep;
+  bool found;
+
+  /* digit runs: a year, or a date without separators */
+  for (i = 0; i < n; i++)
+  {
+    for (digits = 0; i + digits < n && pw[i + digits] >= '0' && pw[i + digits] <= '9'; digits++)
+      ;
+
+    for (len = 4; len <= Min(digits, 8); len++)
+    {
+      if (len == 4)
+      {
+        year = passwordpolicy_entropy_number(pw + i, 4);
+        if (year >= 1900 && year <= 2099)
+          passwordpolicy_entropy_add(matches, i, i + 3, PASSWORDPOLICY_ENTROPY_DATE,
+                                     passwordpolicy_entropy_year_guesses(year, reference_year));
+      }
+
+      /* year first or last, 2 or 4 digits, then day and month in either order */
+      found = false;
+      for (k = 0; k < 4 && !found; k++)
+      {
+        yl = (k & 1) ? 4 : 2;
+        rest = len - yl;
+        if (rest < 2 || rest > 4)
+          continue;
+        year = passwordpolicy_entropy_number(pw + i + ((k & 2) ? rest : 0), yl);
+        if (yl == 2)
+          year += year > 50 ? 1900 : 2000;
+        if (year < PASSWORDPOLICY_ENTROPY_MIN_YEAR || year > PASSWORDPOLICY_ENTROPY_MAX_YEAR)
+          continue;
+        for (dl = 1; dl <= 2 && !found; dl++)
+        {
+          ml = rest - dl;
+          if (ml < 1 || ml > 2)
+            continue;
+          a = passwordpolicy_entropy_number(pw + i + ((k & 2) ? 0 : yl), dl);
+          b = passwordpolicy_entropy_number(pw + i + ((k & 2) ? 0 : yl) + dl, ml);
+          if ((a >= 1 && a <= 31 && b >= 1 && b <= 12) || (a >= 1 && a <= 12 && b >= 1 && b <= 31))
+            found = true;
+        }
+      }
+      if (found)
+        passwordpolicy_entropy_add(matches, i, i + len - 1, PASSWORDPOLICY_ENTROPY_DATE,
+                                   365.0 * passwordpolicy_entropy_year_guesses(year, reference_year));
+    }
+  }
+
+  /* dates with the same separator twice, day/month/year or year/month/day */
+  for (i = 0; i < n; i++)
+  {
+    p = i;
+    sep = 0;
+    for (k = 0; k < 3; k++)
+    {
+      for (lengths[k] = 0; p < n && pw[p] >= '0' && pw[p] <= '9' && lengths[k] < 4; lengths[k]++, p++)
+        ;
+      if (lengths[k] == 0)
+        break;
+      parts[k] = passwordpolicy_entropy_number(pw + p - lengths[k], lengths[k]);
+      if (k == 2)
+        break;
+      if (p >= n || strchr(" -/\\_.", pw[p]) == NULL || (sep != 0 && pw[p] != sep))
+        break;
+      sep = pw[p++];
+    }
+    if (k != 2 || lengths[2] == 0)
+      continue;
+
+    if (lengths[0] == 4 && lengths[1] <= 2 && lengths[2] <= 2)
+    {
+      year = parts[0];
+      a = parts[1];
+      b = parts[2];
+    }
+    else if (lengths[0] <= 2 && lengths[1] <= 2 && (lengths[2] == 2 || lengths[2] == 4))
+    {
+      year = lengths[2] == 2 ? parts[2] + (parts[2] > 50 ? 1900 : 2000) : parts[2];
+      a = parts[0];
+      b = parts[1];
+    }
+    else
+      continue;
+    if (year < PASSWORDPOLICY_ENTROPY_MIN_YEAR || year > PASSWORDPOLICY_ENTROPY_MAX_YEAR)
+      continue;
+    if ((a >= 1 && a <= 31 && b >= 1 && b <= 12) || (a >= 1 && a <= 12 && b >= 1 && b <= 31))
+      passwordpolicy_entropy_add(matches, i, p - 1, PASSWORDPOLICY_ENTROPY_DATE,
+                                 365.0 * passwordpolicy_entropy_year_guesses(year, reference_year) * 4);
+  }
+}
+
+/*
+ * @brief Repeated characters or blocks, "aaaa", "abcabc", the guesses of the block times the repeats
+ **/
+void passwordpolicy_entropy_repeats(const char *pw, int n, int reference_year, PasswordPolicyEntropyMatches *matches)
+{
+  int i, block, repeats, best_block, best_repeats;
+
+  for (i = 0; i < n;)
+  {
+    best_block = 0;
+    best_repeats = 0;
+    for (block = 1; block <= (n - i) / 2; block++)
+    {
+      for (repeats = 1; i + (repeats + 1) * block <= n &&
+                        memcmp(pw + i, pw + i + repeats * block, block) == 0;
+           repeats++)
+        ;
+      if (repeats < (block == 1 ? 3 : 2))
+        continue;
+      if (repeats * block > best_repeats * best_block)
+      {
+        best_block = block;
+        best_repeats = repeats;
+      }
+    }
+    if (best_block == 0)
+    {
+      i++;
+      continue;
+    }
+
+    passwordpolicy_entropy_add(matches, i, i + best_block * best_repeats - 1, PASSWORDPOLICY_ENTROPY_REPEAT,
+                               passwordpolicy_entropy_whole(pw + i, best_block, reference_year) * best_repeats);
+    i += best_block * best_repeats;
+  }
+}
+
+/*
+ * @brief Guesses of a repeated block: the cheapest match covering it, or bruteforce
+ **/
+double passwordpolicy_entropy_whole(const char *pw, int n, int reference_year)
+{
+  PasswordPolicyEntropyMatch items[64];
+  PasswordPolicyEntropyMatches matches;
+  double guesses = passwordpolicy_entropy_bruteforce(n);
+  int k;
+
+  matches.items = items;
+  matches.count = 0;
+  matches.capacity = lengthof(items);
+
+  passwordpolicy_entropy_match(pw, n, reference_year, &matches);
+
+  for (k = 0; k < matches.count; k++)
+  {
+    if (matches.items[k].i == 0 && matches.items[k].j == n - 1 && matches.items[k].guesses < guesses)
+      guesses = matches.items[k].guesses;
+  }
+  return guesses;
+}
+
+/*
+ * @brief Keep the sequence of l matches ending at k, the last one starting at i, unless a
+ * sequence of l or fewer matches ending at k needs fewer guesses
+ **/
+void passwordpolicy_entropy_update(const double *factorial, const double *growing, int k, int i, int l,
+                                   PasswordPolicyEntropyPattern pattern, double guesses)
+{
+  PasswordPolicyEntropyState *state;
+  double pi, g;
+  int m;
+
+  pi = guesses * (l > 1 ? passwordpolicy_entropy_states[i - 1][l - 1].pi : 1);
+  g = factorial[l] * pi + growing[l];
+  for (m = 1; m <= l; m++)
+  {
+    if (passwordpolicy_entropy_states[k][m].valid && passwordpolicy_entropy_states[k][m].g <= g)
+      return;
+  }
+
+  state = &passwordpolicy_entropy_states[k][l];
+  state->pi = pi;
+  state->g = g;
+  state->i = i;
+  state->pattern = pattern;
+  state->valid = true;
+}
+
+/*
+ * @brief Guesses of the cheapest sequence of matches and bruteforce segments covering the password
+ * A sequence of l matches costs l! * product(guesses) + 10000^(l - 1): more matches cost more,
+ * bruteforce segments fill the gaps and never follow each other.
+ **/
+double passwordpolicy_entropy_optimal(int n, const PasswordPolicyEntropyMatches *matches,
+                                      PasswordPolicyEntropyPattern *pattern)
+{
+  int i, k, l, m, best_l, longest;
+  double guesses, factorial[PASSWORDPOLICY_ENTROPY_MAX_LENGTH + 1], growing[PASSWORDPOLICY_ENTROPY_MAX_LENGTH + 1];
+  double bruteforce[PASSWORDPOLICY_ENTROPY_MAX_LENGTH + 1];
+  PasswordPolicyEntropyState *state;
+  PasswordPolicyEntropyMatch *match;
+
+  factorial[0] = 1;
+  growing[1] = 1;
+  for (l = 1; l <= n; l++)
+  {
+    factorial[l] = factorial[l - 1] * l;
+    if (l > 1)
+      growing[l] = growing[l - 1] * PASSWORDPOLICY_ENTROPY_MIN_GUESSES_GROWING_SEQUENCE;
+    bruteforce[l] = passwordpolicy_entropy_bruteforce(l);
+  }
+  for (k = 0; k < n; k++)
+  {
+    for (l = 0; l <= n; l++)
+      passwordpolicy_entropy_states[k][l].valid = false;
+  }
+
+  for (k = 0; k < n; k++)
+  {
+    for (m = 0; m < matches->count; m++)
+    {
+      match = &matches->items[m];
+      if (match->j != k)
+        continue;
+      guesses = match->guesses;
+      /* a match inside the password is never cheaper than a short bruteforce */
+      if (match->j - match->i + 1 < n)
+        guesses = Max(guesses, match->i == match->j ? PASSWORDPOLICY_ENTROPY_MIN_SUBMATCH_SINGLE_CHAR
+                                                    : PASSWORDPOLICY_ENTROPY_MIN_SUBMATCH_MULTI_CHAR);
+      if (match->i == 0)
+        passwordpolicy_entropy_update(factorial, growing, k, 0, 1, match->pattern, guesses);
+      else
+      {
+        for (l = 1; l <= match->i; l++)
+        {
+          if (passwordpolicy_entropy_states[match->i - 1][l].valid)
+            passwordpolicy_entropy_update(factorial, growing, k, match->i, l + 1, match->pattern, guesses);
+        }
+      }
+    }
+
+    passwordpolicy_entropy_update(factorial, growing, k, 0, 1, PASSWORDPOLICY_ENTROPY_BRUTEFORCE,
+                                  bruteforce[k + 1]);
+    for (i = 1; i <= k; i++)
+    {
+      guesses = bruteforce[k - i + 1];
+      for (l = 1; l <= i; l++)
+      {
+        if (passwordpolicy_entropy_states[i - 1][l].valid &&
+            passwordpolicy_entropy_states[i - 1][l].pattern != PASSWORDPOLICY_ENTROPY_BRUTEFORCE)
+          passwordpolicy_entropy_update(factorial, growing, k, i, l + 1, PASSWORDPOLICY_ENTROPY_BRUTEFORCE, guesses);
+      }
+    }
+  }
+
+  best_l = 0;
+  for (l = 1; l <= n; l++)
+  {
+    if (passwordpolicy_entropy_states[n - 1][l].valid &&
+        (best_l == 0 || passwordpolicy_entropy_states[n - 1][l].g < passwordpolicy_entropy_states[n - 1][best_l].g))
+      best_l = l;
+  }
+
+  /* the pattern covering most of the password */
+  *pattern = PASSWORDPOLICY_ENTROPY_BRUTEFORCE;
+  longest = 0;
+  for (k = n - 1, l = best_l; k >= 0 && l > 0; l--)
+  {
+    state = &passwordpolicy_entropy_states[k][l];
+    if (state->pattern != PASSWORDPOLICY_ENTROPY_BRUTEFORCE && k - state->i + 1 > longest)
+    {
+      longest = k - state->i + 1;
+      *pattern = (PasswordPolicyEntropyPattern)state->pattern;
+    }
+    k = state->i - 1;
+  }
+
+  return passwordpolicy_entropy_states[n - 1][best_l].g;
+}
@@ -0,0 +1,37 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_entropy.h
+ *      Strength estimate of the passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_ENTROPY_H_
+#define _PASSWORDPOLICY_ENTROPY_H_
+
+#include <postgres.h>
+
+typedef enum PasswordPolicyEntropyPattern
+{
+  PASSWORDPOLICY_ENTROPY_BRUTEFORCE,
+  PASSWORDPOLICY_ENTROPY_DICTIONARY,
+  PASSWORDPOLICY_ENTROPY_SPATIAL,
+  PASSWORDPOLICY_ENTROPY_SEQUENCE,
+  PASSWORDPOLICY_ENTROPY_REPEAT,
+  PASSWORDPOLICY_ENTROPY_DATE
+} PasswordPolicyEntropyPattern;
+
+typedef struct PasswordPolicyEntropy
+{
+  double bits;                          /* log2 of the guesses needed */
+  PasswordPolicyEntropyPattern pattern; /* pattern covering most of the password */
+} PasswordPolicyEntropy;
+
+extern PGDLLEXPORT void passwordpolicy_entropy_estimate(const char *password, int reference_year,
+                                                        PasswordPolicyEntropy *estimate);
+extern PGDLLEXPORT const char *passwordpolicy_entropy_pattern_name(PasswordPolicyEntropyPattern pattern);
+
+#endif
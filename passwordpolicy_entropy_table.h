@@ -0,0 +1,556 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_entropy_table.h
+ *      Keyboard adjacency graphs and ranked words of the strength estimator
+ *
+ * Generated by tools/generate_entropy_table.py, don't edit.
+ * Only included by passwordpolicy_entropy.c.
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_ENTROPY_TABLE_H_
+#define _PASSWORDPOLICY_ENTROPY_TABLE_H_
+
+#define PASSWORDPOLICY_ENTROPY_MAX_WORD 32
+#define PASSWORDPOLICY_ENTROPY_MIN_WORD 3
+
+#define PASSWORDPOLICY_ENTROPY_QWERTY_KEYS 47
+#define PASSWORDPOLICY_ENTROPY_QWERTY_DEGREE 4.5957
+#define PASSWORDPOLICY_ENTROPY_KEYPAD_KEYS 15
+#define PASSWORDPOLICY_ENTROPY_KEYPAD_DEGREE 5.0667
+
+typedef struct PasswordPolicyEntropyWord
+{
+  const char *word;
+  int rank;
+} PasswordPolicyEntropyWord;
+
+/* neighbors of the qwerty keys (unshifted): left, upper left, upper right, right, lower right, lower left */
+static const char passwordpolicy_entropy_qwerty[128][6] = {
+    ['\''] = {';', '[', ']', 0, 0, '/'},
+    [','] = {'m', 'k', 'l', '.', 0, 0},
+    ['-'] = {'0', 0, 0, '=', '[', 'p'},
+    ['.'] = {',', 'l', ';', '/', 0, 0},
+    ['/'] = {'.', ';', '\'', 0, 0, 0},
+    ['0'] = {'9', 0, 0, '-', 'p', 'o'},
+    ['1'] = {'`', 0, 0, '2', 'q', 0},
+    ['2'] = {'1', 0, 0, '3', 'w', 'q'},
+    ['3'] = {'2', 0, 0, '4', 'e', 'w'},
+    ['4'] = {'3', 0, 0, '5', 'r', 'e'},
+    ['5'] = {'4', 0, 0, '6', 't', 'r'},
+    ['6'] = {'5', 0, 0, '7', 'y', 't'},
+    ['7'] = {'6', 0, 0, '8', 'u', 'y'},
+    ['8'] = {'7', 0, 0, '9', 'i', 'u'},
+    ['9'] = {'8', 0, 0, '0', 'o', 'i'},
+    [';'] = {'l', 'p', '[', '\'', '/', '.'},
+    ['='] = {'-', 0, 0, 0, ']', '['},
+    ['['] = {'p', '-', '=', ']', '\'', ';'},
+    ['\\'] = {']', 0, 0, 0, 0, 0},
+    [']'] = {'[', '=', 0, '\\', 0, '\''},
+    ['`'] = {0, 0, 0, '1', 0, 0},
+    ['a'] = {0, 'q', 'w', 's', 'z', 0},
+    ['b'] = {'v', 'g', 'h', 'n', 0, 0},
+    ['c'] = {'x', 'd', 'f', 'v', 0, 0},
+    ['d'] = {'s', 'e', 'r', 'f', 'c', 'x'},
+    ['e'] = {'w', '3', '4', 'r', 'd', 's'},
+    ['f'] = {'d', 'r', 't', 'g', 'v', 'c'},
+    ['g'] = {'f', 't', 'y', 'h', 'b', 'v'},
+    ['h'] = {'g', 'y', 'u', 'j', 'n', 'b'},
+    ['i'] = {'u', '8', '9', 'o', 'k', 'j'},
+    ['j'] = {'h', 'u', 'i', 'k', 'm', 'n'},
+    ['k'] = {'j', 'i', 'o', 'l', ',', 'm'},
+    ['l'] = {'k', 'o', 'p', ';', '.', ','},
+    ['m'] = {'n', 'j', 'k', ',', 0, 0},
+    ['n'] = {'b', 'h', 'j', 'm', 0, 0},
+    ['o'] = {'i', '9', '0', 'p', 'l', 'k'},
+    ['p'] = {'o', '0', '-', '[', ';', 'l'},
+    ['q'] = {0, '1', '2', 'w', 'a', 0},
+    ['r'] = {'e', '4', '5', 't', 'f', 'd'},
+    ['s'] = {'a', 'w', 'e', 'd', 'x', 'z'},
+    ['t'] = {'r', '5', '6', 'y', 'g', 'f'},
+    ['u'] = {'y', '7', '8', 'i', 'j', 'h'},
+    ['v'] = {'c', 'f', 'g', 'b', 0, 0},
+    ['w'] = {'q', '2', '3', 'e', 's', 'a'},
+    ['x'] = {'z', 's', 'd', 'c', 0, 0},
+    ['y'] = {'t', '6', '7', 'u', 'h', 'g'},
+    ['z'] = {0, 'a', 's', 'x', 0, 0},
+};
+
+/* unshifted key of the shifted characters */
+static const char passwordpolicy_entropy_qwerty_shift[128] = {
+    ['!'] = '1',
+    ['"'] = '\'',
+    ['#'] = '3',
+    ['$'] = '4',
+    ['%'] = '5',
+    ['&'] = '7',
+    ['('] = '9',
+    [')'] = '0',
+    ['*'] = '8',
+    ['+'] = '=',
+    [':'] = ';',
+    ['<'] = ',',
+    ['>'] = '.',
+    ['?'] = '/',
+    ['@'] = '2',
+    ['A'] = 'a',
+    ['B'] = 'b',
+    ['C'] = 'c',
+    ['D'] = 'd',
+    ['E'] = 'e',
+    ['F'] = 'f',
+    ['G'] = 'g',
+    ['H'] = 'h',
+    ['I'] = 'i',
+    ['J'] = 'j',
+    ['K'] = 'k',
+    ['L'] = 'l',
+    ['M'] = 'm',
+    ['N'] = 'n',
+    ['O'] = 'o',
+    ['P'] = 'p',
+    ['Q'] = 'q',
+    ['R'] = 'r',
+    ['S'] = 's',
+    ['T'] = 't',
+    ['U'] = 'u',
+    ['V'] = 'v',
+    ['W'] = 'w',
+    ['X'] = 'x',
+    ['Y'] = 'y',
+    ['Z'] = 'z',
+    ['^'] = '6',
+    ['_'] = '-',
+    ['{'] = '[',
+    ['|'] = '\\',
+    ['}'] = ']',
+    ['~'] = '`',
+};
+
+/* neighbors of the keypad keys, clockwise from the left */
+static const char passwordpolicy_entropy_keypad[128][8] = {
+    ['*'] = {'/', 0, 0, 0, '-', '+', '9', '8'},
+    ['+'] = {'9', '*', '-', 0, 0, 0, 0, '6'},
+    ['-'] = {'*', 0, 0, 0, 0, 0, '+', '9'},
+    ['.'] = {'0', '2', '3', 0, 0, 0, 0, 0},
+    ['/'] = {0, 0, 0, 0, '*', '9', '8', '7'},
+    ['0'] = {0, '1', '2', '3', '.', 0, 0, 0},
+    ['1'] = {0, 0, '4', '5', '2', '0', 0, 0},
+    ['2'] = {'1', '4', '5', '6', '3', '.', '0', 0},
+    ['3'] = {'2', '5', '6', 0, 0, 0, '.', '0'},
+    ['4'] = {0, 0, '7', '8', '5', '2', '1', 0},
+    ['5'] = {'4', '7', '8', '9', '6', '3', '2', '1'},
+    ['6'] = {'5', '8', '9', '+', 0, 0, '3', '2'},
+    ['7'] = {0, 0, 0, '/', '8', '5', '4', 0},
+    ['8'] = {'7', 0, '/', '*', '9', '6', '5', '4'},
+    ['9'] = {'8', '/', '*', '-', '+', 0, '6', '5'},
+};
+
+/* common words, ordered for a binary search, rank 1 is the most common */
+static const PasswordPolicyEntropyWord passwordpolicy_entropy_words[399] = {
+    {"0000", 183},
+    {"000000", 31},
+    {"1111", 64},
+    {"11111", 118},
+    {"111111", 8},
+    {"11111111", 67},
+    {"112233", 58},
+    {"121212", 30},
+    {"123123", 11},
+    {"123123123", 158},
+    {"123321", 22},
+    {"1234", 7},
+    {"12344321", 243},
+    {"12345", 6},
+    {"123456", 1},
+    {"1234567", 9},
+    {"12345678", 3},
+    {"123456789", 5},
+    {"1234567890", 24},
+    {"1234qwer", 103},
+    {"123654", 170},
+    {"123qwe", 33},
+    {"131313", 68},
+    {"159753", 73},
+    {"1q2w3e4r", 224},
+    {"1qaz2wsx", 28},
+    {"2000", 49},
+    {"222222", 107},
+    {"232323", 235},
+    {"333333", 194},
+    {"555555", 66},
+    {"654321", 26},
+    {"666666", 20},
+    {"696969", 17},
+    {"777777", 70},
+    {"7777777", 29},
+    {"8675309", 245},
+    {"87654321", 242},
+    {"888888", 237},
+    {"88888888", 108},
+    {"987654", 176},
+    {"987654321", 89},
+    {"999999", 179},
+    {"aaaaaa", 74},
+    {"abc123", 13},
+    {"abcd1234", 291},
+    {"abcdef", 290},
+    {"access", 87},
+    {"adidas", 221},
+    {"admin", 248},
+    {"admin123", 302},
+    {"administrator", 249},
+    {"all", 318},
+    {"amanda", 79},
+    {"and", 313},
+    {"andrea", 141},
+    {"andrew", 45},
+    {"angel", 210},
+    {"anthony", 109},
+    {"any", 319},
+    {"april", 271},
+    {"are", 315},
+    {"arsenal", 147},
+    {"asdfasdf", 240},
+    {"asdfgh", 39},
+    {"ashley", 82},
+    {"august", 275},
+    {"austin", 91},
+    {"autumn", 266},
+    {"baby", 371},
+    {"badboy", 206},
+    {"bailey", 112},
+    {"banana", 167},
+    {"barney", 201},
+    {"baseball", 12},
+    {"baseball1", 297},
+    {"batman", 44},
+    {"batman1", 309},
+    {"bear", 387},
+    {"bigdick", 214},
+    {"bigdog", 123},
+    {"biteme", 85},
+    {"blowme", 246},
+    {"booboo", 151},
+    {"boomer", 150},
+    {"boston", 185},
+    {"boy", 341},
+    {"brandon", 187},
+    {"brandy", 204},
+    {"bulldog", 162},
+    {"business", 356},
+    {"buster", 41},
+    {"but", 316},
+    {"camaro", 133},
+    {"can", 320},
+    {"casper", 233},
+    {"changeme", 253},
+    {"charles", 209},
+    {"charlie", 50},
+    {"cheese", 78},
+    {"chelsea", 84},
+    {"chester", 189},
+    {"chicago", 205},
+    {"chicken", 128},
+    {"chris", 218},
+    {"cocacola", 232},
+    {"coffee", 181},
+    {"company", 264},
+    {"compaq", 164},
+    {"computer", 60},
+    {"cookie", 120},
+    {"corvette", 96},
+    {"cowboy", 138},
+    {"cowboys", 175},
+    {"crystal", 241},
+    {"dad", 350},
+    {"dakota", 146},
+    {"dallas", 90},
+    {"daniel", 55},
+    {"database", 260},
+    {"day", 327},
+    {"december", 279},
+    {"default", 254},
+    {"devil", 396},
+    {"diablo", 161},
+    {"diamond", 102},
+    {"did", 342},
+    {"dolphin", 247},
+    {"dragon", 10},
+    {"dragon1", 295},
+    {"dream", 377},
+    {"eagle", 389},
+    {"eagles", 148},
+    {"edward", 193},
+    {"enter", 216},
+    {"falcon", 137},
+    {"fall", 267},
+    {"family", 352},
+    {"february", 269},
+    {"fender", 200},
+    {"ferrari", 139},
+    {"fishing", 231},
+    {"flower", 211},
+    {"football", 14},
+    {"football1", 296},
+    {"for", 314},
+    {"forever", 191},
+    {"freedom", 69},
+    {"friday", 284},
+    {"friend", 367},
+    {"gandalf", 239},
+    {"gateway", 159},
+    {"george", 59},
+    {"get", 328},
+    {"gfhjkm", 104},
+    {"ghbdtn", 230},
+    {"ginger", 75},
+    {"god", 368},
+    {"golden", 244},
+    {"golfer", 119},
+    {"guest", 255},
+    {"guitar", 124},
+    {"had", 321},
+    {"hammer", 105},
+    {"hannah", 169},
+    {"happy", 373},
+    {"hardcore", 166},
+    {"harley", 43},
+    {"has", 329},
+    {"heart", 370},
+    {"heather", 99},
+    {"hello", 97},
+    {"hello123", 300},
+    {"her", 322},
+    {"hero", 400},
+    {"him", 330},
+    {"his", 331},
+    {"hockey", 53},
+    {"home", 354},
+    {"horse", 392},
+    {"house", 353},
+    {"how", 332},
+    {"hunter", 40},
+    {"iceman", 173},
+    {"iloveyou", 48},
+    {"iloveyou1", 293},
+    {"internet", 115},
+    {"its", 343},
+    {"jackson", 125},
+    {"james", 234},
+    {"january", 268},
+    {"jasmine", 225},
+    {"jasper", 215},
+    {"jennifer", 37},
+    {"jessica", 62},
+    {"jesus", 369},
+    {"johnny", 192},
+    {"jordan", 36},
+    {"joseph", 144},
+    {"joshua", 77},
+    {"july", 274},
+    {"june", 273},
+    {"junior", 168},
+    {"justin", 110},
+    {"killer", 34},
+    {"king", 401},
+    {"kitty", 394},
+    {"klaster", 57},
+    {"knight", 199},
+    {"lakers", 172},
+    {"let", 344},
+    {"letmein", 16},
+    {"letmein123", 287},
+    {"life", 360},
+    {"lion", 386},
+    {"login", 251},
+    {"london", 177},
+    {"love", 81},
+    {"lucky", 374},
+    {"maggie", 72},
+    {"magic", 375},
+    {"man", 333},
+    {"manager", 263},
+    {"march", 270},
+    {"marina", 160},
+    {"marine", 229},
+    {"marlboro", 238},
+    {"martin", 98},
+    {"master", 19},
+    {"master1", 306},
+    {"matrix", 94},
+    {"matthew", 86},
+    {"maverick", 131},
+    {"may", 272},
+    {"melissa", 149},
+    {"mercedes", 145},
+    {"merlin", 101},
+    {"michael", 25},
+    {"michelle", 61},
+    {"mickey", 127},
+    {"midnight", 202},
+    {"miller", 184},
+    {"mom", 351},
+    {"monday", 280},
+    {"money", 174},
+    {"monkey", 15},
+    {"monkey1", 294},
+    {"monster", 154},
+    {"moon", 379},
+    {"morgan", 135},
+    {"mother", 190},
+    {"mountain", 384},
+    {"music", 365},
+    {"mustang", 23},
+    {"mysql", 259},
+    {"nascar", 153},
+    {"natasha", 223},
+    {"ncc1701", 180},
+    {"new", 334},
+    {"nicole", 83},
+    {"nikita", 198},
+    {"ninja", 397},
+    {"not", 317},
+    {"november", 278},
+    {"now", 335},
+    {"ocean", 382},
+    {"october", 277},
+    {"office", 357},
+    {"old", 336},
+    {"oliver", 195},
+    {"one", 324},
+    {"oracle", 258},
+    {"orange", 117},
+    {"our", 325},
+    {"out", 326},
+    {"panties", 228},
+    {"pass", 71},
+    {"pass123", 304},
+    {"passw0rd", 252},
+    {"password", 2},
+    {"password1", 289},
+    {"patrick", 114},
+    {"peanut", 134},
+    {"people", 363},
+    {"pepper", 63},
+    {"phoenix", 132},
+    {"pirate", 398},
+    {"player", 197},
+    {"please", 203},
+    {"porsche", 171},
+    {"postgres", 257},
+    {"power", 376},
+    {"prince", 227},
+    {"princess", 76},
+    {"princess1", 298},
+    {"puppy", 393},
+    {"purple", 165},
+    {"put", 345},
+    {"q1w2e3r4", 186},
+    {"q1w2e3r4t5", 113},
+    {"qazwsx", 32},
+    {"queen", 402},
+    {"qwer1234", 163},
+    {"qwerty", 4},
+    {"qwerty123", 292},
+    {"qwertyuiop", 21},
+    {"rabbit", 212},
+    {"rachel", 217},
+    {"raiders", 236},
+    {"ranger", 54},
+    {"rangers", 208},
+    {"redsox", 196},
+    {"richard", 121},
+    {"river", 383},
+    {"robert", 51},
+    {"root", 250},
+    {"root123", 303},
+    {"samantha", 122},
+    {"samsung", 140},
+    {"saturday", 285},
+    {"say", 346},
+    {"school", 366},
+    {"scooby", 182},
+    {"scooter", 116},
+    {"secret", 100},
+    {"secret123", 305},
+    {"see", 337},
+    {"september", 276},
+    {"server", 261},
+    {"shadow", 18},
+    {"shadow1", 307},
+    {"shark", 390},
+    {"she", 347},
+    {"silver", 106},
+    {"sky", 381},
+    {"slayer", 207},
+    {"smokey", 142},
+    {"snake", 391},
+    {"snoopy", 130},
+    {"soccer", 42},
+    {"sparky", 129},
+    {"spider", 152},
+    {"spring", 265},
+    {"star", 378},
+    {"starwars", 56},
+    {"steelers", 143},
+    {"steven", 219},
+    {"summer", 80},
+    {"sun", 380},
+    {"sunday", 286},
+    {"sunshine", 47},
+    {"sunshine1", 299},
+    {"superman", 27},
+    {"superman1", 308},
+    {"sweet", 372},
+    {"system", 262},
+    {"taylor", 93},
+    {"tennis", 178},
+    {"test", 111},
+    {"test123", 301},
+    {"the", 312},
+    {"thomas", 52},
+    {"thunder", 92},
+    {"thursday", 283},
+    {"tiger", 385},
+    {"tigers", 155},
+    {"tigger", 46},
+    {"time", 361},
+    {"too", 348},
+    {"trustno1", 35},
+    {"tuesday", 281},
+    {"two", 338},
+    {"use", 349},
+    {"user", 256},
+    {"victoria", 222},
+    {"was", 323},
+    {"water", 364},
+    {"way", 339},
+    {"wednesday", 282},
+    {"welcome", 136},
+    {"welcome1", 288},
+    {"whatever", 126},
+    {"who", 340},
+    {"william", 95},
+    {"winner", 220},
+    {"winter", 226},
+    {"wizard", 213},
+    {"wolf", 388},
+    {"work", 358},
+    {"world", 359},
+    {"xxxxxx", 157},
+    {"yamaha", 188},
+    {"yankees", 88},
+    {"year", 362},
+    {"yellow", 156},
+    {"you", 311},
+    {"zombie", 399},
+    {"zxcvbn", 65},
+    {"zxcvbnm", 38},
+};
+
+#endif
@@ -13,44 +13,228 @@
 #include "passwordpolicy_hash_accounts.h"
 
 #include <access/xact.h>
+#include <catalog/pg_type.h>
 #include <executor/spi.h>
+#if (PG_VERSION_NUM >= 130000)
+#include <common/hashfn.h>
+#else
+#include <utils/hashutils.h>
+#endif
 #include <pgstat.h>
+#include <port/pg_bitutils.h>
 #include <storage/shmem.h>
-#include <utils/hsearch.h>
+#include <utils/builtins.h>
 #include <utils/snapmgr.h>
+#include <utils/timestamp.h>
 
+#include "passwordpolicy_profiles.h"
+#include "passwordpolicy_ratelimit.h"
 #include "passwordpolicy_vars.h"
 
+/*
+ * Accounts live in an open-addressing table keyed by role Oid, with one cache line per
+ * slot. An account is always stored in the first PASSWORDPOLICY_ACCOUNT_PROBES slots from
+ * its home slot, and before the first slot never used, so a lookup reads a bounded number
+ * of slots whatever the number of deleted accounts.
+ *
+ * Accounts are added holding passwordpolicy_lock_accounts in exclusive mode, by the
+ * background worker, or by the login path on the first failure of an account in
+ * on-demand mode. Lookups don't take any lock: a slot is published by writing its roleid
+ * after the rest of the slot is initialized. Deleted accounts keep their slot and roleid,
+ * the slot can be reused by another account of the same probe window, readers detect the
+ * reuse checking the roleid again after reading the deleted flag.
+ *
+ * In on-demand mode the background worker runs a clock (second chance) sweep: an account
+ * without failures since the previous sweep, and not soft-locked, is deleted and its slot
+ * can be reused.
+ */
+#define PASSWORDPOLICY_ACCOUNT_PROBES 16
+
+StaticAssertDecl(sizeof(PasswordPolicyAccount) <= PG_CACHE_LINE_SIZE,
+                 "PasswordPolicyAccount must fit in a cache line");
+
 /* Private functions forward declaration */
-void passwordpolicy_hash_accounts_add(const char *username);
+bool passwordpolicy_hash_accounts_evict(Oid roleid);
 void passwordpolicy_hash_accounts_hard_delete(void);
+bool passwordpolicy_hash_accounts_locked(PasswordPolicyAccount *entry, TimestampTz now);
+uint32 passwordpolicy_hash_accounts_slots(void);
 void passwordpolicy_hash_accounts_soft_delete(void);
+void passwordpolicy_hash_accounts_sweep(void);
+
+/*
+ * @brief Add an account, or reactivate it if it's already in the table
+ * The caller must hold passwordpolicy_lock_accounts in exclusive mode, or be the postmaster
+ * @return the account, NULL if there is no free slot
+ **/
+PasswordPolicyAccount *passwordpolicy_hash_accounts_add(Oid roleid, const char *username)
+{
+  uint32 i, idx;
+  Oid slot_roleid;
+  PasswordPolicyAccount *entry, *deleted_entry;
+
+  if (username == NULL || !OidIsValid(roleid))
+    return NULL;
+
+  deleted_entry = NULL;
+  idx = murmurhash32(roleid) & passwordpolicy_hash_accounts_mask;
+  for (i = 0; i < PASSWORDPOLICY_ACCOUNT_PROBES; i++)
+  {
+    entry = &(passwordpolicy_hash_accounts[idx].account);
+    slot_roleid = pg_atomic_read_u32(&(entry->roleid));
+    if (slot_roleid == roleid)
+    {
+      if (pg_atomic_read_u32(&(entry->deleted)) == 1)
+      {
+        if (passwordpolicy_shm->accounts_used >= guc_passwordpolicy_lock_max_num_accounts)
+          return NULL;
+        passwordpolicy_shm->accounts_used++;
+      }
+      /* the account could have been renamed */
+      if (strcmp(NameStr(entry->usename), username) != 0)
+        namestrcpy(&(entry->usename), username);
+      pg_atomic_write_u32(&(entry->deleted), 0);
+      return entry;
+    }
+    if (slot_roleid == InvalidOid)
+      break;
+    if (deleted_entry == NULL && pg_atomic_read_u32(&(entry->deleted)) == 1)
+      deleted_entry = entry;
+    idx = (idx + 1) & passwordpolicy_hash_accounts_mask;
+  }
+
+  /* reuse a deleted slot before using a new one, to keep the probe chains short */
+  if (deleted_entry != NULL)
+    entry = deleted_entry;
+  else if (slot_roleid != InvalidOid)
+    return NULL;
+
+  if (passwordpolicy_shm->accounts_used >= guc_passwordpolicy_lock_max_num_accounts)
+    return NULL;
+
+  ereport(DEBUG3, (errmsg("passwordpolicy: adding account '%s' to auth lock", username)));
+  pg_atomic_write_u64(&(entry->failures), 0);
+  pg_atomic_write_u64(&(entry->last_failure), 0);
+  pg_atomic_write_u64(&(entry->state), 0);
+  pg_atomic_write_u32(&(entry->usage), 0);
+  namestrcpy(&(entry->usename), username);
+  /* publish the roleid the last to avoid reading uninitialized values */
+  pg_write_barrier();
+  pg_atomic_write_u32(&(entry->roleid), roleid);
+  pg_write_barrier();
+  pg_atomic_write_u32(&(entry->deleted), 0);
+  passwordpolicy_shm->accounts_used++;
+
+  return entry;
+}
+
+/*
+ * @brief Add an account after its first failed login, evicting an idle account if needed
+ * @return the account, NULL if all the candidate slots are in use by soft-locked accounts
+ **/
+PasswordPolicyAccount *passwordpolicy_hash_accounts_claim(Oid roleid, const char *username)
+{
+  PasswordPolicyAccount *entry;
+
+  if (!OidIsValid(roleid))
+    return NULL;
+
+  LWLockAcquire(passwordpolicy_lock_accounts, LW_EXCLUSIVE);
+  entry = passwordpolicy_hash_accounts_add(roleid, username);
+  if (entry == NULL && passwordpolicy_hash_accounts_evict(roleid))
+    entry = passwordpolicy_hash_accounts_add(roleid, username);
+  LWLockRelease(passwordpolicy_lock_accounts);
+
+  if (entry == NULL)
+    ereport(LOG, (errmsg("passwordpolicy: no free slot to add account '%s' to auth lock", username),
+                  errhint("increase the value of password_policy_lock.max_number_accounts")));
+
+  return entry;
+}
+
+/*
+ * @brief Find an active account
+ * @return the account, NULL if not found or deleted
+ **/
+PasswordPolicyAccount *passwordpolicy_hash_accounts_find(Oid roleid)
+{
+  uint32 i, idx;
+  Oid slot_roleid;
+  PasswordPolicyAccount *entry;
+
+  if (!OidIsValid(roleid))
+    return NULL;
+
+  idx = murmurhash32(roleid) & passwordpolicy_hash_accounts_mask;
+  for (i = 0; i < PASSWORDPOLICY_ACCOUNT_PROBES; i++)
+  {
+    entry = &(passwordpolicy_hash_accounts[idx].account);
+    slot_roleid = pg_atomic_read_u32(&(entry->roleid));
+    if (slot_roleid == roleid)
+    {
+      /* pairs with the write barriers in passwordpolicy_hash_accounts_add */
+      pg_read_barrier();
+      if (pg_atomic_read_u32(&(entry->deleted)) == 1)
+        return NULL;
+      pg_read_barrier();
+      /* the deleted slot could have been reused by another account */
+      if (pg_atomic_read_u32(&(entry->roleid)) != roleid)
+        return NULL;
+      return entry;
+    }
+    if (slot_roleid == InvalidOid)
+      return NULL;
+    idx = (idx + 1) & passwordpolicy_hash_accounts_mask;
+  }
+
+  return NULL;
+}
 
 void passwordpolicy_hash_accounts_init(void)
 {
-  HASHCTL info;
-
-  info.keysize = sizeof(PasswordPolicyAccountKey);
-  info.entrysize = sizeof(PasswordPolicyAccount);
-  passwordpolicy_hash_accounts = ShmemInitHash("passwordpolicy hash accounts",
-                                               guc_passwordpolicy_lock_max_num_accounts,
-                                               guc_passwordpolicy_lock_max_num_accounts,
-                                               &info,
-#if (PG_VERSION_NUM >= 140000)
-                                               HASH_ELEM | HASH_STRINGS
-#else
-                                               HASH_ELEM
-#endif
-  );
+  bool found;
+  uint32 i;
+  PasswordPolicyAccount *entry;
+
+  passwordpolicy_hash_accounts_mask = passwordpolicy_hash_accounts_slots() - 1;
+
+  /* shmem allocations are cache line aligned, so are the slots */
+  passwordpolicy_hash_accounts = ShmemInitStruct("passwordpolicy hash accounts",
+                                                 passwordpolicy_hash_accounts_memsize(), &found);
+  if (found)
+    return;
+
+  for (i = 0; i <= passwordpolicy_hash_accounts_mask; i++)
+  {
+    entry = &(passwordpolicy_hash_accounts[i].account);
+    pg_atomic_init_u32(&(entry->roleid), InvalidOid);
+    pg_atomic_init_u32(&(entry->deleted), 0);
+    pg_atomic_init_u32(&(entry->usage), 0);
+    pg_atomic_init_u64(&(entry->failures), 0);
+    pg_atomic_init_u64(&(entry->last_failure), 0);
+    pg_atomic_init_u64(&(entry->state), 0);
+    MemSet(&(entry->usename), 0, sizeof(NameData));
+  }
 }
 
 void passwordpolicy_hash_accounts_load(void)
 {
+  bool isnull;
   int ret, i;
   TupleDesc tupdesc;
   SPITupleTable *tuptable;
   StringInfoData buf;
 
+  /* on-demand: accounts are added by the logins, the list of accounts is not read */
+  if (guc_passwordpolicy_lock_all_accounts && guc_passwordpolicy_lock_on_demand)
+  {
+    pgstat_report_activity(STATE_RUNNING, "passwordpolicy sweeping accounts");
+    LWLockAcquire(passwordpolicy_lock_accounts, LW_EXCLUSIVE);
+    passwordpolicy_hash_accounts_sweep();
+    LWLockRelease(passwordpolicy_lock_accounts);
+    pgstat_report_activity(STATE_IDLE, NULL);
+    return;
+  }
+
   SetCurrentStatementStartTimestamp();
   StartTransactionCommand();
   SPI_connect();
@@ -73,8 +257,8 @@ void passwordpolicy_hash_accounts_load(void)
 
   pgstat_report_activity(STATE_RUNNING, "passwordpolicy soft-deleting accounts");
 
-  /* Mark all the accounts for deletion with shared lock */
-  LWLockAcquire(passwordpolicy_lock_accounts, LW_SHARED);
+  /* Mark all the accounts for deletion */
+  LWLockAcquire(passwordpolicy_lock_accounts, LW_EXCLUSIVE);
   passwordpolicy_hash_accounts_soft_delete();
   LWLockRelease(passwordpolicy_lock_accounts);
 
@@ -84,12 +268,13 @@ void passwordpolicy_hash_accounts_load(void)
   if (guc_passwordpolicy_lock_all_accounts)
   {
     ereport(DEBUG3, (errmsg("passwordpolicy: reading accounts from pg_user")));
-    appendStringInfo(&buf, "SELECT usename FROM pg_user ORDER BY usename");
+    appendStringInfo(&buf, "SELECT usesysid, usename FROM pg_user ORDER BY usename");
   }
   else
   {
     ereport(DEBUG3, (errmsg("passwordpolicy: reading accounts from passwordpolicy.accounts_lockable")));
-    appendStringInfo(&buf, "SELECT usename FROM passwordpolicy.accounts_lockable ORDER BY usename");
+    appendStringInfo(&buf, "SELECT u.usesysid, u.usename FROM passwordpolicy.accounts_lockable l "
+                           "JOIN pg_user u ON u.usename = l.usename ORDER BY u.usename");
   }
 
   ret = SPI_execute(buf.data, true, 0);
@@ -104,17 +289,23 @@ void passwordpolicy_hash_accounts_load(void)
 
   pgstat_report_activity(STATE_RUNNING, "passwordpolicy adding accounts");
 
-  /* Add accounts: we don't need an exclusive lock, existing entries don't change address */
-  LWLockAcquire(passwordpolicy_lock_accounts, LW_SHARED);
+  /* Add accounts: exclusive lock only against other writers, logins don't take it */
+  LWLockAcquire(passwordpolicy_lock_accounts, LW_EXCLUSIVE);
   for (i = 0; i < SPI_processed; i++)
   {
-    passwordpolicy_hash_accounts_add(SPI_getvalue(tuptable->vals[i], tupdesc, 1));
+    if (passwordpolicy_hash_accounts_add(DatumGetObjectId(SPI_getbinval(tuptable->vals[i], tupdesc, 1, &isnull)),
+                                         SPI_getvalue(tuptable->vals[i], tupdesc, 2)) == NULL)
+    {
+      ereport(ERROR, (errcode(ERRCODE_OUT_OF_MEMORY),
+                      errmsg("passwordpolicy: not enough shared memory to add accounts to auth lock"),
+                      errhint("increase the value of password_policy_lock.max_number_accounts")));
+    }
   }
-  LWLockRelease(passwordpolicy_lock_accounts);
 
   pgstat_report_activity(STATE_RUNNING, "passwordpolicy hard-deleting accounts");
   /* mark as deleted entries not present */
   passwordpolicy_hash_accounts_hard_delete();
+  LWLockRelease(passwordpolicy_lock_accounts);
 
 error:
   SPI_finish();
@@ -124,36 +315,117 @@ error:
   pgstat_report_activity(STATE_IDLE, NULL);
 }
 
-/* PRIVATE FUNCTIONS */
-void passwordpolicy_hash_accounts_add(const char *username)
+Size passwordpolicy_hash_accounts_memsize(void)
 {
-  bool found;
-  PasswordPolicyAccount *entry;
+  return mul_size(passwordpolicy_hash_accounts_slots(), sizeof(PasswordPolicyAccountPadded));
+}
 
-  if (username == NULL)
+/*
+ * @brief Add, rename or remove one account after a role change, the caller is connected to SPI
+ **/
+void passwordpolicy_hash_accounts_refresh(Oid roleid)
+{
+  int ret;
+  char *query, *usename;
+  Datum params[1];
+
+  if (!OidIsValid(roleid))
     return;
 
-  entry = (PasswordPolicyAccount *)hash_search(passwordpolicy_hash_accounts, username, HASH_ENTER_NULL, &found);
-  if (found)
+  if (guc_passwordpolicy_lock_all_accounts)
+    query = "SELECT usename FROM pg_user WHERE usesysid = $1";
+  else
+    query = "SELECT u.usename FROM passwordpolicy.accounts_lockable l "
+            "JOIN pg_user u ON u.usename = l.usename WHERE u.usesysid = $1";
+
+  params[0] = ObjectIdGetDatum(roleid);
+  ret = SPI_execute_with_args(query, 1, (Oid[]){OIDOID}, params, NULL, true, 1);
+  if (ret != SPI_OK_SELECT)
   {
-    pg_atomic_write_u64(&(entry->deleted), 0);
+    ereport(ERROR, (errmsg("passwordpolicy: failed to read account '%u'", roleid)));
     return;
   }
 
-  if (entry == NULL)
+  if (SPI_processed == 0)
   {
-    ereport(ERROR, (errcode(ERRCODE_OUT_OF_MEMORY),
-                    errmsg("passwordpolicy: not enough shared memory to add accounts to auth lock"),
-                    errhint("increase the value of password_policy_lock.max_number_accounts")));
+    passwordpolicy_hash_accounts_remove(roleid);
     return;
   }
 
-  ereport(DEBUG3, (errmsg("passwordpolicy: adding account '%s' to auth lock", username)));
-  pg_atomic_init_u64(&(entry->failures), 0);
-  pg_atomic_init_u64(&(entry->last_failure), 0);
-  pg_atomic_init_u64(&(entry->deleted), 0);
-  /* add key the last to avoid reading uninitialized values */
-  strncpy(entry->key, username, NAMEDATALEN);
+  usename = SPI_getvalue(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1);
+
+  LWLockAcquire(passwordpolicy_lock_accounts, LW_EXCLUSIVE);
+  /* on-demand: the accounts are added by the logins, only renames are applied */
+  if (!(guc_passwordpolicy_lock_all_accounts && guc_passwordpolicy_lock_on_demand) ||
+      passwordpolicy_hash_accounts_find(roleid) != NULL)
+  {
+    if (passwordpolicy_hash_accounts_add(roleid, usename) == NULL)
+      ereport(LOG, (errmsg("passwordpolicy: no free slot to add account '%s' to auth lock", usename),
+                    errhint("increase the value of password_policy_lock.max_number_accounts")));
+  }
+  LWLockRelease(passwordpolicy_lock_accounts);
+}
+
+/*
+ * @brief Stop tracking an account
+ **/
+void passwordpolicy_hash_accounts_remove(Oid roleid)
+{
+  PasswordPolicyAccount *entry;
+
+  LWLockAcquire(passwordpolicy_lock_accounts, LW_EXCLUSIVE);
+  entry = passwordpolicy_hash_accounts_find(roleid);
+  if (entry != NULL)
+  {
+    ereport(DEBUG3, (errmsg("passwordpolicy: removed account '%s' from auth lock", NameStr(entry->usename))));
+    pg_atomic_write_u32(&(entry->deleted), 1);
+    passwordpolicy_shm->accounts_used--;
+  }
+  LWLockRelease(passwordpolicy_lock_accounts);
+}
+
+/* PRIVATE FUNCTIONS */
+/*
+ * @brief Delete an idle account in the probe window of roleid, clock (second chance) order
+ * @return true if an account was deleted
+ **/
+bool passwordpolicy_hash_accounts_evict(Oid roleid)
+{
+  int pass;
+  uint32 i, idx;
+  TimestampTz now;
+  PasswordPolicyAccount *entry;
+
+  now = GetCurrentTimestamp();
+  for (pass = 0; pass < 2; pass++)
+  {
+    idx = murmurhash32(roleid) & passwordpolicy_hash_accounts_mask;
+    for (i = 0; i < PASSWORDPOLICY_ACCOUNT_PROBES; i++)
+    {
+      entry = &(passwordpolicy_hash_accounts[idx].account);
+      idx = (idx + 1) & passwordpolicy_hash_accounts_mask;
+      if (pg_atomic_read_u32(&(entry->roleid)) == InvalidOid)
+        break;
+      if (pg_atomic_read_u32(&(entry->deleted)) == 1)
+        continue;
+      /* second chance for accounts with recent failures */
+      if (pg_atomic_read_u32(&(entry->usage)) != 0)
+      {
+        pg_atomic_write_u32(&(entry->usage), 0);
+        continue;
+      }
+      /* never forget a soft-locked account, it would unlock it */
+      if (passwordpolicy_hash_accounts_locked(entry, now))
+        continue;
+
+      ereport(DEBUG3, (errmsg("passwordpolicy: evicting account '%s' from auth lock", NameStr(entry->usename))));
+      pg_atomic_write_u32(&(entry->deleted), 1);
+      passwordpolicy_shm->accounts_used--;
+      return true;
+    }
+  }
+
+  return false;
 }
 
 /*
@@ -161,32 +433,86 @@ void passwordpolicy_hash_accounts_add(const char *username)
  **/
 void passwordpolicy_hash_accounts_hard_delete(void)
 {
-  HASH_SEQ_STATUS hash_seq;
+  uint32 i;
   PasswordPolicyAccount *entry;
 
-  hash_seq_init(&hash_seq, passwordpolicy_hash_accounts);
-  while ((entry = (PasswordPolicyAccount *)hash_seq_search(&hash_seq)) != NULL)
+  for (i = 0; i <= passwordpolicy_hash_accounts_mask; i++)
   {
-    if (pg_atomic_read_u64(&(entry->deleted)) == 2)
+    entry = &(passwordpolicy_hash_accounts[i].account);
+    if (pg_atomic_read_u32(&(entry->roleid)) == InvalidOid)
+      continue;
+    if (pg_atomic_read_u32(&(entry->deleted)) == 2)
     {
-      ereport(DEBUG3, (errmsg("passwordpolicy: (soft) removed account '%s' from auth lock", entry->key)));
-      pg_atomic_write_u64(&(entry->deleted), 1);
+      ereport(DEBUG3, (errmsg("passwordpolicy: (soft) removed account '%s' from auth lock", NameStr(entry->usename))));
+      pg_atomic_write_u32(&(entry->deleted), 1);
+      passwordpolicy_shm->accounts_used--;
     }
   }
 }
 
+/*
+ * @brief Check if an account is soft-locked, with the number of failures of its profile
+ **/
+bool passwordpolicy_hash_accounts_locked(PasswordPolicyAccount *entry, TimestampTz now)
+{
+  PasswordPolicyProfile profile;
+
+  passwordpolicy_profiles_resolve(pg_atomic_read_u32(&(entry->roleid)), &profile);
+  return profile.lock_after > 0 && passwordpolicy_ratelimit_locked(entry, NameStr(entry->usename), now, profile.lock_after);
+}
+
+/*
+ * @brief Number of slots of the accounts table, a power of 2 at least twice the accounts
+ **/
+uint32 passwordpolicy_hash_accounts_slots(void)
+{
+  return pg_nextpower2_32(Max(Min(guc_passwordpolicy_lock_max_num_accounts, PG_INT32_MAX / 4) * 2,
+                              PASSWORDPOLICY_ACCOUNT_PROBES));
+}
+
 /*
  * @brief Mark all the active entries as candidate to soft-deletion (2)
  **/
 void passwordpolicy_hash_accounts_soft_delete(void)
 {
-  HASH_SEQ_STATUS hash_seq;
+  uint32 i;
   PasswordPolicyAccount *entry;
 
-  hash_seq_init(&hash_seq, passwordpolicy_hash_accounts);
-  while ((entry = (PasswordPolicyAccount *)hash_seq_search(&hash_seq)) != NULL)
+  for (i = 0; i <= passwordpolicy_hash_accounts_mask; i++)
   {
-    if (pg_atomic_read_u64(&(entry->deleted)) == 0)
-      pg_atomic_write_u64(&(entry->deleted), 2);
+    entry = &(passwordpolicy_hash_accounts[i].account);
+    if (pg_atomic_read_u32(&(entry->roleid)) == InvalidOid)
+      continue;
+    if (pg_atomic_read_u32(&(entry->deleted)) == 0)
+      pg_atomic_write_u32(&(entry->deleted), 2);
   }
-}
\ No newline at end of file
+}
+
+/*
+ * @brief Clock sweep: delete the accounts without failures since the previous sweep
+ **/
+void passwordpolicy_hash_accounts_sweep(void)
+{
+  uint32 i;
+  TimestampTz now;
+  PasswordPolicyAccount *entry;
+
+  now = GetCurrentTimestamp();
+  for (i = 0; i <= passwordpolicy_hash_accounts_mask; i++)
+  {
+    entry = &(passwordpolicy_hash_accounts[i].account);
+    if (pg_atomic_read_u32(&(entry->roleid)) == InvalidOid || pg_atomic_read_u32(&(entry->deleted)) == 1)
+      continue;
+    if (pg_atomic_read_u32(&(entry->usage)) != 0)
+    {
+      pg_atomic_write_u32(&(entry->usage), 0);
+      continue;
+    }
+    if (passwordpolicy_hash_accounts_locked(entry, now))
+      continue;
+
+    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' without recent failures removed from auth lock", NameStr(entry->usename))));
+    pg_atomic_write_u32(&(entry->deleted), 1);
+    passwordpolicy_shm->accounts_used--;
+  }
+}
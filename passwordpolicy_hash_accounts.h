@@ -14,7 +14,15 @@
 
 #include <postgres.h>
 
+#include "passwordpolicy_vars.h"
+
+extern PGDLLEXPORT PasswordPolicyAccount *passwordpolicy_hash_accounts_add(Oid roleid, const char *username);
+extern PGDLLEXPORT PasswordPolicyAccount *passwordpolicy_hash_accounts_claim(Oid roleid, const char *username);
+extern PGDLLEXPORT PasswordPolicyAccount *passwordpolicy_hash_accounts_find(Oid roleid);
 extern PGDLLEXPORT void passwordpolicy_hash_accounts_init(void);
 extern PGDLLEXPORT void passwordpolicy_hash_accounts_load(void);
+extern PGDLLEXPORT Size passwordpolicy_hash_accounts_memsize(void);
+extern PGDLLEXPORT void passwordpolicy_hash_accounts_refresh(Oid roleid);
+extern PGDLLEXPORT void passwordpolicy_hash_accounts_remove(Oid roleid);
 
 #endif
@@ -0,0 +1,175 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_hash_addresses.c
+ *      Hash table for Authentication Source Addresses
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_hash_addresses.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#if (PG_VERSION_NUM >= 130000)
+#include <common/hashfn.h>
+#else
+#include <utils/hashutils.h>
+#endif
+#include <port/pg_bitutils.h>
+#include <storage/shmem.h>
+
+#include "passwordpolicy_vars.h"
+
+/*
+ * Source addresses live in a fixed-size open-addressing table keyed by a 64-bit hash of
+ * the address. An address can only be stored in PASSWORDPOLICY_ADDRESS_PROBES consecutive
+ * slots from its home slot; when all of them are in use, the one with the oldest failure
+ * is evicted. Memory is bounded by password_policy_lock.address_max_number.
+ *
+ * Slots are claimed and evicted with a compare and swap of the key, no lock is taken.
+ * A reader racing an eviction could see the counters of the evicted address for a
+ * moment, this only affects one attempt and it's accepted to keep the login path free
+ * of locks.
+ */
+#define PASSWORDPOLICY_ADDRESS_PROBES 8
+#define PASSWORDPOLICY_ADDRESS_SEED UINT64CONST(0x7061737377706f6c)
+
+StaticAssertDecl(sizeof(PasswordPolicyAddress) <= PG_CACHE_LINE_SIZE,
+                 "PasswordPolicyAddress must fit in a cache line");
+
+/* Private functions forward declaration */
+uint64 passwordpolicy_hash_addresses_key(const SockAddr *raddr);
+uint32 passwordpolicy_hash_addresses_slots(void);
+
+PasswordPolicyAddress *passwordpolicy_hash_addresses_find(const SockAddr *raddr, bool claim)
+{
+  return passwordpolicy_hash_addresses_find_key(passwordpolicy_hash_addresses_key(raddr), claim);
+}
+
+PasswordPolicyAddress *passwordpolicy_hash_addresses_find_key(uint64 key, bool claim)
+{
+  uint32 i, idx;
+  uint64 slot_key;
+  TimestampTz oldest_failure, slot_failure;
+  PasswordPolicyAddress *entry, *oldest;
+
+  if (key == 0)
+    return NULL;
+
+  oldest = NULL;
+  oldest_failure = 0;
+  idx = (uint32)key & passwordpolicy_hash_addresses_mask;
+  for (i = 0; i < PASSWORDPOLICY_ADDRESS_PROBES; i++)
+  {
+    entry = &(passwordpolicy_hash_addresses[idx].address);
+    slot_key = pg_atomic_read_u64(&(entry->key));
+    if (slot_key == key)
+      return entry;
+
+    if (claim)
+    {
+      if (slot_key == 0)
+      {
+        if (pg_atomic_compare_exchange_u64(&(entry->key), &slot_key, key))
+        {
+          ereport(DEBUG3, (errmsg("passwordpolicy: tracking new source address in slot '%u'", idx)));
+          return entry;
+        }
+        /* somebody else claimed the slot, maybe for the same address */
+        if (slot_key == key)
+          return entry;
+      }
+
+      slot_failure = pg_atomic_read_u64(&(entry->last_failure));
+      if (oldest == NULL || slot_failure < oldest_failure)
+      {
+        oldest = entry;
+        oldest_failure = slot_failure;
+      }
+    }
+
+    idx = (idx + 1) & passwordpolicy_hash_addresses_mask;
+  }
+
+  if (oldest == NULL)
+    return NULL;
+
+  /* evict the address with the oldest failure, give up if it changed meanwhile */
+  slot_key = pg_atomic_read_u64(&(oldest->key));
+  if (!pg_atomic_compare_exchange_u64(&(oldest->key), &slot_key, key))
+    return NULL;
+
+  ereport(DEBUG3, (errmsg("passwordpolicy: source address evicted from address table")));
+  pg_atomic_write_u64(&(oldest->failures), 0);
+  pg_atomic_write_u64(&(oldest->last_failure), 0);
+
+  return oldest;
+}
+
+void passwordpolicy_hash_addresses_init(void)
+{
+  bool found;
+  uint32 i;
+  PasswordPolicyAddress *entry;
+
+  passwordpolicy_hash_addresses_mask = passwordpolicy_hash_addresses_slots() - 1;
+
+  passwordpolicy_hash_addresses = ShmemInitStruct("passwordpolicy hash addresses",
+                                                  passwordpolicy_hash_addresses_memsize(), &found);
+  if (found)
+    return;
+
+  for (i = 0; i <= passwordpolicy_hash_addresses_mask; i++)
+  {
+    entry = &(passwordpolicy_hash_addresses[i].address);
+    pg_atomic_init_u64(&(entry->key), 0);
+    pg_atomic_init_u64(&(entry->failures), 0);
+    pg_atomic_init_u64(&(entry->last_failure), 0);
+  }
+}
+
+Size passwordpolicy_hash_addresses_memsize(void)
+{
+  return mul_size(passwordpolicy_hash_addresses_slots(), sizeof(PasswordPolicyAddressPadded));
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Hash of the client IP address (without port), 0 for local connections
+ **/
+uint64 passwordpolicy_hash_addresses_key(const SockAddr *raddr)
+{
+  uint64 key;
+
+  switch (raddr->addr.ss_family)
+  {
+  case AF_INET:
+    key = hash_bytes_extended((const unsigned char *)&(((const struct sockaddr_in *)&(raddr->addr))->sin_addr),
+                              sizeof(struct in_addr), PASSWORDPOLICY_ADDRESS_SEED);
+    break;
+  case AF_INET6:
+    key = hash_bytes_extended((const unsigned char *)&(((const struct sockaddr_in6 *)&(raddr->addr))->sin6_addr),
+                              sizeof(struct in6_addr), PASSWORDPOLICY_ADDRESS_SEED);
+    break;
+  default:
+    return 0;
+  }
+
+  /* 0 marks free slots */
+  return key == 0 ? 1 : key;
+}
+
+/*
+ * @brief Number of slots of the addresses table, a power of 2
+ **/
+uint32 passwordpolicy_hash_addresses_slots(void)
+{
+  return pg_nextpower2_32(Max(Min(guc_passwordpolicy_lock_address_max_num, PG_INT32_MAX / 2),
+                              PASSWORDPOLICY_ADDRESS_PROBES));
+}
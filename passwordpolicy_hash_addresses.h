@@ -0,0 +1,25 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_hash_addresses.h
+ *      Hash table for Authentication Source Addresses
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_HASH_ADDRESSES_H_
+#define _PASSWORDPOLICY_HASH_ADDRESSES_H_
+
+#include <postgres.h>
+#include <libpq/pqcomm.h>
+
+#include "passwordpolicy_vars.h"
+
+extern PGDLLEXPORT PasswordPolicyAddress *passwordpolicy_hash_addresses_find(const SockAddr *raddr, bool claim);
+extern PGDLLEXPORT PasswordPolicyAddress *passwordpolicy_hash_addresses_find_key(uint64 key, bool claim);
+extern PGDLLEXPORT void passwordpolicy_hash_addresses_init(void);
+extern PGDLLEXPORT Size passwordpolicy_hash_addresses_memsize(void);
+
+#endif
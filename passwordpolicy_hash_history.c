@@ -13,196 +13,600 @@
 #include "passwordpolicy_hash_history.h"
 
 #include <access/xact.h>
+#include <catalog/pg_authid.h>
+#include <catalog/pg_type.h>
 #include <executor/spi.h>
 #include <pgstat.h>
 #include <storage/shmem.h>
+#include <utils/acl.h>
+#include <utils/array.h>
 #include <utils/builtins.h>
+#include <utils/memutils.h>
 #include <utils/guc.h>
 #include <utils/hsearch.h>
 #include <utils/snapmgr.h>
 
 #include "passwordpolicy_vars.h"
 
-void passwordpolicy_hash_history_add(const char *username, const char *password_hash, const TimestampTz changed_at)
+/*
+ * The digests of every account live in a slot of a fixed arena allocated at startup, sized
+ * from password_policy_history.max_number_accounts and max_password_history. Free slots
+ * are chained in a free list, the slot of a dropped role is reused by the next account.
+ *
+ * The new digests of a transaction are appended to a shared queue when it commits, and the
+ * background worker is woken up. It waits password_policy_history.flush_delay for other
+ * commits, and writes all the queued records to the history table in one transaction, with
+ * one upsert and one prune statement: the cost of a flush depends on the number of password
+ * changes, not on the number of accounts. When the queue overflows, the worker writes the
+ * whole history once.
+ *
+ * A digest is written in the ring when the password is checked, so concurrent changes of the
+ * same account see it. The transaction keeps what the write replaced, and puts it back if the
+ * transaction or the subtransaction of the change aborts. A prepared transaction could be
+ * committed by another backend, PREPARE is rejected after a password change.
+ *
+ * Accounts are identified by role Oid, so renaming a role doesn't touch its history. The
+ * password of CREATE ROLE is checked before the role has an Oid, its digest is written in the
+ * ring when the object access hook reports the new role, within the same statement.
+ */
+#define PASSWORDPOLICY_HISTORY_QUEUE_SIZE 1024
+
+StaticAssertDecl((PASSWORDPOLICY_HISTORY_QUEUE_SIZE & (PASSWORDPOLICY_HISTORY_QUEUE_SIZE - 1)) == 0,
+                 "PASSWORDPOLICY_HISTORY_QUEUE_SIZE must be a power of 2");
+
+/* rows read from the history table at a time during the startup */
+#define PASSWORDPOLICY_HISTORY_LOAD_BATCH 1000
+
+/* what the write of a digest changed in the ring of the account, to undo it */
+typedef struct PasswordPolicyHistoryUndo
 {
-  bool found;
-  int i;
-  PasswordPolicyHistory *entry;
-  PasswordPolicyHistoryHash *oldest_hash;
+  bool stored;     /* the digest is in the ring */
+  bool age_bypass; /* the bypass of min_password_age used by the change */
+  bool evicted;    /* the oldest digest of the full ring was overwritten... */
+  PasswordPolicyHistoryRecord oldest; /* ...this one */
+} PasswordPolicyHistoryUndo;
+
+typedef struct PasswordPolicyHistoryPending
+{
+  int nestlevel;
+  PasswordPolicyHistoryRecord record; /* InvalidOid until the role being created is inserted */
+  PasswordPolicyHistoryUndo undo;
+} PasswordPolicyHistoryPending;
+
+/* records of the current transaction, allocated in TopTransactionContext */
+static List *passwordpolicy_hash_history_pending = NIL;
+static bool passwordpolicy_hash_history_callbacks = false;
+
+/* Private functions forward declaration */
+PasswordPolicyHistoryResult passwordpolicy_hash_history_check_store(Oid roleid, uint32 hashcode, const uint8 *digest,
+                                                                    TimestampTz changed_at, int min_age, int depth,
+                                                                    PasswordPolicyHistoryUndo *undo);
+bool passwordpolicy_hash_history_contains(PasswordPolicyHistory *entry, const uint8 *digest, int depth);
+void passwordpolicy_hash_history_enqueue(const PasswordPolicyHistoryRecord *pending);
+void passwordpolicy_hash_history_flush(PasswordPolicyHistoryRecord *records, uint32 num);
+Size passwordpolicy_hash_history_queue_memsize(void);
+void passwordpolicy_hash_history_linearize(PasswordPolicyHistory *entry);
+void passwordpolicy_hash_history_merge(Oid roleid, uint32 hashcode, const uint8 *digest, TimestampTz changed_at);
+PasswordPolicyHistoryPending *passwordpolicy_hash_history_pend(Oid roleid, const uint8 *digest, TimestampTz changed_at);
+void passwordpolicy_hash_history_reverse(PasswordPolicyHistory *entry, uint32 from, uint32 to);
+int32 passwordpolicy_hash_history_slab_alloc(void);
+void passwordpolicy_hash_history_slab_free(int32 slot);
+LWLock *passwordpolicy_hash_history_partition_lock(uint32 hashcode);
+void passwordpolicy_hash_history_store(Oid roleid, uint32 hashcode, const uint8 *digest, TimestampTz changed_at,
+                                       PasswordPolicyHistoryUndo *undo);
+bool passwordpolicy_hash_history_table_ready(void);
+Size passwordpolicy_hash_history_slab_memsize(void);
+Size passwordpolicy_hash_history_slot_size(void);
+void passwordpolicy_hash_history_unstore(const PasswordPolicyHistoryPending *pending);
+static void passwordpolicy_hash_history_subxact_callback(SubXactEvent event, SubTransactionId mySubid,
+                                                         SubTransactionId parentSubid, void *arg);
+static void passwordpolicy_hash_history_xact_callback(XactEvent event, void *arg);
+
+/*
+ * @brief Add a digest to the history of the account, it's written to the table after the commit
+ * and removed from the ring if the change aborts
+ * @param roleid: InvalidOid for a role being created, its digest is added once the role is inserted
+ * @param min_age: seconds since the newest digest of the account before a new one is accepted, 0 to skip
+ * @param depth: number of the newest digests compared, the history of the profile of the role
+ * @return nothing is added unless PASSWORDPOLICY_HISTORY_ADDED is returned
+ **/
+PasswordPolicyHistoryResult passwordpolicy_hash_history_add(Oid roleid, const char *username, const uint8 *digest,
+                                                            const TimestampTz changed_at, int min_age, int depth)
+{
+  uint32 hashcode;
+  LWLock *partition_lock;
+  PasswordPolicyHistoryPending *pending;
+  PasswordPolicyHistoryResult result;
 
   if (username == NULL)
-    return;
+    return PASSWORDPOLICY_HISTORY_ADDED;
 
-  entry = (PasswordPolicyHistory *)hash_search(passwordpolicy_hash_history, username, HASH_ENTER_NULL, &found);
-  if (entry == NULL)
+  /* pending before the ring is written, an abort always finds what to undo */
+  pending = passwordpolicy_hash_history_pend(roleid, digest, changed_at);
+  if (!OidIsValid(roleid))
+    return PASSWORDPOLICY_HISTORY_ADDED;
+
+  hashcode = get_hash_value(passwordpolicy_hash_history, &roleid);
+  partition_lock = passwordpolicy_hash_history_partition_lock(hashcode);
+
+  /* the check and the add are atomic for the account, other accounts use other partitions */
+  LWLockAcquire(partition_lock, LW_EXCLUSIVE);
+  result = passwordpolicy_hash_history_check_store(roleid, hashcode, digest, changed_at, min_age, depth,
+                                                   &(pending->undo));
+  LWLockRelease(partition_lock);
+
+  if (result != PASSWORDPOLICY_HISTORY_ADDED)
   {
-    ereport(ERROR, (errcode(ERRCODE_OUT_OF_MEMORY),
-                    errmsg("passwordpolicy: not enough shared memory to add password history entry"),
-                    errhint("increase the value of password_policy_history.max_number_accounts")));
+    passwordpolicy_hash_history_pending = list_delete_last(passwordpolicy_hash_history_pending);
+    pfree(pending);
+  }
+  return result;
+}
+
+/*
+ * @brief Add the digests of many accounts, taking the lock of every partition once
+ * The entries of the same account are checked in their order, the result of every entry is set.
+ * The added entries are pending as the ones of passwordpolicy_hash_history_add, a change that
+ * isn't applied is undone with passwordpolicy_hash_history_discard.
+ **/
+void passwordpolicy_hash_history_add_batch(PasswordPolicyHistoryBatchEntry *entries, int num, const TimestampTz changed_at)
+{
+  int i, partition;
+  uint32 *hashcodes;
+  LWLock *partition_lock;
+  ListCell *lc;
+  PasswordPolicyHistoryPending *pending, **pendings;
+
+  if (num == 0)
     return;
+
+  hashcodes = (uint32 *)palloc(num * sizeof(uint32));
+  pendings = (PasswordPolicyHistoryPending **)palloc(num * sizeof(PasswordPolicyHistoryPending *));
+  for (i = 0; i < num; i++)
+  {
+    hashcodes[i] = get_hash_value(passwordpolicy_hash_history, &(entries[i].roleid));
+    pendings[i] = passwordpolicy_hash_history_pend(entries[i].roleid, entries[i].digest, changed_at);
   }
 
-  if (!found)
+  for (partition = 0; partition < PASSWORDPOLICY_HISTORY_PARTITIONS; partition++)
   {
-    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' without password history", username)));
-    strncpy(entry->key, username, NAMEDATALEN);
-    entry->hashes = (PasswordPolicyHistoryHash *)ShmemAlloc(mul_size(guc_passwordpolicy_history_max_num_entries, sizeof(PasswordPolicyHistoryHash)));
-    if (!entry->hashes)
-      return;
-    MemSet(entry->hashes, 0, mul_size(guc_passwordpolicy_history_max_num_entries, sizeof(PasswordPolicyHistoryHash)));
+    partition_lock = NULL;
+    for (i = 0; i < num; i++)
+    {
+      if (hashcodes[i] % PASSWORDPOLICY_HISTORY_PARTITIONS != partition)
+        continue;
+      if (partition_lock == NULL)
+      {
+        partition_lock = passwordpolicy_hash_history_partition_lock(hashcodes[i]);
+        LWLockAcquire(partition_lock, LW_EXCLUSIVE);
+      }
+      entries[i].result = passwordpolicy_hash_history_check_store(entries[i].roleid, hashcodes[i], entries[i].digest,
+                                                                  changed_at, entries[i].min_age, entries[i].depth,
+                                                                  &(pendings[i]->undo));
+    }
+    if (partition_lock != NULL)
+      LWLockRelease(partition_lock);
   }
 
-  oldest_hash = NULL;
-  for (i = 0; i < guc_passwordpolicy_history_max_num_entries; i++)
+  /* the rejected entries are not pending, they are the only ones not in a ring */
+  foreach (lc, passwordpolicy_hash_history_pending)
   {
-    if (entry->hashes[i].changed_at == 0)
+    pending = (PasswordPolicyHistoryPending *)lfirst(lc);
+    if (OidIsValid(pending->record.roleid) && !pending->undo.stored)
     {
-      entry->hashes[i].changed_at = changed_at;
-      strcpy(entry->hashes[i].password_hash, password_hash);
-      ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' password history set in '%d' '%ld'",
-                              username, i, changed_at)));
-      return;
+      passwordpolicy_hash_history_pending = foreach_delete_current(passwordpolicy_hash_history_pending, lc);
+      pfree(pending);
     }
-    else
+  }
+  pfree(pendings);
+  pfree(hashcodes);
+}
+
+/*
+ * @brief Undo a change of passwordpolicy_hash_history_add_batch that wasn't applied
+ **/
+void passwordpolicy_hash_history_discard(Oid roleid, const uint8 *digest, TimestampTz changed_at)
+{
+  ListCell *lc;
+  PasswordPolicyHistoryPending *pending;
+
+  foreach (lc, passwordpolicy_hash_history_pending)
+  {
+    pending = (PasswordPolicyHistoryPending *)lfirst(lc);
+    if (pending->record.roleid == roleid && pending->record.changed_at == changed_at &&
+        memcmp(pending->record.digest, digest, sizeof(PasswordPolicyHistoryDigest)) == 0)
     {
-      if (oldest_hash == NULL || oldest_hash->changed_at > entry->hashes[i].changed_at)
-        oldest_hash = &(entry->hashes[i]);
+      passwordpolicy_hash_history_unstore(pending);
+      passwordpolicy_hash_history_pending = foreach_delete_current(passwordpolicy_hash_history_pending, lc);
+      pfree(pending);
+      return;
     }
   }
+}
+
+/*
+ * @brief Keep a record of the current transaction, queued for the history table when it commits
+ * @param roleid: InvalidOid for a role being created, set by passwordpolicy_hash_history_object_access
+ * @return the record, its undo is set when the digest is written in the ring
+ **/
+PasswordPolicyHistoryPending *passwordpolicy_hash_history_pend(Oid roleid, const uint8 *digest, TimestampTz changed_at)
+{
+  MemoryContext oldcontext;
+  PasswordPolicyHistoryPending *pending;
 
-  if (oldest_hash)
+  if (!passwordpolicy_hash_history_callbacks)
   {
-    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' password history overwritting '%s' '%ld'",
-                            username, oldest_hash->password_hash, oldest_hash->changed_at)));
-    oldest_hash->changed_at = changed_at;
-    strcpy(oldest_hash->password_hash, password_hash);
+    RegisterXactCallback(passwordpolicy_hash_history_xact_callback, NULL);
+    RegisterSubXactCallback(passwordpolicy_hash_history_subxact_callback, NULL);
+    passwordpolicy_hash_history_callbacks = true;
   }
+
+  oldcontext = MemoryContextSwitchTo(TopTransactionContext);
+  pending = (PasswordPolicyHistoryPending *)palloc0(sizeof(PasswordPolicyHistoryPending));
+  pending->nestlevel = GetCurrentTransactionNestLevel();
+  pending->record.roleid = roleid;
+  memcpy(pending->record.digest, digest, sizeof(PasswordPolicyHistoryDigest));
+  pending->record.changed_at = changed_at;
+  passwordpolicy_hash_history_pending = lappend(passwordpolicy_hash_history_pending, pending);
+  MemoryContextSwitchTo(oldcontext);
+
+  return pending;
 }
 
-bool passwordpolicy_hash_history_exists(const char *username, const char *password_hash)
+/*
+ * @brief Allow the next password change of the account before min_password_age
+ * @return false if the account doesn't have password history
+ **/
+bool passwordpolicy_hash_history_bypass_age(Oid roleid)
 {
   bool found;
-  int i;
+  uint32 hashcode;
+  LWLock *partition_lock;
   PasswordPolicyHistory *entry;
 
-  if (username == NULL)
-    return false;
+  hashcode = get_hash_value(passwordpolicy_hash_history, &roleid);
+  partition_lock = passwordpolicy_hash_history_partition_lock(hashcode);
+  LWLockAcquire(partition_lock, LW_EXCLUSIVE);
+  entry = (PasswordPolicyHistory *)hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode,
+                                                               HASH_FIND, &found);
+  if (found)
+    entry->age_bypass = true;
+  LWLockRelease(partition_lock);
 
-  entry = (PasswordPolicyHistory *)hash_search(passwordpolicy_hash_history, username, HASH_FIND, &found);
-  if (!found)
+  return found;
+}
+
+/*
+ * @brief Write a digest in the ring of the account, without queueing it
+ * The caller holds the partition lock of the account in exclusive mode
+ * @param undo: set to what the write changed, NULL if it's never undone
+ **/
+void passwordpolicy_hash_history_store(Oid roleid, uint32 hashcode, const uint8 *digest, const TimestampTz changed_at,
+                                       PasswordPolicyHistoryUndo *undo)
+{
+  bool found;
+  uint32 pos;
+  PasswordPolicyHistory *entry;
+
+  entry = (PasswordPolicyHistory *)hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode,
+                                                               HASH_ENTER_NULL, &found);
+  if (entry == NULL)
   {
-    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' without password history", username)));
-    return false;
+    ereport(ERROR, (errcode(ERRCODE_OUT_OF_MEMORY),
+                    errmsg("passwordpolicy: not enough shared memory to add password history entry"),
+                    errhint("increase the value of password_policy_history.max_number_accounts")));
+    return;
   }
 
-  ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' with password history", username)));
+  if (!found)
+  {
+    ereport(DEBUG3, (errmsg("passwordpolicy: account '%u' without password history", roleid)));
+    entry->slot = passwordpolicy_hash_history_slab_alloc();
+    if (entry->slot < 0)
+    {
+      hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode, HASH_REMOVE, NULL);
+      ereport(ERROR, (errcode(ERRCODE_OUT_OF_MEMORY),
+                      errmsg("passwordpolicy: no free password history slot for account '%u'", roleid),
+                      errhint("increase the value of password_policy_history.max_number_accounts")));
+      return;
+    }
+    entry->head = 0;
+    entry->count = 0;
+    entry->age_bypass = false;
+    entry->digests = (PasswordPolicyHistoryDigest *)(passwordpolicy_history_slab_data +
+                                                     entry->slot * passwordpolicy_hash_history_slot_size());
+    entry->changed_at = (TimestampTz *)(entry->digests + guc_passwordpolicy_history_max_num_entries);
+  }
 
-  for (i = 0; i < guc_passwordpolicy_history_max_num_entries; i++)
+  /* overwrite the oldest digest once the ring is full */
+  pos = entry->head;
+  if (undo != NULL)
   {
-    if (entry->hashes[i].changed_at != 0)
+    undo->age_bypass = entry->age_bypass;
+    undo->evicted = (entry->count == (uint32)guc_passwordpolicy_history_max_num_entries);
+    if (undo->evicted)
     {
-      if (strcmp(password_hash, entry->hashes[i].password_hash) == 0)
-        return true;
+      undo->oldest.roleid = roleid;
+      memcpy(undo->oldest.digest, entry->digests[pos], sizeof(PasswordPolicyHistoryDigest));
+      undo->oldest.changed_at = entry->changed_at[pos];
     }
   }
 
-  ereport(DEBUG3, (errmsg("passwordpolicy: password hash for account '%s' doesn't exist", username)));
+  /* a bypass is only valid for one change */
+  entry->age_bypass = false;
 
-  return false;
+  memcpy(entry->digests[pos], digest, sizeof(PasswordPolicyHistoryDigest));
+  entry->changed_at[pos] = changed_at;
+  entry->head = (pos + 1 == (uint32)guc_passwordpolicy_history_max_num_entries) ? 0 : pos + 1;
+  if (entry->count < (uint32)guc_passwordpolicy_history_max_num_entries)
+    entry->count++;
+  if (undo != NULL)
+    undo->stored = true;
+  ereport(DEBUG3, (errmsg("passwordpolicy: account '%u' password history set in '%u' '" INT64_FORMAT "'",
+                          roleid, pos, changed_at)));
+}
+
+/*
+ * @brief Forget the password history of a dropped role, the caller is connected to SPI
+ **/
+void passwordpolicy_hash_history_drop(Oid roleid)
+{
+  bool found;
+  int ret;
+  uint32 hashcode;
+  Datum params[1];
+  LWLock *partition_lock;
+  PasswordPolicyHistory *entry;
+
+  if (!OidIsValid(roleid))
+    return;
+
+  params[0] = ObjectIdGetDatum(roleid);
+  ret = SPI_execute_with_args("DELETE FROM passwordpolicy.accounts_password_history WHERE roleid = $1",
+                              1, (Oid[]){OIDOID}, params, NULL, false, 0);
+  if (ret != SPI_OK_DELETE)
+  {
+    ereport(ERROR, (errmsg("passwordpolicy: failed to delete password history for removed role '%u'", roleid)));
+    return;
+  }
+
+  hashcode = get_hash_value(passwordpolicy_hash_history, &roleid);
+  partition_lock = passwordpolicy_hash_history_partition_lock(hashcode);
+  LWLockAcquire(partition_lock, LW_EXCLUSIVE);
+  entry = (PasswordPolicyHistory *)hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode,
+                                                               HASH_FIND, &found);
+  if (found)
+  {
+    passwordpolicy_hash_history_slab_free(entry->slot);
+    hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode, HASH_REMOVE, NULL);
+  }
+  LWLockRelease(partition_lock);
+}
+
+/*
+ * @brief Check if the digest is one of the newest depth digests of the account, read only
+ **/
+bool passwordpolicy_hash_history_exists(Oid roleid, const uint8 *digest, int depth)
+{
+  bool found, exists;
+  uint32 hashcode;
+  LWLock *partition_lock;
+  PasswordPolicyHistory *entry;
+
+  if (!OidIsValid(roleid))
+    return false;
+
+  hashcode = get_hash_value(passwordpolicy_hash_history, &roleid);
+  partition_lock = passwordpolicy_hash_history_partition_lock(hashcode);
+  LWLockAcquire(partition_lock, LW_SHARED);
+  entry = (PasswordPolicyHistory *)hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode,
+                                                               HASH_FIND, &found);
+  exists = found && passwordpolicy_hash_history_contains(entry, digest, depth);
+  LWLockRelease(partition_lock);
+
+  if (!found)
+    ereport(DEBUG3, (errmsg("passwordpolicy: account '%u' without password history", roleid)));
+  else if (!exists)
+    ereport(DEBUG3, (errmsg("passwordpolicy: password hash for account '%u' doesn't exist", roleid)));
+
+  return exists;
 }
 
 void passwordpolicy_hash_history_init(void)
 {
+  bool found;
+  uint32 i;
   HASHCTL info;
 
-  info.keysize = sizeof(PasswordPolicyAccountKey);
+  passwordpolicy_history_slab = ShmemInitStruct("passwordpolicy history slab",
+                                                passwordpolicy_hash_history_slab_memsize(), &found);
+  passwordpolicy_history_slab_data = (char *)passwordpolicy_history_slab +
+                                     MAXALIGN(offsetof(PasswordPolicyHistorySlab, next_free) +
+                                              mul_size(guc_passwordpolicy_history_max_num_accounts, sizeof(int32)));
+  if (!found)
+  {
+    SpinLockInit(&(passwordpolicy_history_slab->mutex));
+    passwordpolicy_history_slab->num_slots = guc_passwordpolicy_history_max_num_accounts;
+    passwordpolicy_history_slab->used = 0;
+    passwordpolicy_history_slab->free_head = 0;
+    for (i = 0; i < passwordpolicy_history_slab->num_slots; i++)
+      passwordpolicy_history_slab->next_free[i] = (i + 1 < passwordpolicy_history_slab->num_slots) ? (int32)(i + 1) : -1;
+  }
+
+  passwordpolicy_history_queue = ShmemInitStruct("passwordpolicy history queue",
+                                                 passwordpolicy_hash_history_queue_memsize(), &found);
+  if (!found)
+  {
+    SpinLockInit(&(passwordpolicy_history_queue->mutex));
+    passwordpolicy_history_queue->head = 0;
+    passwordpolicy_history_queue->tail = 0;
+    passwordpolicy_history_queue->overflow = false;
+  }
+
+  info.keysize = sizeof(Oid);
   info.entrysize = sizeof(PasswordPolicyHistory);
+  info.num_partitions = PASSWORDPOLICY_HISTORY_PARTITIONS;
   passwordpolicy_hash_history = ShmemInitHash("passwordpolicy hash history",
                                               guc_passwordpolicy_history_max_num_accounts,
                                               guc_passwordpolicy_history_max_num_accounts,
-                                              &info,
-#if (PG_VERSION_NUM >= 140000)
-                                              HASH_ELEM | HASH_STRINGS
-#else
-                                              HASH_ELEM
-#endif
-  );
+                                              &info, HASH_ELEM | HASH_BLOBS | HASH_PARTITION);
+}
+
+Size passwordpolicy_hash_history_memsize(void)
+{
+  Size size;
+
+  size = hash_estimate_size(guc_passwordpolicy_history_max_num_accounts, sizeof(PasswordPolicyHistory));
+  size = add_size(size, passwordpolicy_hash_history_slab_memsize());
+  size = add_size(size, passwordpolicy_hash_history_queue_memsize());
+  return size;
+}
+
+/*
+ * @brief Occupancy of the history slab
+ **/
+void passwordpolicy_hash_history_slab_stats(uint32 *num_slots, uint32 *used)
+{
+  SpinLockAcquire(&(passwordpolicy_history_slab->mutex));
+  *num_slots = passwordpolicy_history_slab->num_slots;
+  *used = passwordpolicy_history_slab->used;
+  SpinLockRelease(&(passwordpolicy_history_slab->mutex));
+}
+
+/*
+ * @brief Object access hook, write the digest of the password of a role when it is created
+ * CreateRole checks the password before inserting the role, the last pending record without
+ * Oid is the one of this role. The role isn't visible by name until the next command.
+ **/
+void passwordpolicy_hash_history_object_access(ObjectAccessType access, Oid classId, Oid objectId, int subId, void *arg)
+{
+  uint32 hashcode;
+  LWLock *partition_lock;
+  PasswordPolicyHistoryPending *pending;
+
+  if (passwordpolicy_prev_object_access_hook)
+    passwordpolicy_prev_object_access_hook(access, classId, objectId, subId, arg);
+
+  if (access != OAT_POST_CREATE || classId != AuthIdRelationId || passwordpolicy_hash_history_pending == NIL)
+    return;
+
+  pending = (PasswordPolicyHistoryPending *)llast(passwordpolicy_hash_history_pending);
+  if (OidIsValid(pending->record.roleid))
+    return;
+
+  pending->record.roleid = objectId;
+  hashcode = get_hash_value(passwordpolicy_hash_history, &objectId);
+  partition_lock = passwordpolicy_hash_history_partition_lock(hashcode);
+  LWLockAcquire(partition_lock, LW_EXCLUSIVE);
+  passwordpolicy_hash_history_store(objectId, hashcode, pending->record.digest, pending->record.changed_at,
+                                    &(pending->undo));
+  LWLockRelease(partition_lock);
 }
 
-void passwordpolicy_hash_history_load(void)
+/*
+ * @brief Read the history table, once per start of the server
+ * The table is read with a cursor in batches of PASSWORDPOLICY_HISTORY_LOAD_BATCH rows, the
+ * memory used doesn't depend on the size of the table and each partition lock is only held
+ * while a batch is stored. Passwords changed before the worker started are already in the
+ * rings, the rows of the table are merged with them by change time.
+ * @return false if the history was already in shared memory
+ **/
+bool passwordpolicy_hash_history_load(void)
 {
   bool isnull;
-  char *query;
-  Datum params[1];
-  int ret, i;
-  TimestampTz changed_at;
+  char activity[64];
+  uint32 i, p, num;
+  uint32 *hashcodes;
+  uint64 total;
+  bytea *value;
+  Portal portal;
   TupleDesc tupdesc;
-  SPIPlanPtr plan;
-  SPITupleTable *tuptable;
+  HeapTuple tuple;
+  PasswordPolicyHistoryRecord *records;
+
+  /* restart of the background worker, the shared memory is more recent than the table */
+  if (passwordpolicy_shm->history_loaded)
+    return false;
 
   SetCurrentStatementStartTimestamp();
   StartTransactionCommand();
   SPI_connect();
   PushActiveSnapshot(GetTransactionSnapshot());
 
-  pgstat_report_activity(STATE_RUNNING, "passwordpolicy checking extension");
-
-  ret = SPI_execute("SELECT 1 FROM pg_extension WHERE extname = 'passwordpolicy'", true, 0);
-  if (ret != SPI_OK_SELECT)
-  {
-    ereport(ERROR, (errmsg("passwordpolicy: failed to check if extension is installed")));
+  if (!passwordpolicy_hash_history_table_ready())
     goto error;
-  }
 
-  if (SPI_processed == 0)
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy loading history");
+
+  /* oldest first: the rings keep the newest max_password_history digests of each account */
+  portal = SPI_cursor_open_with_args(NULL,
+                                     "SELECT roleid, password_hash, changed_at "
+                                     "FROM passwordpolicy.accounts_password_history "
+                                     "ORDER BY roleid, changed_at",
+                                     0, NULL, NULL, NULL, true, 0);
+  if (portal == NULL)
   {
-    ereport(DEBUG3, (errmsg("passwordpolicy: extension is not installed, skipping password history")));
+    ereport(ERROR, (errmsg("passwordpolicy: failed to read password history")));
     goto error;
   }
 
-  pgstat_report_activity(STATE_RUNNING, "passwordpolicy reading accounts");
-
-  query = "WITH ranked_history AS ("
-          "  SELECT usename, password_hash, changed_at, "
-          "         ROW_NUMBER() OVER (PARTITION BY usename ORDER BY changed_at DESC) AS row_num "
-          "  FROM passwordpolicy.accounts_password_history "
-          ") "
-          "SELECT usename, password_hash, changed_at "
-          "FROM ranked_history "
-          "WHERE row_num <= $1;";
+  records = (PasswordPolicyHistoryRecord *)palloc(PASSWORDPOLICY_HISTORY_LOAD_BATCH * sizeof(PasswordPolicyHistoryRecord));
+  hashcodes = (uint32 *)palloc(PASSWORDPOLICY_HISTORY_LOAD_BATCH * sizeof(uint32));
+  total = 0;
 
-  plan = SPI_prepare(query, 1, (Oid[]){INT4OID});
-  if (plan == NULL)
+  for (;;)
   {
-    ereport(ERROR, (errmsg("passwordpolicy: failed to prepare password history query")));
-    goto error;
-  }
+    SPI_cursor_fetch(portal, true, PASSWORDPOLICY_HISTORY_LOAD_BATCH);
+    if (SPI_processed == 0)
+      break;
 
-  params[0] = Int32GetDatum(guc_passwordpolicy_history_max_num_entries);
-  ret = SPI_execute_plan(plan, params, NULL, true, 0);
-  if (ret != SPI_OK_SELECT)
-  {
-    ereport(ERROR, (errmsg("passwordpolicy: failed to read password history")));
-    goto error;
-  }
+    /* binary values, nothing is allocated per row */
+    tupdesc = SPI_tuptable->tupdesc;
+    num = 0;
+    for (i = 0; i < SPI_processed; i++)
+    {
+      tuple = SPI_tuptable->vals[i];
 
-  tupdesc = SPI_tuptable->tupdesc;
-  tuptable = SPI_tuptable;
+      /* the columns are NOT NULL */
+      records[num].roleid = DatumGetObjectId(SPI_getbinval(tuple, tupdesc, 1, &isnull));
 
-  pgstat_report_activity(STATE_RUNNING, "passwordpolicy loading history");
+      value = DatumGetByteaPP(SPI_getbinval(tuple, tupdesc, 2, &isnull));
+      if (VARSIZE_ANY_EXHDR(value) != sizeof(PasswordPolicyHistoryDigest))
+      {
+        ereport(LOG, (errmsg("passwordpolicy: ignoring invalid password history hash of account '%u'",
+                             records[num].roleid)));
+        continue;
+      }
+      memcpy(records[num].digest, VARDATA_ANY(value), sizeof(PasswordPolicyHistoryDigest));
 
-  LWLockAcquire(passwordpolicy_lock_history, LW_EXCLUSIVE);
-  passwordpolicy_hash_history_last_save = 0;
-  for (i = 0; i < SPI_processed; i++)
-  {
-    changed_at = DatumGetTimestampTz(SPI_getbinval(tuptable->vals[i], tupdesc, 3, &isnull));
-    passwordpolicy_hash_history_add(SPI_getvalue(tuptable->vals[i], tupdesc, 1),
-                                      SPI_getvalue(tuptable->vals[i], tupdesc, 2),
-                                      changed_at);
-    if (changed_at > passwordpolicy_hash_history_last_save)
-      passwordpolicy_hash_history_last_save = changed_at;
+      records[num].changed_at = DatumGetTimestampTz(SPI_getbinval(tuple, tupdesc, 3, &isnull));
+      hashcodes[num] = get_hash_value(passwordpolicy_hash_history, &(records[num].roleid));
+      num++;
+    }
+    total += SPI_processed;
+    SPI_freetuptable(SPI_tuptable);
+
+    /* one lock acquisition per partition and batch, the order of each account is kept */
+    for (p = 0; p < PASSWORDPOLICY_HISTORY_PARTITIONS; p++)
+    {
+      LWLockAcquire(&(passwordpolicy_lock_history[p].lock), LW_EXCLUSIVE);
+      for (i = 0; i < num; i++)
+      {
+        if (hashcodes[i] % PASSWORDPOLICY_HISTORY_PARTITIONS == p)
+          passwordpolicy_hash_history_merge(records[i].roleid, hashcodes[i], records[i].digest, records[i].changed_at);
+      }
+      LWLockRelease(&(passwordpolicy_lock_history[p].lock));
+    }
+
+    snprintf(activity, sizeof(activity), "passwordpolicy loading history, " UINT64_FORMAT " rows", total);
+    pgstat_report_activity(STATE_RUNNING, activity);
   }
-  LWLockRelease(passwordpolicy_lock_history);
+
+  SPI_cursor_close(portal);
+  pfree(records);
+  pfree(hashcodes);
+  passwordpolicy_shm->history_loaded = true;
+  ereport(DEBUG1, (errmsg("passwordpolicy: password history loaded, " UINT64_FORMAT " rows", total)));
 
 error:
   SPI_finish();
@@ -210,133 +614,599 @@ error:
   CommitTransactionCommand();
   pgstat_report_stat(true);
   pgstat_report_activity(STATE_IDLE, NULL);
+
+  return true;
 }
 
-void passwordpolicy_hash_history_save(void)
+/*
+ * @brief Delete the password history of all the roles that don't exist, the caller is connected to SPI
+ **/
+void passwordpolicy_hash_history_purge(void)
 {
-  char *sql_delete, *sql_insert;
-  Datum params_delete[2], params_insert[3];
+  int ret;
+
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy delete dropped users history");
+  ret = SPI_execute("DELETE FROM passwordpolicy.accounts_password_history h "
+                    "WHERE NOT EXISTS (SELECT 1 FROM pg_roles r WHERE r.oid = h.roleid)",
+                    false, 0);
+  if (ret != SPI_OK_DELETE)
+    ereport(ERROR, (errmsg("passwordpolicy: failed to delete password history for removed users")));
+}
+
+/*
+ * @brief Check if there are records waiting to be written to the history table
+ **/
+bool passwordpolicy_hash_history_queued(void)
+{
+  bool queued;
+
+  SpinLockAcquire(&(passwordpolicy_history_queue->mutex));
+  queued = passwordpolicy_history_queue->overflow ||
+           passwordpolicy_history_queue->head != passwordpolicy_history_queue->tail;
+  SpinLockRelease(&(passwordpolicy_history_queue->mutex));
+
+  return queued;
+}
+
+/*
+ * @brief Write the queued password history records to the history table
+ * @param full: write the whole history, after a restart of the background worker
+ **/
+void passwordpolicy_hash_history_save(bool full)
+{
+  bool overflow, saved = false;
+  uint32 i, num, head, tail;
   HASH_SEQ_STATUS hash_seq;
-  int ret, i, inserted;
   PasswordPolicyHistory *entry;
-  SPIPlanPtr plan_delete, plan_insert;
-  TimestampTz oldest_change, newest_change;
+  PasswordPolicyHistoryRecord *records;
 
+  SpinLockAcquire(&(passwordpolicy_history_queue->mutex));
+  overflow = full || passwordpolicy_history_queue->overflow;
+  /* the rings are read after this point, a new overflow is written by the next save */
+  passwordpolicy_history_queue->overflow = false;
+  tail = passwordpolicy_history_queue->tail;
+  head = passwordpolicy_history_queue->head;
+  num = head - tail;
+  SpinLockRelease(&(passwordpolicy_history_queue->mutex));
+
+  if (!overflow && num == 0)
+    return;
 
   SetCurrentStatementStartTimestamp();
   StartTransactionCommand();
   SPI_connect();
   PushActiveSnapshot(GetTransactionSnapshot());
 
-  pgstat_report_activity(STATE_RUNNING, "passwordpolicy checking extension");
-
   if (strcmp(GetConfigOptionByName("transaction_read_only", NULL, false), "on") == 0)
   {
     ereport(DEBUG3, (errmsg("passwordpolicy: database is in read-only mode, skipping password history")));
     goto error;
   }
-  
-  ret = SPI_execute("SELECT 1 FROM pg_extension WHERE extname = 'passwordpolicy'", true, 0);
-  if (ret != SPI_OK_SELECT)
-  {
-    ereport(ERROR, (errmsg("passwordpolicy: failed to check if extension is installed")));
+
+  if (!passwordpolicy_hash_history_table_ready())
     goto error;
+
+  if (overflow)
+  {
+    pgstat_report_activity(STATE_RUNNING, "passwordpolicy reading all history");
+    for (i = 0; i < PASSWORDPOLICY_HISTORY_PARTITIONS; i++)
+      LWLockAcquire(&(passwordpolicy_lock_history[i].lock), LW_SHARED);
+    records = (PasswordPolicyHistoryRecord *)palloc(mul_size(mul_size(Max(hash_get_num_entries(passwordpolicy_hash_history), 1),
+                                                                      guc_passwordpolicy_history_max_num_entries),
+                                                             sizeof(PasswordPolicyHistoryRecord)));
+    num = 0;
+    hash_seq_init(&hash_seq, passwordpolicy_hash_history);
+    while ((entry = (PasswordPolicyHistory *)hash_seq_search(&hash_seq)) != NULL)
+    {
+      for (i = 0; i < entry->count; i++)
+      {
+        records[num].roleid = entry->roleid;
+        memcpy(records[num].digest, entry->digests[i], sizeof(PasswordPolicyHistoryDigest));
+        records[num].changed_at = entry->changed_at[i];
+        num++;
+      }
+    }
+    for (i = PASSWORDPOLICY_HISTORY_PARTITIONS; i > 0; i--)
+      LWLockRelease(&(passwordpolicy_lock_history[i - 1].lock));
+  }
+  else
+  {
+    /* the records between tail and head are not overwritten until tail advances */
+    records = (PasswordPolicyHistoryRecord *)palloc(mul_size(num, sizeof(PasswordPolicyHistoryRecord)));
+    for (i = 0; i < num; i++)
+      records[i] = passwordpolicy_history_queue->records[(tail + i) & (PASSWORDPOLICY_HISTORY_QUEUE_SIZE - 1)];
   }
 
-  if (SPI_processed == 0)
+  passwordpolicy_hash_history_flush(records, num);
+  pfree(records);
+  saved = true;
+
+error:
+  SPI_finish();
+  PopActiveSnapshot();
+  CommitTransactionCommand();
+  pgstat_report_stat(true);
+  pgstat_report_activity(STATE_IDLE, NULL);
+
+  /* only forget the records once they are committed, the skipped ones are written by the next save */
+  SpinLockAcquire(&(passwordpolicy_history_queue->mutex));
+  if (saved)
+    passwordpolicy_history_queue->tail = head;
+  else if (overflow)
+    passwordpolicy_history_queue->overflow = true;
+  SpinLockRelease(&(passwordpolicy_history_queue->mutex));
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Check a digest against the history of the account and write it in its ring
+ * The caller holds the partition lock of the account in exclusive mode
+ * @return nothing is written unless PASSWORDPOLICY_HISTORY_ADDED is returned
+ **/
+PasswordPolicyHistoryResult passwordpolicy_hash_history_check_store(Oid roleid, uint32 hashcode, const uint8 *digest,
+                                                                    TimestampTz changed_at, int min_age, int depth,
+                                                                    PasswordPolicyHistoryUndo *undo)
+{
+  bool found;
+  uint32 newest;
+  PasswordPolicyHistory *entry;
+
+  entry = (PasswordPolicyHistory *)hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode,
+                                                               HASH_FIND, &found);
+  if (found && min_age > 0 && entry->count > 0 && !entry->age_bypass)
   {
-    ereport(DEBUG3, (errmsg("passwordpolicy: extension is not installed, skipping password history")));
-    goto error;
+    /* the newest digest is just before head */
+    newest = (entry->head == 0) ? entry->count - 1 : entry->head - 1;
+    if (!TimestampDifferenceExceeds(entry->changed_at[newest], changed_at, min_age * 1000))
+      return PASSWORDPOLICY_HISTORY_TOO_RECENT;
   }
+  if (found && passwordpolicy_hash_history_contains(entry, digest, depth))
+    return PASSWORDPOLICY_HISTORY_REUSED;
 
-  pgstat_report_activity(STATE_RUNNING, "passwordpolicy delete dropped users history");
-  ret = SPI_execute("DELETE FROM passwordpolicy.accounts_password_history h "
-                    "WHERE NOT EXISTS (SELECT 1 FROM pg_user u WHERE u.usename = h.usename)",
-                    false, 0);
+  passwordpolicy_hash_history_store(roleid, hashcode, digest, changed_at, undo);
+  return PASSWORDPOLICY_HISTORY_ADDED;
+}
+
+/*
+ * @brief Check if a digest is in the newest depth digests of the ring of the account, the caller
+ * holds its partition lock
+ **/
+bool passwordpolicy_hash_history_contains(PasswordPolicyHistory *entry, const uint8 *digest, int depth)
+{
+  uint32 i, num, pos;
+
+  num = Min((uint32)Max(depth, 0), entry->count);
+  /* newest first, the newest digest is just before head */
+  pos = entry->head;
+  for (i = 0; i < num; i++)
+  {
+    pos = (pos == 0) ? entry->count - 1 : pos - 1;
+    if (memcmp(entry->digests[pos], digest, sizeof(PasswordPolicyHistoryDigest)) == 0)
+      return true;
+  }
+  return false;
+}
+
+/*
+ * @brief Lock of the partition of the password history an account belongs to
+ **/
+LWLock *passwordpolicy_hash_history_partition_lock(uint32 hashcode)
+{
+  return &(passwordpolicy_lock_history[hashcode % PASSWORDPOLICY_HISTORY_PARTITIONS].lock);
+}
+
+/*
+ * @brief Append a record to the queue of changes to write to the history table
+ **/
+void passwordpolicy_hash_history_enqueue(const PasswordPolicyHistoryRecord *pending)
+{
+  SpinLockAcquire(&(passwordpolicy_history_queue->mutex));
+  if (passwordpolicy_history_queue->head - passwordpolicy_history_queue->tail >= PASSWORDPOLICY_HISTORY_QUEUE_SIZE)
+    passwordpolicy_history_queue->overflow = true;
+  else
+  {
+    passwordpolicy_history_queue->records[passwordpolicy_history_queue->head & (PASSWORDPOLICY_HISTORY_QUEUE_SIZE - 1)] = *pending;
+    passwordpolicy_history_queue->head++;
+  }
+  SpinLockRelease(&(passwordpolicy_history_queue->mutex));
+}
+
+/*
+ * @brief Upsert the records and prune the history of their accounts, the caller is connected to SPI
+ **/
+void passwordpolicy_hash_history_flush(PasswordPolicyHistoryRecord *records, uint32 num)
+{
+  int ret;
+  uint32 i;
+  bytea *digest;
+  Datum params[3];
+  Datum *roleids, *digests, *changes;
+
+  if (num == 0)
+    return;
+
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy insert history");
+
+  roleids = (Datum *)palloc(mul_size(num, sizeof(Datum)));
+  digests = (Datum *)palloc(mul_size(num, sizeof(Datum)));
+  changes = (Datum *)palloc(mul_size(num, sizeof(Datum)));
+  for (i = 0; i < num; i++)
+  {
+    roleids[i] = ObjectIdGetDatum(records[i].roleid);
+    digest = (bytea *)palloc(VARHDRSZ + sizeof(PasswordPolicyHistoryDigest));
+    SET_VARSIZE(digest, VARHDRSZ + sizeof(PasswordPolicyHistoryDigest));
+    memcpy(VARDATA(digest), records[i].digest, sizeof(PasswordPolicyHistoryDigest));
+    digests[i] = PointerGetDatum(digest);
+    changes[i] = TimestampTzGetDatum(records[i].changed_at);
+  }
+
+  params[0] = PointerGetDatum(construct_array(roleids, num, OIDOID, sizeof(Oid), true, TYPALIGN_INT));
+  params[1] = PointerGetDatum(construct_array(digests, num, BYTEAOID, -1, false, TYPALIGN_INT));
+  params[2] = PointerGetDatum(construct_array(changes, num, TIMESTAMPTZOID, sizeof(TimestampTz), FLOAT8PASSBYVAL, TYPALIGN_DOUBLE));
+
+  /* a password can be used again once out of the history, keep its last change */
+  ret = SPI_execute_with_args("INSERT INTO passwordpolicy.accounts_password_history "
+                              "(roleid, password_hash, changed_at) "
+                              "SELECT DISTINCT ON (roleid, password_hash) roleid, password_hash, changed_at "
+                              "FROM unnest($1::oid[], $2::bytea[], $3::timestamptz[]) AS r(roleid, password_hash, changed_at) "
+                              "ORDER BY roleid, password_hash, changed_at DESC "
+                              "ON CONFLICT (roleid, password_hash) DO UPDATE SET changed_at = EXCLUDED.changed_at",
+                              3, (Oid[]){OIDARRAYOID, BYTEAARRAYOID, TIMESTAMPTZARRAYOID}, params, NULL, false, 0);
+  if (ret != SPI_OK_INSERT)
+  {
+    ereport(ERROR, (errmsg("passwordpolicy: failed to execute password history insert")));
+    return;
+  }
+
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy delete history");
+
+  /* older than the oldest version to keep, found with a backward scan of (roleid, changed_at) */
+  params[1] = Int32GetDatum(guc_passwordpolicy_history_max_num_entries);
+  ret = SPI_execute_with_args("DELETE FROM passwordpolicy.accounts_password_history h "
+                              "USING (SELECT DISTINCT unnest($1::oid[]) AS roleid) r "
+                              "WHERE h.roleid = r.roleid "
+                              "  AND h.changed_at < (SELECT k.changed_at "
+                              "                      FROM passwordpolicy.accounts_password_history k "
+                              "                      WHERE k.roleid = r.roleid "
+                              "                      ORDER BY k.changed_at DESC "
+                              "                      OFFSET $2 - 1 LIMIT 1)",
+                              2, (Oid[]){OIDARRAYOID, INT4OID}, params, NULL, false, 0);
   if (ret != SPI_OK_DELETE)
   {
-    ereport(ERROR, (errmsg("passwordpolicy: failed to delete password history for removed users")));
-    goto error;
+    ereport(ERROR, (errmsg("passwordpolicy: failed to execute password history delete")));
+    return;
   }
 
-  sql_delete = "DELETE FROM passwordpolicy.accounts_password_history "
-               "WHERE usename = $1 AND changed_at < $2";
+  ereport(DEBUG3, (errmsg("passwordpolicy: %u password history records saved", num)));
+}
+
+/*
+ * @brief Rotate a full ring so its oldest digest is at position 0, as in a ring that is not full
+ * The caller holds the partition lock of the account in exclusive mode
+ **/
+void passwordpolicy_hash_history_linearize(PasswordPolicyHistory *entry)
+{
+  if (entry->head == 0 || entry->count < (uint32)guc_passwordpolicy_history_max_num_entries)
+    return;
+
+  passwordpolicy_hash_history_reverse(entry, 0, entry->head - 1);
+  passwordpolicy_hash_history_reverse(entry, entry->head, entry->count - 1);
+  passwordpolicy_hash_history_reverse(entry, 0, entry->count - 1);
+  entry->head = 0;
+}
+
+/*
+ * @brief Write a digest of the history table in the ring of the account, which can already have
+ * newer digests. The ring stays ordered by change time and keeps the newest digests.
+ * The caller holds the partition lock of the account in exclusive mode
+ **/
+void passwordpolicy_hash_history_merge(Oid roleid, uint32 hashcode, const uint8 *digest, TimestampTz changed_at)
+{
+  bool found, age_bypass;
+  uint32 i, pos, max;
+  PasswordPolicyHistory *entry;
 
-  plan_delete = SPI_prepare(sql_delete, 2, (Oid[]){TEXTOID, TIMESTAMPTZOID});
-  if (plan_delete == NULL)
+  entry = (PasswordPolicyHistory *)hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode,
+                                                               HASH_FIND, &found);
+  if (!found)
   {
-    ereport(ERROR, (errmsg("passwordpolicy: failed to prepare password history delete")));
-    goto error;
+    passwordpolicy_hash_history_store(roleid, hashcode, digest, changed_at, NULL);
+    return;
+  }
+
+  /* newer than the ring, the common case */
+  max = (uint32)guc_passwordpolicy_history_max_num_entries;
+  if (entry->count == 0 || entry->changed_at[(entry->head == 0) ? entry->count - 1 : entry->head - 1] < changed_at)
+  {
+    age_bypass = entry->age_bypass;
+    passwordpolicy_hash_history_store(roleid, hashcode, digest, changed_at, NULL);
+    entry->age_bypass = age_bypass;
+    return;
   }
 
-  sql_insert = "INSERT INTO passwordpolicy.accounts_password_history "
-               "(usename, password_hash, changed_at) "
-               " VALUES ($1, $2, $3) ON CONFLICT DO NOTHING";
+  passwordpolicy_hash_history_linearize(entry);
 
-  plan_insert = SPI_prepare(sql_insert, 3, (Oid[]){TEXTOID, TEXTOID, TIMESTAMPTZOID});
-  if (plan_insert == NULL)
+  /* the same change, or the password was used again since then */
+  for (i = 0; i < entry->count; i++)
   {
-    ereport(ERROR, (errmsg("passwordpolicy: failed to prepare password history insert")));
-    goto error;
+    if (entry->changed_at[i] >= changed_at &&
+        memcmp(entry->digests[i], digest, sizeof(PasswordPolicyHistoryDigest)) == 0)
+      return;
+  }
+
+  pos = 0;
+  while (pos < entry->count && entry->changed_at[pos] <= changed_at)
+    pos++;
+
+  if (entry->count < max)
+  {
+    memmove(entry->digests + pos + 1, entry->digests + pos, (entry->count - pos) * sizeof(PasswordPolicyHistoryDigest));
+    memmove(entry->changed_at + pos + 1, entry->changed_at + pos, (entry->count - pos) * sizeof(TimestampTz));
+    entry->count++;
+  }
+  else
+  {
+    /* older than all the digests of a full ring */
+    if (pos == 0)
+      return;
+    /* drop the oldest digest */
+    pos--;
+    memmove(entry->digests, entry->digests + 1, pos * sizeof(PasswordPolicyHistoryDigest));
+    memmove(entry->changed_at, entry->changed_at + 1, pos * sizeof(TimestampTz));
+  }
+  memcpy(entry->digests[pos], digest, sizeof(PasswordPolicyHistoryDigest));
+  entry->changed_at[pos] = changed_at;
+  entry->head = (entry->count == max) ? 0 : entry->count;
+}
+
+/*
+ * @brief Check if the history table has the layout of the version 3.0.0, the caller is connected to SPI
+ * The library is updated before ALTER EXTENSION passwordpolicy UPDATE is run.
+ **/
+bool passwordpolicy_hash_history_table_ready(void)
+{
+  int ret;
+
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy checking extension");
+
+  ret = SPI_execute("SELECT 1 FROM pg_attribute "
+                    "WHERE attrelid = to_regclass('passwordpolicy.accounts_password_history') "
+                    "  AND attname = 'roleid' AND NOT attisdropped",
+                    true, 0);
+  if (ret != SPI_OK_SELECT)
+    ereport(ERROR, (errmsg("passwordpolicy: failed to check if extension is installed")));
+
+  if (SPI_processed == 0)
+  {
+    ereport(DEBUG3, (errmsg("passwordpolicy: extension is not installed or not updated, skipping password history")));
+    return false;
+  }
+  return true;
+}
+
+/*
+ * @brief Size of the queue of records to write to the history table
+ **/
+Size passwordpolicy_hash_history_queue_memsize(void)
+{
+  return add_size(offsetof(PasswordPolicyHistoryQueue, records),
+                  mul_size(PASSWORDPOLICY_HISTORY_QUEUE_SIZE, sizeof(PasswordPolicyHistoryRecord)));
+}
+
+/*
+ * @brief Reverse the digests of the ring of an account between two positions, both included
+ **/
+void passwordpolicy_hash_history_reverse(PasswordPolicyHistory *entry, uint32 from, uint32 to)
+{
+  TimestampTz changed_at;
+  PasswordPolicyHistoryDigest digest;
+
+  while (from < to)
+  {
+    memcpy(digest, entry->digests[from], sizeof(PasswordPolicyHistoryDigest));
+    memcpy(entry->digests[from], entry->digests[to], sizeof(PasswordPolicyHistoryDigest));
+    memcpy(entry->digests[to], digest, sizeof(PasswordPolicyHistoryDigest));
+    changed_at = entry->changed_at[from];
+    entry->changed_at[from] = entry->changed_at[to];
+    entry->changed_at[to] = changed_at;
+    from++;
+    to--;
   }
+}
 
-  LWLockAcquire(passwordpolicy_lock_history, LW_SHARED);
-  newest_change = passwordpolicy_hash_history_last_save;
-  hash_seq_init(&hash_seq, passwordpolicy_hash_history);
-  while ((entry = (PasswordPolicyHistory *)hash_seq_search(&hash_seq)) != NULL)
+/*
+ * @brief Take a slot from the free list
+ * @return the slot, -1 if all the slots are in use
+ **/
+int32 passwordpolicy_hash_history_slab_alloc(void)
+{
+  int32 slot;
+
+  SpinLockAcquire(&(passwordpolicy_history_slab->mutex));
+  slot = passwordpolicy_history_slab->free_head;
+  if (slot >= 0)
   {
-    oldest_change = 0;
-    inserted = 0;
-    params_insert[0] = CStringGetTextDatum(entry->key);
-    for (i = 0; i < guc_passwordpolicy_history_max_num_entries; i++)
+    passwordpolicy_history_slab->free_head = passwordpolicy_history_slab->next_free[slot];
+    passwordpolicy_history_slab->used++;
+  }
+  SpinLockRelease(&(passwordpolicy_history_slab->mutex));
+
+  return slot;
+}
+
+/*
+ * @brief Return a slot to the free list
+ **/
+void passwordpolicy_hash_history_slab_free(int32 slot)
+{
+  if (slot < 0)
+    return;
+
+  SpinLockAcquire(&(passwordpolicy_history_slab->mutex));
+  passwordpolicy_history_slab->next_free[slot] = passwordpolicy_history_slab->free_head;
+  passwordpolicy_history_slab->free_head = slot;
+  passwordpolicy_history_slab->used--;
+  SpinLockRelease(&(passwordpolicy_history_slab->mutex));
+}
+
+/*
+ * @brief Size of the slab: header, free list and slots
+ **/
+Size passwordpolicy_hash_history_slab_memsize(void)
+{
+  Size size;
+
+  size = MAXALIGN(add_size(offsetof(PasswordPolicyHistorySlab, next_free),
+                           mul_size(guc_passwordpolicy_history_max_num_accounts, sizeof(int32))));
+  size = add_size(size, mul_size(guc_passwordpolicy_history_max_num_accounts, passwordpolicy_hash_history_slot_size()));
+  return size;
+}
+
+/*
+ * @brief Size of a slot: the digests followed by their change times
+ **/
+Size passwordpolicy_hash_history_slot_size(void)
+{
+  return mul_size(guc_passwordpolicy_history_max_num_entries,
+                  sizeof(PasswordPolicyHistoryDigest) + sizeof(TimestampTz));
+}
+
+/*
+ * @brief Remove the digest of an aborted change from the ring of the account, and put back the
+ * digest it overwrote and the bypass of min_password_age it used
+ **/
+void passwordpolicy_hash_history_unstore(const PasswordPolicyHistoryPending *pending)
+{
+  bool found;
+  uint32 hashcode, pos;
+  LWLock *partition_lock;
+  PasswordPolicyHistory *entry;
+  Oid roleid = pending->record.roleid;
+
+  if (!pending->undo.stored)
+    return;
+
+  hashcode = get_hash_value(passwordpolicy_hash_history, &roleid);
+  partition_lock = passwordpolicy_hash_history_partition_lock(hashcode);
+  LWLockAcquire(partition_lock, LW_EXCLUSIVE);
+  entry = (PasswordPolicyHistory *)hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode,
+                                                               HASH_FIND, &found);
+  if (found)
+  {
+    passwordpolicy_hash_history_linearize(entry);
+    /* newest first, other transactions may have written newer digests */
+    for (pos = entry->count; pos > 0; pos--)
     {
-      if (entry->hashes[i].changed_at != 0)
-      {
-        if (oldest_change == 0 || oldest_change > entry->hashes[i].changed_at)
-          oldest_change = entry->hashes[i].changed_at;
-        if (entry->hashes[i].changed_at > passwordpolicy_hash_history_last_save)
-        {
-          // only insert if it's a new history entry
-          ereport(DEBUG3, (errmsg("passwordpolicy: inserting new entry for account '%s' into password history", entry->key)));
-          pgstat_report_activity(STATE_RUNNING, "passwordpolicy insert history");
-          inserted = 1;
-          newest_change = entry->hashes[i].changed_at;
-          params_insert[1] = CStringGetTextDatum(entry->hashes[i].password_hash);
-          params_insert[2] = TimestampTzGetDatum(entry->hashes[i].changed_at);
-          ret = SPI_execute_plan(plan_insert, params_insert, NULL, false, 0);
-          if (ret != SPI_OK_INSERT)
-          {
-            ereport(ERROR, (errmsg("passwordpolicy: failed to execute password history insert")));
-            LWLockRelease(passwordpolicy_lock_history);
-            goto error;
-          }
-        }
-      }
+      if (entry->changed_at[pos - 1] == pending->record.changed_at &&
+          memcmp(entry->digests[pos - 1], pending->record.digest, sizeof(PasswordPolicyHistoryDigest)) == 0)
+        break;
+    }
+    if (pos > 0)
+    {
+      pos--;
+      memmove(entry->digests + pos, entry->digests + pos + 1, (entry->count - pos - 1) * sizeof(PasswordPolicyHistoryDigest));
+      memmove(entry->changed_at + pos, entry->changed_at + pos + 1, (entry->count - pos - 1) * sizeof(TimestampTz));
+      entry->count--;
+      entry->head = entry->count;
+      if (pending->undo.evicted)
+        passwordpolicy_hash_history_merge(roleid, hashcode, pending->undo.oldest.digest, pending->undo.oldest.changed_at);
+      if (pending->undo.age_bypass)
+        entry->age_bypass = true;
+      ereport(DEBUG3, (errmsg("passwordpolicy: account '%u' aborted password history removed", roleid)));
+    }
+    /* the ring of a role created by an aborted transaction */
+    if (entry->count == 0 && !entry->age_bypass)
+    {
+      passwordpolicy_hash_history_slab_free(entry->slot);
+      hash_search_with_hash_value(passwordpolicy_hash_history, &roleid, hashcode, HASH_REMOVE, NULL);
     }
+  }
+  LWLockRelease(partition_lock);
+}
 
-    if (inserted == 1)
+/*
+ * @brief Undo the records of aborted subtransactions, move the committed ones to the parent
+ **/
+static void passwordpolicy_hash_history_subxact_callback(SubXactEvent event, SubTransactionId mySubid,
+                                                         SubTransactionId parentSubid, void *arg)
+{
+  int nestlevel;
+  ListCell *lc;
+  PasswordPolicyHistoryPending *pending;
+
+  if (passwordpolicy_hash_history_pending == NIL)
+    return;
+
+  nestlevel = GetCurrentTransactionNestLevel();
+  switch (event)
+  {
+  case SUBXACT_EVENT_ABORT_SUB:
+    foreach (lc, passwordpolicy_hash_history_pending)
     {
-      // delete only if we have a new history entry for this user
-      ereport(DEBUG3, (errmsg("passwordpolicy: deleting old entries for account '%s' from password history", entry->key)));
-      pgstat_report_activity(STATE_RUNNING, "passwordpolicy delete history");
-      params_delete[0] = CStringGetTextDatum(entry->key);
-      params_delete[1] = TimestampTzGetDatum(oldest_change);
-      ret = SPI_execute_plan(plan_delete, params_delete, NULL, false, 0);
-      if (ret != SPI_OK_DELETE)
+      pending = (PasswordPolicyHistoryPending *)lfirst(lc);
+      if (pending->nestlevel >= nestlevel)
       {
-        ereport(ERROR, (errmsg("passwordpolicy: failed to execute password history delete")));
-        LWLockRelease(passwordpolicy_lock_history);
-        goto error;
+        passwordpolicy_hash_history_unstore(pending);
+        passwordpolicy_hash_history_pending = foreach_delete_current(passwordpolicy_hash_history_pending, lc);
       }
     }
+    break;
+  case SUBXACT_EVENT_COMMIT_SUB:
+    foreach (lc, passwordpolicy_hash_history_pending)
+    {
+      pending = (PasswordPolicyHistoryPending *)lfirst(lc);
+      if (pending->nestlevel >= nestlevel)
+        pending->nestlevel = nestlevel - 1;
+    }
+    break;
+  default:
+    break;
   }
-  passwordpolicy_hash_history_last_save = newest_change;
-  LWLockRelease(passwordpolicy_lock_history);
+}
 
-error:
-  SPI_finish();
-  PopActiveSnapshot();
-  CommitTransactionCommand();
-  pgstat_report_stat(true);
-  pgstat_report_activity(STATE_IDLE, NULL);
-}
\ No newline at end of file
+/*
+ * @brief Queue the records when the transaction commits and wake up the worker, undo them if it aborts
+ **/
+static void passwordpolicy_hash_history_xact_callback(XactEvent event, void *arg)
+{
+  Latch *latch;
+  ListCell *lc;
+  PasswordPolicyHistoryPending *pending;
+
+  if (passwordpolicy_hash_history_pending == NIL)
+    return;
+
+  switch (event)
+  {
+  case XACT_EVENT_COMMIT:
+    foreach (lc, passwordpolicy_hash_history_pending)
+    {
+      pending = (PasswordPolicyHistoryPending *)lfirst(lc);
+      /* a role being created that was never inserted has no Oid */
+      if (pending->undo.stored)
+        passwordpolicy_hash_history_enqueue(&(pending->record));
+    }
+    passwordpolicy_hash_history_pending = NIL;
+
+    LWLockAcquire(passwordpolicy_shm->lock, LW_SHARED);
+    latch = passwordpolicy_shm->bgw_latch;
+    LWLockRelease(passwordpolicy_shm->lock);
+    if (latch)
+      SetLatch(latch);
+    break;
+  case XACT_EVENT_PRE_PREPARE:
+    /* the records would be lost, the transaction can be committed by another backend */
+    ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+                    errmsg("cannot PREPARE a transaction that changed a password")));
+    break;
+  case XACT_EVENT_ABORT:
+    foreach (lc, passwordpolicy_hash_history_pending)
+      passwordpolicy_hash_history_unstore((PasswordPolicyHistoryPending *)lfirst(lc));
+    /* memory is released with TopTransactionContext */
+    passwordpolicy_hash_history_pending = NIL;
+    break;
+  default:
+    break;
+  }
+}
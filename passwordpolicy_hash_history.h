@@ -13,12 +13,44 @@
 #define _PASSWORDPOLICY_HASH_HISTORY_H_
 
 #include <postgres.h>
+#include <catalog/objectaccess.h>
+#include <common/sha2.h>
 #include <utils/timestamp.h>
 
-extern PGDLLEXPORT void passwordpolicy_hash_history_add(const char *username, const char *password_hash, TimestampTz changed_at);
-extern PGDLLEXPORT bool passwordpolicy_hash_history_exists(const char *username, const char *password_hash);
+typedef enum PasswordPolicyHistoryResult
+{
+  PASSWORDPOLICY_HISTORY_ADDED,
+  PASSWORDPOLICY_HISTORY_REUSED,    /* the digest is already in the history */
+  PASSWORDPOLICY_HISTORY_TOO_RECENT /* the last change is newer than min_age */
+} PasswordPolicyHistoryResult;
+
+/* a password change of passwordpolicy_hash_history_add_batch */
+typedef struct PasswordPolicyHistoryBatchEntry
+{
+  Oid roleid;
+  uint8 digest[PG_SHA256_DIGEST_LENGTH];
+  int min_age;
+  int depth;
+  PasswordPolicyHistoryResult result; /* set by passwordpolicy_hash_history_add_batch */
+} PasswordPolicyHistoryBatchEntry;
+
+extern PGDLLEXPORT PasswordPolicyHistoryResult passwordpolicy_hash_history_add(Oid roleid, const char *username,
+                                                                               const uint8 *digest, TimestampTz changed_at,
+                                                                               int min_age, int depth);
+extern PGDLLEXPORT void passwordpolicy_hash_history_add_batch(PasswordPolicyHistoryBatchEntry *entries, int num,
+                                                              TimestampTz changed_at);
+extern PGDLLEXPORT bool passwordpolicy_hash_history_bypass_age(Oid roleid);
+extern PGDLLEXPORT void passwordpolicy_hash_history_discard(Oid roleid, const uint8 *digest, TimestampTz changed_at);
+extern PGDLLEXPORT void passwordpolicy_hash_history_drop(Oid roleid);
+extern PGDLLEXPORT bool passwordpolicy_hash_history_exists(Oid roleid, const uint8 *digest, int depth);
 extern PGDLLEXPORT void passwordpolicy_hash_history_init(void);
-extern PGDLLEXPORT void passwordpolicy_hash_history_load(void);
-extern PGDLLEXPORT void passwordpolicy_hash_history_save(void);
+extern PGDLLEXPORT bool passwordpolicy_hash_history_load(void);
+extern PGDLLEXPORT void passwordpolicy_hash_history_object_access(ObjectAccessType access, Oid classId, Oid objectId,
+                                                                  int subId, void *arg);
+extern PGDLLEXPORT Size passwordpolicy_hash_history_memsize(void);
+extern PGDLLEXPORT void passwordpolicy_hash_history_purge(void);
+extern PGDLLEXPORT bool passwordpolicy_hash_history_queued(void);
+extern PGDLLEXPORT void passwordpolicy_hash_history_save(bool full);
+extern PGDLLEXPORT void passwordpolicy_hash_history_slab_stats(uint32 *num_slots, uint32 *used);
 
 #endif
@@ -0,0 +1,411 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_profiles.c
+ *      Policy profiles of the roles
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_profiles.h"
+
+#include <access/xact.h>
+#include <catalog/pg_type.h>
+#include <executor/spi.h>
+#if (PG_VERSION_NUM >= 130000)
+#include <common/hashfn.h>
+#else
+#include <utils/hashutils.h>
+#endif
+#include <pgstat.h>
+#include <port/pg_bitutils.h>
+#include <storage/shmem.h>
+#include <utils/inval.h>
+#include <utils/snapmgr.h>
+#include <utils/syscache.h>
+
+/*
+ * A profile overrides some of the password checks and soft-lock settings for the roles it is
+ * assigned to in passwordpolicy.roles_profile, directly or through a group role. The roles are
+ * kept by Oid, the profile of a renamed role follows it and the one of a dropped role is deleted
+ * by the worker. The background worker resolves the profile of every role and publishes the
+ * result in shared memory, the password changes and the logins only look up the role Oid there.
+ *
+ * A role applies the profile of the nearest role with one: its own, then the one of its groups,
+ * then the one of the groups of its groups... Profiles at the same distance are taken by name.
+ *
+ * Changes of the roles and their memberships are seen through the invalidations of pg_authid
+ * and pg_auth_members: the backend committing them wakes up the worker, and the worker reads
+ * the profiles again when it receives the invalidations. Changes of the profile tables are
+ * queued by a trigger, like the ones of passwordpolicy.accounts_lockable.
+ */
+
+/* the profiles must be read again, set by the invalidations and the profile tables trigger */
+static bool passwordpolicy_profiles_stale = true;
+/* the transaction changed the roles or their memberships, the worker is woken up at commit */
+static bool passwordpolicy_profiles_wakeup = false;
+static bool passwordpolicy_profiles_callbacks = false;
+
+/* Private functions forward declaration */
+void passwordpolicy_profiles_callback(Datum arg, int cacheid, uint32 hashvalue);
+int32 passwordpolicy_profiles_find(const PasswordPolicyProfiles *profiles, Oid roleid);
+bool passwordpolicy_profiles_insert(PasswordPolicyProfiles *profiles, Oid roleid, int32 profile);
+void passwordpolicy_profiles_load(void);
+int passwordpolicy_profiles_setting(HeapTuple tuple, TupleDesc tupdesc, int attnum);
+uint32 passwordpolicy_profiles_slots(void);
+bool passwordpolicy_profiles_table_ready(void);
+static void passwordpolicy_profiles_xact_callback(XactEvent event, void *arg);
+
+void passwordpolicy_profiles_init(void)
+{
+  bool found;
+
+  passwordpolicy_profiles = ShmemInitStruct("passwordpolicy profiles", passwordpolicy_profiles_memsize(), &found);
+  if (!found)
+  {
+    MemSet(passwordpolicy_profiles, 0, passwordpolicy_profiles_memsize());
+    passwordpolicy_profiles->mask = passwordpolicy_profiles_slots() - 1;
+  }
+}
+
+/*
+ * @brief Forget the profile of a dropped role, the caller is connected to SPI
+ **/
+void passwordpolicy_profiles_drop(Oid roleid)
+{
+  int ret;
+  Datum params[1];
+
+  if (!OidIsValid(roleid) || !passwordpolicy_profiles_table_ready())
+    return;
+
+  params[0] = ObjectIdGetDatum(roleid);
+  ret = SPI_execute_with_args("DELETE FROM passwordpolicy.roles_profile WHERE roleid = $1",
+                              1, (Oid[]){REGROLEOID}, params, NULL, false, 0);
+  if (ret != SPI_OK_DELETE)
+    ereport(ERROR, (errmsg("passwordpolicy: failed to delete profile for removed role '%u'", roleid)));
+}
+
+/*
+ * @brief Read the profiles again at the next refresh, called by the worker
+ **/
+void passwordpolicy_profiles_invalidate(void)
+{
+  passwordpolicy_profiles_stale = true;
+}
+
+Size passwordpolicy_profiles_memsize(void)
+{
+  return add_size(offsetof(PasswordPolicyProfiles, roles),
+                  mul_size(passwordpolicy_profiles_slots(), sizeof(PasswordPolicyProfileRole)));
+}
+
+/*
+ * @brief Read the profiles of the roles if they changed, called by the worker
+ **/
+void passwordpolicy_profiles_refresh(void)
+{
+  SetCurrentStatementStartTimestamp();
+  /* the invalidations committed until now are received here */
+  StartTransactionCommand();
+  if (!passwordpolicy_profiles_stale)
+  {
+    CommitTransactionCommand();
+    return;
+  }
+  passwordpolicy_profiles_stale = false;
+
+  SPI_connect();
+  PushActiveSnapshot(GetTransactionSnapshot());
+
+  passwordpolicy_profiles_load();
+
+  SPI_finish();
+  PopActiveSnapshot();
+  CommitTransactionCommand();
+  pgstat_report_stat(true);
+  pgstat_report_activity(STATE_IDLE, NULL);
+}
+
+/*
+ * @brief Follow the changes of the roles and their memberships, called once by _PG_init
+ **/
+void passwordpolicy_profiles_register(void)
+{
+  CacheRegisterSyscacheCallback(AUTHOID, passwordpolicy_profiles_callback, (Datum)0);
+  CacheRegisterSyscacheCallback(AUTHMEMROLEMEM, passwordpolicy_profiles_callback, (Datum)0);
+}
+
+/*
+ * @brief Settings of a role: the ones of its profile, the GUCs for the rest
+ * @param roleid: InvalidOid for a role being created, it gets the GUCs
+ **/
+void passwordpolicy_profiles_resolve(Oid roleid, PasswordPolicyProfile *profile)
+{
+  int32 index;
+  const PasswordPolicyProfile *assigned;
+
+  profile->min_length = guc_passwordpolicy_min_length;
+  profile->min_spc_char = guc_passwordpolicy_min_spc_char;
+  profile->min_number_char = guc_passwordpolicy_min_number_char;
+  profile->min_upper_char = guc_passwordpolicy_min_upper_char;
+  profile->min_lower_char = guc_passwordpolicy_min_lower_char;
+  profile->history_max_num_entries = guc_passwordpolicy_history_max_num_entries;
+  profile->lock_after = guc_passwordpolicy_lock_after;
+
+  if (!OidIsValid(roleid) || passwordpolicy_profiles == NULL)
+    return;
+
+  LWLockAcquire(passwordpolicy_lock_profiles, LW_SHARED);
+  index = passwordpolicy_profiles_find(passwordpolicy_profiles, roleid);
+  if (index >= 0)
+  {
+    assigned = &(passwordpolicy_profiles->profiles[index]);
+    if (assigned->min_length >= 0)
+      profile->min_length = assigned->min_length;
+    if (assigned->min_spc_char >= 0)
+      profile->min_spc_char = assigned->min_spc_char;
+    if (assigned->min_number_char >= 0)
+      profile->min_number_char = assigned->min_number_char;
+    if (assigned->min_upper_char >= 0)
+      profile->min_upper_char = assigned->min_upper_char;
+    if (assigned->min_lower_char >= 0)
+      profile->min_lower_char = assigned->min_lower_char;
+    /* the ring of an account can't hold more digests */
+    if (assigned->history_max_num_entries >= 0)
+      profile->history_max_num_entries = Min(assigned->history_max_num_entries,
+                                             guc_passwordpolicy_history_max_num_entries);
+    if (assigned->lock_after >= 0)
+      profile->lock_after = assigned->lock_after;
+  }
+  LWLockRelease(passwordpolicy_lock_profiles);
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Invalidation of pg_authid or pg_auth_members, the worker reads the profiles again
+ * The invalidations of the backend's own changes are processed before they are committed, the
+ * worker would read the old catalogs: it is woken up when the transaction commits.
+ **/
+void passwordpolicy_profiles_callback(Datum arg, int cacheid, uint32 hashvalue)
+{
+  passwordpolicy_profiles_stale = true;
+
+  /* the worker receives the same invalidations, and sets its own flag. The ones of other
+     backends are also received by transactions that didn't write anything */
+  if (!IsTransactionState() || !TransactionIdIsValid(GetTopTransactionIdIfAny()))
+    return;
+
+  if (!passwordpolicy_profiles_callbacks)
+  {
+    RegisterXactCallback(passwordpolicy_profiles_xact_callback, NULL);
+    passwordpolicy_profiles_callbacks = true;
+  }
+  passwordpolicy_profiles_wakeup = true;
+}
+
+/*
+ * @brief Wake up the worker once the changes of the roles are committed
+ **/
+static void passwordpolicy_profiles_xact_callback(XactEvent event, void *arg)
+{
+  Latch *latch;
+
+  if (!passwordpolicy_profiles_wakeup)
+    return;
+
+  switch (event)
+  {
+  case XACT_EVENT_COMMIT:
+    passwordpolicy_profiles_wakeup = false;
+    if (passwordpolicy_shm == NULL)
+      break;
+
+    LWLockAcquire(passwordpolicy_shm->lock, LW_SHARED);
+    latch = passwordpolicy_shm->bgw_latch;
+    LWLockRelease(passwordpolicy_shm->lock);
+
+    if (latch)
+      SetLatch(latch);
+    break;
+  case XACT_EVENT_ABORT:
+  case XACT_EVENT_PREPARE:
+    passwordpolicy_profiles_wakeup = false;
+    break;
+  default:
+    break;
+  }
+}
+
+/*
+ * @brief Profile of a role, -1 if it doesn't have one
+ **/
+int32 passwordpolicy_profiles_find(const PasswordPolicyProfiles *profiles, Oid roleid)
+{
+  uint32 idx;
+
+  idx = murmurhash32(roleid) & profiles->mask;
+  while (profiles->roles[idx].roleid != InvalidOid)
+  {
+    if (profiles->roles[idx].roleid == roleid)
+      return profiles->roles[idx].profile;
+    idx = (idx + 1) & profiles->mask;
+  }
+  return -1;
+}
+
+/*
+ * @brief Assign a profile to a role
+ * @return false if there are already password_policy_profiles.max_number_roles roles
+ **/
+bool passwordpolicy_profiles_insert(PasswordPolicyProfiles *profiles, Oid roleid, int32 profile)
+{
+  uint32 idx;
+
+  if (profiles->num_roles >= (uint32)guc_passwordpolicy_profiles_max_num_roles)
+    return false;
+
+  idx = murmurhash32(roleid) & profiles->mask;
+  while (profiles->roles[idx].roleid != InvalidOid)
+    idx = (idx + 1) & profiles->mask;
+  profiles->roles[idx].roleid = roleid;
+  profiles->roles[idx].profile = profile;
+  profiles->num_roles++;
+  return true;
+}
+
+/*
+ * @brief Read the profiles, resolve the profile of every role and publish them, the caller is connected to SPI
+ **/
+void passwordpolicy_profiles_load(void)
+{
+  bool isnull;
+  int ret, i, num;
+  char *name;
+  NameData names[PASSWORDPOLICY_PROFILES_MAX];
+  PasswordPolicyProfiles *resolved;
+  TupleDesc tupdesc;
+
+  resolved = palloc0(passwordpolicy_profiles_memsize());
+  resolved->mask = passwordpolicy_profiles_slots() - 1;
+
+  /* without the profile tables, all the roles get the GUCs */
+  if (!passwordpolicy_profiles_table_ready())
+    goto publish;
+
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy reading profiles");
+  ret = SPI_execute("SELECT profile, min_password_len, min_special_chars, min_numbers, min_uppercase_letter, "
+                    "       min_lowercase_letter, max_password_history, number_failures "
+                    "FROM passwordpolicy.profiles ORDER BY profile",
+                    true, 0);
+  if (ret != SPI_OK_SELECT)
+    ereport(ERROR, (errmsg("passwordpolicy: failed to read the profiles")));
+
+  tupdesc = SPI_tuptable->tupdesc;
+  num = (int)SPI_processed;
+  if (num > PASSWORDPOLICY_PROFILES_MAX)
+  {
+    ereport(WARNING, (errmsg("passwordpolicy: only the first %d profiles are used", PASSWORDPOLICY_PROFILES_MAX)));
+    num = PASSWORDPOLICY_PROFILES_MAX;
+  }
+  for (i = 0; i < num; i++)
+  {
+    HeapTuple tuple = SPI_tuptable->vals[i];
+    PasswordPolicyProfile *profile = &(resolved->profiles[i]);
+
+    namestrcpy(&names[i], SPI_getvalue(tuple, tupdesc, 1));
+    profile->min_length = passwordpolicy_profiles_setting(tuple, tupdesc, 2);
+    profile->min_spc_char = passwordpolicy_profiles_setting(tuple, tupdesc, 3);
+    profile->min_number_char = passwordpolicy_profiles_setting(tuple, tupdesc, 4);
+    profile->min_upper_char = passwordpolicy_profiles_setting(tuple, tupdesc, 5);
+    profile->min_lower_char = passwordpolicy_profiles_setting(tuple, tupdesc, 6);
+    profile->history_max_num_entries = passwordpolicy_profiles_setting(tuple, tupdesc, 7);
+    profile->lock_after = passwordpolicy_profiles_setting(tuple, tupdesc, 8);
+  }
+  resolved->num_profiles = num;
+
+  /* the roles with a profile and their members, the nearest profile first */
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy resolving profiles");
+  ret = SPI_execute("WITH RECURSIVE members (roleid, profile, depth) AS ("
+                    "  SELECT r.oid, a.profile, 0 FROM passwordpolicy.roles_profile a "
+                    "  JOIN pg_catalog.pg_roles r ON r.oid = a.roleid "
+                    "  UNION "
+                    "  SELECT m.member, members.profile, members.depth + 1 FROM pg_catalog.pg_auth_members m "
+                    "  JOIN members ON m.roleid = members.roleid"
+                    ") "
+                    "SELECT DISTINCT ON (roleid) roleid, profile FROM members ORDER BY roleid, depth, profile",
+                    true, 0);
+  if (ret != SPI_OK_SELECT)
+    ereport(ERROR, (errmsg("passwordpolicy: failed to resolve the profiles of the roles")));
+
+  tupdesc = SPI_tuptable->tupdesc;
+  for (i = 0; i < (int)SPI_processed; i++)
+  {
+    HeapTuple tuple = SPI_tuptable->vals[i];
+    int32 profile;
+
+    name = SPI_getvalue(tuple, tupdesc, 2);
+    for (profile = 0; profile < num && strcmp(NameStr(names[profile]), name) != 0; profile++)
+      ;
+    if (profile == num)
+      continue;
+
+    if (!passwordpolicy_profiles_insert(resolved, DatumGetObjectId(SPI_getbinval(tuple, tupdesc, 1, &isnull)), profile))
+    {
+      ereport(WARNING, (errmsg("passwordpolicy: not enough shared memory for the profiles of all the roles"),
+                        errhint("increase the value of password_policy_profiles.max_number_roles")));
+      break;
+    }
+  }
+
+publish:
+  LWLockAcquire(passwordpolicy_lock_profiles, LW_EXCLUSIVE);
+  memcpy(passwordpolicy_profiles, resolved, passwordpolicy_profiles_memsize());
+  LWLockRelease(passwordpolicy_lock_profiles);
+
+  ereport(DEBUG1, (errmsg("passwordpolicy: %u profiles assigned to %u roles", resolved->num_profiles,
+                          resolved->num_roles)));
+  pfree(resolved);
+}
+
+/*
+ * @brief Setting of a profile, -1 if NULL
+ **/
+int passwordpolicy_profiles_setting(HeapTuple tuple, TupleDesc tupdesc, int attnum)
+{
+  bool isnull;
+  Datum value;
+
+  value = SPI_getbinval(tuple, tupdesc, attnum, &isnull);
+  return isnull ? -1 : DatumGetInt32(value);
+}
+
+/*
+ * @brief Number of slots of the roles table, a power of 2 at least twice the roles
+ **/
+uint32 passwordpolicy_profiles_slots(void)
+{
+  return pg_nextpower2_32(Max(Min(guc_passwordpolicy_profiles_max_num_roles, PG_INT32_MAX / 4) * 2, 2));
+}
+
+bool passwordpolicy_profiles_table_ready(void)
+{
+  int ret;
+
+  pgstat_report_activity(STATE_RUNNING, "passwordpolicy checking extension");
+
+  ret = SPI_execute("SELECT to_regclass('passwordpolicy.roles_profile') IS NOT NULL", true, 0);
+  if (ret != SPI_OK_SELECT || SPI_processed != 1)
+    ereport(ERROR, (errmsg("passwordpolicy: failed to check if extension is installed")));
+
+  if (SPI_getvalue(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1)[0] != 't')
+  {
+    ereport(DEBUG3, (errmsg("passwordpolicy: extension is not installed or not updated, skipping profiles")));
+    return false;
+  }
+  return true;
+}
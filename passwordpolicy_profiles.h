@@ -0,0 +1,27 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_profiles.h
+ *      Policy profiles of the roles
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_PROFILES_H_
+#define _PASSWORDPOLICY_PROFILES_H_
+
+#include <postgres.h>
+
+#include "passwordpolicy_vars.h"
+
+extern PGDLLEXPORT void passwordpolicy_profiles_drop(Oid roleid);
+extern PGDLLEXPORT void passwordpolicy_profiles_init(void);
+extern PGDLLEXPORT void passwordpolicy_profiles_invalidate(void);
+extern PGDLLEXPORT Size passwordpolicy_profiles_memsize(void);
+extern PGDLLEXPORT void passwordpolicy_profiles_refresh(void);
+extern PGDLLEXPORT void passwordpolicy_profiles_register(void);
+extern PGDLLEXPORT void passwordpolicy_profiles_resolve(Oid roleid, PasswordPolicyProfile *profile);
+
+#endif
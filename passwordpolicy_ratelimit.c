@@ -0,0 +1,308 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_ratelimit.c
+ *      Soft-lock algorithms for passwordpolicy
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_ratelimit.h"
+
+#if (PG_VERSION_NUM >= 150000)
+#include <common/pg_prng.h>
+#endif
+#include <utils/timestamp.h>
+
+#include "passwordpolicy_vars.h"
+
+/*
+ * Every algorithm keeps its state in the fixed-size account slot and updates it with
+ * atomic operations, there is no lock in the login path. Time based decay is computed
+ * when the state is read, there is no worker sweeping the accounts.
+ *
+ * sliding_window and token_bucket pack their state in the 64-bit state field:
+ *   high 32 bits: seconds since the PostgreSQL epoch (window start or last refill)
+ *   low 32 bits: failures in the previous and current windows (16 bits each), or
+ *                milli-tokens left in the bucket
+ * A state of 0 is a new account: empty windows or a full bucket.
+ */
+#define STATE_SECONDS(state) ((uint32)((state) >> 32))
+#define STATE_PAYLOAD(state) ((uint32)((state) & 0xFFFFFFFF))
+#define STATE_MAKE(seconds, payload) (((uint64)(seconds) << 32) | (uint64)(payload))
+
+#define WINDOW_PREV(payload) ((payload) >> 16)
+#define WINDOW_CUR(payload) ((payload) & 0xFFFF)
+#define WINDOW_MAKE(prev, cur) (((uint32)(prev) << 16) | (uint32)(cur))
+
+#define BUCKET_TOKEN 1000
+
+/* forward declaration private functions */
+static uint32 passwordpolicy_ratelimit_seconds(TimestampTz ts);
+static uint64 passwordpolicy_ratelimit_bucket_refill(uint64 state, uint32 now, int lock_after);
+static uint32 passwordpolicy_ratelimit_bucket_size(int lock_after);
+static int64 passwordpolicy_ratelimit_backoff(uint64 failures, int lock_after);
+static uint64 passwordpolicy_ratelimit_window_slide(uint64 state, uint32 now);
+static double passwordpolicy_ratelimit_window_estimate(uint64 state, uint32 now);
+
+/**
+ * @brief Check if an account is soft-locked
+ * @param entry: account
+ * @param username: account name, for messages
+ * @param now: current timestamp
+ * @param lock_after: failures allowed by the profile of the account
+ * @return true if the account is soft-locked
+ */
+bool passwordpolicy_ratelimit_locked(PasswordPolicyAccount *entry, const char *username, TimestampTz now, int lock_after)
+{
+  int microsecs;
+  long int secs;
+  uint64 failures, state;
+
+  switch (guc_passwordpolicy_lock_algorithm)
+  {
+  case PASSWORDPOLICY_LOCK_SLIDING_WINDOW:
+    state = pg_atomic_read_u64(&(entry->state));
+    if (passwordpolicy_ratelimit_window_estimate(state, passwordpolicy_ratelimit_seconds(now)) >= lock_after)
+    {
+      ereport(DEBUG3, (errmsg("passwordpolicy: maximum number of failed connections in the window exceeded for '%s'", username)));
+      return true;
+    }
+    return false;
+
+  case PASSWORDPOLICY_LOCK_TOKEN_BUCKET:
+    state = passwordpolicy_ratelimit_bucket_refill(pg_atomic_read_u64(&(entry->state)), passwordpolicy_ratelimit_seconds(now),
+                                                   lock_after);
+    if (STATE_PAYLOAD(state) < BUCKET_TOKEN)
+    {
+      ereport(DEBUG3, (errmsg("passwordpolicy: no failed connections left in the bucket for '%s'", username)));
+      return true;
+    }
+    return false;
+
+  case PASSWORDPOLICY_LOCK_EXPONENTIAL_BACKOFF:
+    failures = pg_atomic_read_u64(&(entry->failures));
+    if (failures < lock_after)
+      return false;
+    TimestampDifference(pg_atomic_read_u64(&(entry->last_failure)), now, &secs, &microsecs);
+    if (secs < passwordpolicy_ratelimit_backoff(failures, lock_after))
+    {
+      ereport(DEBUG3, (errmsg("passwordpolicy: maximum number of failed connections exceeded for '%s' and backoff time not passed", username)));
+      return true;
+    }
+    return false;
+
+  case PASSWORDPOLICY_LOCK_CONSECUTIVE:
+  default:
+    failures = pg_atomic_read_u64(&(entry->failures));
+    if (failures < lock_after)
+      return false;
+    // auto soft-unlock disabled
+    if (!guc_passwordpolicy_lock_auto_unlock)
+    {
+      ereport(DEBUG3, (errmsg("passwordpolicy: maximum number of failed connections exceeded for '%s' and auto unlock disabled",
+                              username)));
+      return true;
+    }
+    // auto soft-unlock delay
+    TimestampDifference(pg_atomic_read_u64(&(entry->last_failure)), now, &secs, &microsecs);
+    if (secs < guc_passwordpolicy_lock_auto_unlock_after)
+    {
+      ereport(DEBUG3, (errmsg("passwordpolicy: maximum number of failed connections exceeded for '%s' and auto unlock time not passed",
+                              username)));
+      return true;
+    }
+    return false;
+  }
+}
+
+/**
+ * @brief Record a failed login
+ * @param entry: account
+ * @param username: account name, for messages
+ * @param now: current timestamp
+ * @param lock_after: failures allowed by the profile of the account
+ * @return true if the account is soft-locked after this failure
+ */
+bool passwordpolicy_ratelimit_failure(PasswordPolicyAccount *entry, const char *username, TimestampTz now, int lock_after)
+{
+  uint32 cur, seconds;
+  uint64 failures, state, new_state;
+
+  failures = pg_atomic_add_fetch_u64(&(entry->failures), 1);
+  pg_atomic_write_u64(&(entry->last_failure), now);
+  pg_atomic_fetch_add_u64(&(passwordpolicy_shm->lock_changes), 1);
+
+  switch (guc_passwordpolicy_lock_algorithm)
+  {
+  case PASSWORDPOLICY_LOCK_SLIDING_WINDOW:
+    seconds = passwordpolicy_ratelimit_seconds(now);
+    state = pg_atomic_read_u64(&(entry->state));
+    do
+    {
+      new_state = passwordpolicy_ratelimit_window_slide(state, seconds);
+      cur = WINDOW_CUR(STATE_PAYLOAD(new_state));
+      if (cur < 0xFFFF)
+        cur++;
+      new_state = STATE_MAKE(STATE_SECONDS(new_state), WINDOW_MAKE(WINDOW_PREV(STATE_PAYLOAD(new_state)), cur));
+    } while (!pg_atomic_compare_exchange_u64(&(entry->state), &state, new_state));
+    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' failures in the window '%u/%d'",
+                            username, cur, lock_after)));
+    return passwordpolicy_ratelimit_window_estimate(new_state, seconds) >= lock_after;
+
+  case PASSWORDPOLICY_LOCK_TOKEN_BUCKET:
+    seconds = passwordpolicy_ratelimit_seconds(now);
+    state = pg_atomic_read_u64(&(entry->state));
+    do
+    {
+      new_state = passwordpolicy_ratelimit_bucket_refill(state, seconds, lock_after);
+      if (STATE_PAYLOAD(new_state) >= BUCKET_TOKEN)
+        new_state -= BUCKET_TOKEN;
+      else
+        new_state = STATE_MAKE(STATE_SECONDS(new_state), 0);
+    } while (!pg_atomic_compare_exchange_u64(&(entry->state), &state, new_state));
+    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' failures left in the bucket '%u'",
+                            username, STATE_PAYLOAD(new_state) / BUCKET_TOKEN)));
+    return STATE_PAYLOAD(new_state) < BUCKET_TOKEN;
+
+  case PASSWORDPOLICY_LOCK_EXPONENTIAL_BACKOFF:
+  case PASSWORDPOLICY_LOCK_CONSECUTIVE:
+  default:
+    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' failures '" UINT64_FORMAT "/%d",
+                            username, failures, lock_after)));
+    return failures >= lock_after;
+  }
+}
+
+/**
+ * @brief Record a successful login
+ * @param entry: account
+ * @param username: account name, for messages
+ * @return void
+ */
+void passwordpolicy_ratelimit_success(PasswordPolicyAccount *entry, const char *username)
+{
+  /* rate based algorithms forget failures with time, not with successful logins */
+  if (pg_atomic_read_u64(&(entry->failures)) != 0)
+  {
+    ereport(DEBUG3, (errmsg("passwordpolicy: account '%s' failures reset", username)));
+    pg_atomic_write_u64(&(entry->failures), 0);
+    pg_atomic_fetch_add_u64(&(passwordpolicy_shm->lock_changes), 1);
+  }
+}
+
+/**
+ * @brief Delay applied to a rejected login
+ * @param delay: configured delay in seconds
+ * @return delay in milliseconds, with jitter for exponential_backoff
+ */
+int64 passwordpolicy_ratelimit_delay(int delay)
+{
+  double jitter;
+
+  if (guc_passwordpolicy_lock_algorithm != PASSWORDPOLICY_LOCK_EXPONENTIAL_BACKOFF)
+    return (int64)delay * 1000;
+
+  /* equal jitter: a random delay between half and the full delay */
+#if (PG_VERSION_NUM >= 150000)
+  jitter = pg_prng_double(&pg_global_prng_state);
+#else
+  jitter = (double)random() / ((double)MAX_RANDOM_VALUE + 1);
+#endif
+
+  return (int64)(delay * 1000 * (0.5 + jitter / 2));
+}
+
+/* private functions */
+
+/**
+ * @brief Seconds since the PostgreSQL epoch, it fits 32 bits until 2136
+ */
+static uint32 passwordpolicy_ratelimit_seconds(TimestampTz ts)
+{
+  return ts <= 0 ? 0 : (uint32)(ts / USECS_PER_SEC);
+}
+
+/**
+ * @brief Refill the bucket with the tokens earned since the last refill
+ */
+static uint64 passwordpolicy_ratelimit_bucket_refill(uint64 state, uint32 now, int lock_after)
+{
+  uint32 size;
+  uint64 tokens;
+
+  size = passwordpolicy_ratelimit_bucket_size(lock_after);
+  if (state == 0)
+    return STATE_MAKE(now, size);
+
+  tokens = STATE_PAYLOAD(state);
+  if (now > STATE_SECONDS(state))
+    tokens += (uint64)(now - STATE_SECONDS(state)) * guc_passwordpolicy_lock_refill_rate * BUCKET_TOKEN / SECS_PER_MINUTE;
+
+  return STATE_MAKE(Max(now, STATE_SECONDS(state)), Min(tokens, size));
+}
+
+/**
+ * @brief Bucket size in milli-tokens, one token per allowed failure
+ */
+static uint32 passwordpolicy_ratelimit_bucket_size(int lock_after)
+{
+  return (uint32)Min((uint64)lock_after * BUCKET_TOKEN, PG_UINT32_MAX / 2);
+}
+
+/**
+ * @brief Seconds an account stays soft-locked after a number of consecutive failures
+ */
+static int64 passwordpolicy_ratelimit_backoff(uint64 failures, int lock_after)
+{
+  int64 backoff;
+  uint64 exponent;
+
+  backoff = Max(guc_passwordpolicy_lock_auto_unlock_after, 1);
+  exponent = failures - lock_after;
+  while (exponent-- > 0 && backoff < guc_passwordpolicy_lock_backoff_max)
+    backoff *= 2;
+
+  return Min(backoff, guc_passwordpolicy_lock_backoff_max);
+}
+
+/**
+ * @brief Move the window to the current time
+ */
+static uint64 passwordpolicy_ratelimit_window_slide(uint64 state, uint32 now)
+{
+  uint32 start, window, payload;
+
+  window = Max(guc_passwordpolicy_lock_window, 1);
+  start = STATE_SECONDS(state);
+  payload = STATE_PAYLOAD(state);
+
+  if (state == 0 || now < start)
+    return state == 0 ? STATE_MAKE(now, 0) : state;
+
+  if (now - start < window)
+    return state;
+
+  if (now - start < 2 * (uint64)window)
+    return STATE_MAKE(start + window, WINDOW_MAKE(WINDOW_CUR(payload), 0));
+
+  return STATE_MAKE(now - (now - start) % window, 0);
+}
+
+/**
+ * @brief Failures in the last window: the current window plus the overlapping part of the previous one
+ */
+static double passwordpolicy_ratelimit_window_estimate(uint64 state, uint32 now)
+{
+  uint32 window, elapsed, payload;
+
+  state = passwordpolicy_ratelimit_window_slide(state, now);
+  window = Max(guc_passwordpolicy_lock_window, 1);
+  elapsed = now > STATE_SECONDS(state) ? now - STATE_SECONDS(state) : 0;
+  payload = STATE_PAYLOAD(state);
+
+  return WINDOW_PREV(payload) * ((double)(window - Min(elapsed, window)) / window) + WINDOW_CUR(payload);
+}
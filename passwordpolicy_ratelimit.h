@@ -0,0 +1,27 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_ratelimit.h
+ *      Soft-lock algorithms for passwordpolicy
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_RATELIMIT_H_
+#define _PASSWORDPOLICY_RATELIMIT_H_
+
+#include <postgres.h>
+#include <datatype/timestamp.h>
+
+#include "passwordpolicy_vars.h"
+
+extern PGDLLEXPORT int64 passwordpolicy_ratelimit_delay(int delay);
+extern PGDLLEXPORT bool passwordpolicy_ratelimit_failure(PasswordPolicyAccount *entry, const char *username, TimestampTz now,
+                                                         int lock_after);
+extern PGDLLEXPORT bool passwordpolicy_ratelimit_locked(PasswordPolicyAccount *entry, const char *username, TimestampTz now,
+                                                        int lock_after);
+extern PGDLLEXPORT void passwordpolicy_ratelimit_success(PasswordPolicyAccount *entry, const char *username);
+
+#endif
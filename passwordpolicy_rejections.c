@@ -0,0 +1,161 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_rejections.c
+ *      Backend cache of the recently rejected passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_rejections.h"
+
+#include <utils/memutils.h>
+#include <utils/timestamp.h>
+
+#include "passwordpolicy_vars.h"
+
+/*
+ * A client retrying a rejected password pays again for every check until the one rejecting
+ * it, the dictionary lookups and plain_crypt_verify being the most expensive. The backend
+ * keeps the last password_policy.rejection_cache_size rejections, identified by a keyed
+ * digest of the user name, the password and the settings of the checks, so a retry is
+ * rejected with the same error without running the checks again.
+ *
+ * The key is random and local to the backend: the digests can't be compared with the ones
+ * of other backends or with the password history, and the passwords are never stored.
+ * A rejection is forgotten password_policy.rejection_cache_ttl seconds after it was cached,
+ * or earlier if it's the least recently used one and a new rejection needs its entry.
+ */
+typedef struct PasswordPolicyRejectionEntry
+{
+  uint8 digest[PG_SHA256_DIGEST_LENGTH];
+  TimestampTz rejected_at; /* 0 for a free entry */
+  TimestampTz used_at;
+  PasswordPolicyRejection rejection;
+} PasswordPolicyRejectionEntry;
+
+/* allocated in TopMemoryContext, sized from password_policy.rejection_cache_size */
+static PasswordPolicyRejectionEntry *passwordpolicy_rejections = NULL;
+static int passwordpolicy_rejections_size = 0;
+static uint8 passwordpolicy_rejections_secret[PASSWORDPOLICY_REJECTION_KEY_LEN];
+static bool passwordpolicy_rejections_secret_ready = false;
+
+/* Private functions forward declaration */
+bool passwordpolicy_rejections_expired(const PasswordPolicyRejectionEntry *entry, TimestampTz now);
+bool passwordpolicy_rejections_resize(void);
+
+/*
+ * @brief Cache a rejection, in a free entry or in the least recently used one
+ **/
+void passwordpolicy_rejections_add(const uint8 *digest, const PasswordPolicyRejection *rejection)
+{
+  int i;
+  TimestampTz now;
+  PasswordPolicyRejectionEntry *entry = NULL;
+
+  if (!passwordpolicy_rejections_resize())
+    return;
+
+  now = GetCurrentTimestamp();
+  for (i = 0; i < passwordpolicy_rejections_size; i++)
+  {
+    if (passwordpolicy_rejections_expired(&passwordpolicy_rejections[i], now) ||
+        memcmp(passwordpolicy_rejections[i].digest, digest, PG_SHA256_DIGEST_LENGTH) == 0)
+    {
+      entry = &passwordpolicy_rejections[i];
+      break;
+    }
+    if (entry == NULL || passwordpolicy_rejections[i].used_at < entry->used_at)
+      entry = &passwordpolicy_rejections[i];
+  }
+
+  memcpy(entry->digest, digest, PG_SHA256_DIGEST_LENGTH);
+  entry->rejected_at = now;
+  entry->used_at = now;
+  entry->rejection = *rejection;
+}
+
+/*
+ * @brief Key of the digests of the cache, random for every backend
+ * @return NULL if the cache is disabled or the key can't be generated
+ **/
+const uint8 *passwordpolicy_rejections_key(void)
+{
+  if (guc_passwordpolicy_rejection_cache_size == 0)
+    return NULL;
+
+  if (!passwordpolicy_rejections_secret_ready)
+  {
+    if (!pg_strong_random(passwordpolicy_rejections_secret, PASSWORDPOLICY_REJECTION_KEY_LEN))
+    {
+      ereport(DEBUG1, (errmsg("passwordpolicy: could not generate the key of the rejections cache")));
+      return NULL;
+    }
+    passwordpolicy_rejections_secret_ready = true;
+  }
+  return passwordpolicy_rejections_secret;
+}
+
+/*
+ * @brief Find a rejection not expired yet
+ * @return true if found, rejection is filled with the cached error
+ **/
+bool passwordpolicy_rejections_lookup(const uint8 *digest, PasswordPolicyRejection *rejection)
+{
+  int i;
+  TimestampTz now;
+
+  if (!passwordpolicy_rejections_resize())
+    return false;
+
+  now = GetCurrentTimestamp();
+  for (i = 0; i < passwordpolicy_rejections_size; i++)
+  {
+    if (passwordpolicy_rejections_expired(&passwordpolicy_rejections[i], now) ||
+        memcmp(passwordpolicy_rejections[i].digest, digest, PG_SHA256_DIGEST_LENGTH) != 0)
+      continue;
+
+    passwordpolicy_rejections[i].used_at = now;
+    *rejection = passwordpolicy_rejections[i].rejection;
+    return true;
+  }
+  return false;
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Check if an entry is free or older than password_policy.rejection_cache_ttl
+ **/
+bool passwordpolicy_rejections_expired(const PasswordPolicyRejectionEntry *entry, TimestampTz now)
+{
+  return entry->rejected_at == 0 ||
+         TimestampDifferenceExceeds(entry->rejected_at, now, guc_passwordpolicy_rejection_cache_ttl * 1000);
+}
+
+/*
+ * @brief Follow the changes of password_policy.rejection_cache_size, the cached rejections are dropped
+ * @return false if the cache is disabled
+ **/
+bool passwordpolicy_rejections_resize(void)
+{
+  if (passwordpolicy_rejections_size == guc_passwordpolicy_rejection_cache_size)
+    return passwordpolicy_rejections_size > 0;
+
+  if (passwordpolicy_rejections != NULL)
+    pfree(passwordpolicy_rejections);
+  passwordpolicy_rejections = NULL;
+  passwordpolicy_rejections_size = 0;
+
+  if (guc_passwordpolicy_rejection_cache_size == 0)
+    return false;
+
+  passwordpolicy_rejections = MemoryContextAllocZero(TopMemoryContext,
+                                                     guc_passwordpolicy_rejection_cache_size *
+                                                         sizeof(PasswordPolicyRejectionEntry));
+  passwordpolicy_rejections_size = guc_passwordpolicy_rejection_cache_size;
+  return true;
+}
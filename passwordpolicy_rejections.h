@@ -0,0 +1,33 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_rejections.h
+ *      Backend cache of the recently rejected passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_REJECTIONS_H_
+#define _PASSWORDPOLICY_REJECTIONS_H_
+
+#include <postgres.h>
+#include <common/sha2.h>
+
+#define PASSWORDPOLICY_REJECTION_LEN 128
+#define PASSWORDPOLICY_REJECTION_KEY_LEN 32
+
+/* error reported for a rejected password, it never contains the password */
+typedef struct PasswordPolicyRejection
+{
+  char message[PASSWORDPOLICY_REJECTION_LEN];
+  char detail[PASSWORDPOLICY_REJECTION_LEN];     /* empty without errdetail */
+  char detail_log[PASSWORDPOLICY_REJECTION_LEN]; /* empty without errdetail_log */
+} PasswordPolicyRejection;
+
+extern PGDLLEXPORT void passwordpolicy_rejections_add(const uint8 *digest, const PasswordPolicyRejection *rejection);
+extern PGDLLEXPORT const uint8 *passwordpolicy_rejections_key(void);
+extern PGDLLEXPORT bool passwordpolicy_rejections_lookup(const uint8 *digest, PasswordPolicyRejection *rejection);
+
+#endif
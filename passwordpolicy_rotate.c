@@ -0,0 +1,240 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_rotate.c
+ *      Password changes of many roles at once
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_rotate.h"
+
+#include <access/xact.h>
+#include <commands/user.h>
+#include <miscadmin.h>
+#include <nodes/makefuncs.h>
+#include <parser/parse_node.h>
+#include <utils/acl.h>
+#include <utils/resowner.h>
+#include <utils/timestamp.h>
+
+#include "passwordpolicy_check.h"
+#include "passwordpolicy_hash_history.h"
+#include "passwordpolicy_vars.h"
+
+/*
+ * A secrets manager rotating thousands of passwords would pay, for every ALTER ROLE, the
+ * parse and the execution of a statement and the lock of a history partition. The passwords
+ * are checked first, then the history of all of them is checked and written taking the lock
+ * of every partition once, and finally the accepted passwords are changed in the transaction
+ * of the caller. Every change runs in its own subtransaction: a role that can't be changed is
+ * reported in its result, the other ones are still changed.
+ *
+ * The changes go straight to AlterRole, the ProcessUtility hook doesn't see them: a password
+ * change doesn't change the list of the accounts to soft-lock. The privileges of AlterRole are
+ * checked before the history, a role that can't be changed doesn't learn anything about the
+ * history of another one.
+ */
+
+/* Private functions forward declaration */
+bool passwordpolicy_rotate_allowed(Oid roleid);
+bool passwordpolicy_rotate_apply(PasswordPolicyRotation *rotation, const PasswordPolicyHistoryBatchEntry *history,
+                                 TimestampTz changed_at);
+void passwordpolicy_rotate_history_reason(PasswordPolicyRotation *rotation, const PasswordPolicyHistoryBatchEntry *history);
+
+/*
+ * @brief Check and change the passwords of many roles, in the current transaction
+ * A rejected password or a failed change doesn't stop the other ones, see the result of every rotation.
+ **/
+void passwordpolicy_rotate_passwords(PasswordPolicyRotation *rotations, int num)
+{
+  int i, num_history = 0;
+  Oid roleid;
+  TimestampTz now;
+  PasswordPolicyHistoryBatchEntry *history, **history_of;
+  PasswordPolicyProfile profile;
+  PasswordPolicyRejection rejection;
+  PasswordPolicyRotation *rotation;
+
+  now = GetCurrentTimestamp();
+  history = (PasswordPolicyHistoryBatchEntry *)palloc0(Max(num, 1) * sizeof(PasswordPolicyHistoryBatchEntry));
+  history_of = (PasswordPolicyHistoryBatchEntry **)palloc0(Max(num, 1) * sizeof(PasswordPolicyHistoryBatchEntry *));
+
+  /* the rules, the cheap part, password by password */
+  for (i = 0; i < num; i++)
+  {
+    rotation = &rotations[i];
+    rotation->changed = false;
+    rotation->reason[0] = '\0';
+
+    if (rotation->rolname == NULL)
+    {
+      strlcpy(rotation->reason, "role cannot be null.", sizeof(rotation->reason));
+      continue;
+    }
+
+    if (rotation->password == NULL)
+    {
+      strlcpy(rotation->reason, "password cannot be null.", sizeof(rotation->reason));
+      continue;
+    }
+
+    roleid = get_role_oid(rotation->rolname, true);
+    if (!OidIsValid(roleid))
+    {
+      snprintf(rotation->reason, sizeof(rotation->reason), "role \"%s\" does not exist", rotation->rolname);
+      continue;
+    }
+
+    if (!passwordpolicy_rotate_allowed(roleid))
+    {
+      snprintf(rotation->reason, sizeof(rotation->reason), "permission denied to change the password of role \"%s\"",
+               rotation->rolname);
+      continue;
+    }
+
+    if (!passwordpolicy_check_candidate(rotation->rolname, roleid, rotation->password, &profile, &rejection))
+    {
+      strlcpy(rotation->reason, rejection.message, sizeof(rotation->reason));
+      continue;
+    }
+
+    /* as the check_password hook, a password that can't be hashed skips the history */
+    if (profile.history_max_num_entries > 0 &&
+        passwordpolicy_generate_sha256_hash(rotation->password, history[num_history].digest))
+    {
+      history_of[i] = &history[num_history++];
+      history_of[i]->roleid = roleid;
+      history_of[i]->min_age = superuser() ? 0 : guc_passwordpolicy_history_min_password_age;
+      history_of[i]->depth = profile.history_max_num_entries;
+    }
+  }
+
+  /* the history of all the accepted passwords, one lock acquisition per partition */
+  passwordpolicy_hash_history_add_batch(history, num_history, now);
+
+  for (i = 0; i < num; i++)
+  {
+    rotation = &rotations[i];
+    if (rotation->reason[0] != '\0')
+      continue;
+    if (history_of[i] != NULL && history_of[i]->result != PASSWORDPOLICY_HISTORY_ADDED)
+    {
+      passwordpolicy_rotate_history_reason(rotation, history_of[i]);
+      continue;
+    }
+    rotation->changed = passwordpolicy_rotate_apply(rotation, history_of[i], now);
+  }
+
+  pfree(history_of);
+  pfree(history);
+}
+
+/* PRIVATE FUNCTIONS */
+
+/*
+ * @brief Check if the current user can change the password of the role, as AlterRole does
+ * The history of the role is checked and written before AlterRole runs, these rules must be
+ * the ones of AlterRole for a password change, or a caller could probe or fill the history of
+ * a role it can't change.
+ **/
+bool passwordpolicy_rotate_allowed(Oid roleid)
+{
+  if (superuser())
+    return true;
+  if (superuser_arg(roleid))
+    return false;
+#if (PG_VERSION_NUM >= 160000)
+  /* AlterRole of PostgreSQL 16 and later: the role itself, or CREATEROLE with ADMIN OPTION on the role */
+  return roleid == GetUserId() || (have_createrole_privilege() && is_admin_of_role(GetUserId(), roleid));
+#else
+  /* AlterRole of PostgreSQL 15 and earlier: the role itself, or CREATEROLE on a role without REPLICATION */
+  if (has_rolreplication(roleid))
+    return false;
+  return roleid == GetUserId() || have_createrole_privilege();
+#endif
+}
+
+/*
+ * @brief Change the password of a role in a subtransaction, its history is discarded if the change fails
+ * @return false if the change failed, the error message is the reason of the rotation
+ **/
+bool passwordpolicy_rotate_apply(PasswordPolicyRotation *rotation, const PasswordPolicyHistoryBatchEntry *history,
+                                 TimestampTz changed_at)
+{
+  volatile bool changed = false;
+  MemoryContext oldcontext = CurrentMemoryContext;
+  ResourceOwner oldowner = CurrentResourceOwner;
+
+  BeginInternalSubTransaction(NULL);
+  MemoryContextSwitchTo(oldcontext);
+
+  PG_TRY();
+  {
+    AlterRoleStmt *stmt;
+    RoleSpec *role;
+
+    role = makeNode(RoleSpec);
+    role->roletype = ROLESPEC_CSTRING;
+    role->rolename = pstrdup(rotation->rolname);
+    role->location = -1;
+
+    stmt = makeNode(AlterRoleStmt);
+    stmt->role = role;
+    stmt->options = list_make1(makeDefElem("password", (Node *)makeString(pstrdup(rotation->password)), -1));
+    stmt->action = +1;
+
+    /* the check_password hook still runs, the password is already checked */
+    passwordpolicy_check_bypass(rotation->rolname);
+#if (PG_VERSION_NUM >= 140000)
+    AlterRole(make_parsestate(NULL), stmt);
+#else
+    AlterRole(stmt);
+#endif
+    passwordpolicy_check_bypass(NULL);
+
+    ReleaseCurrentSubTransaction();
+    MemoryContextSwitchTo(oldcontext);
+    CurrentResourceOwner = oldowner;
+    changed = true;
+  }
+  PG_CATCH();
+  {
+    ErrorData *edata;
+
+    passwordpolicy_check_bypass(NULL);
+    MemoryContextSwitchTo(oldcontext);
+    edata = CopyErrorData();
+    FlushErrorState();
+
+    RollbackAndReleaseCurrentSubTransaction();
+    MemoryContextSwitchTo(oldcontext);
+    CurrentResourceOwner = oldowner;
+
+    /* added to the history before the subtransaction, by passwordpolicy_hash_history_add_batch */
+    if (history != NULL)
+      passwordpolicy_hash_history_discard(history->roleid, history->digest, changed_at);
+
+    strlcpy(rotation->reason, edata->message, sizeof(rotation->reason));
+    FreeErrorData(edata);
+  }
+  PG_END_TRY();
+
+  return changed;
+}
+
+/*
+ * @brief Reason of a password rejected by the password history, the messages of the check_password hook
+ **/
+void passwordpolicy_rotate_history_reason(PasswordPolicyRotation *rotation, const PasswordPolicyHistoryBatchEntry *history)
+{
+  if (history->result == PASSWORDPOLICY_HISTORY_TOO_RECENT)
+    snprintf(rotation->reason, sizeof(rotation->reason), "password cannot be changed more than once every %d seconds.",
+             history->min_age);
+  else
+    snprintf(rotation->reason, sizeof(rotation->reason), "password cannot be one of the last %d password used.",
+             history->depth);
+}
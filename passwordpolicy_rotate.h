@@ -0,0 +1,29 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_rotate.h
+ *      Password changes of many roles at once
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_ROTATE_H_
+#define _PASSWORDPOLICY_ROTATE_H_
+
+#include <postgres.h>
+
+#include "passwordpolicy_rejections.h"
+
+typedef struct PasswordPolicyRotation
+{
+  const char *rolname;  /* NULL is rejected */
+  const char *password; /* NULL is rejected */
+  bool changed;         /* set by passwordpolicy_rotate_passwords */
+  char reason[PASSWORDPOLICY_REJECTION_LEN]; /* why the password was not changed */
+} PasswordPolicyRotation;
+
+extern PGDLLEXPORT void passwordpolicy_rotate_passwords(PasswordPolicyRotation *rotations, int num);
+
+#endif
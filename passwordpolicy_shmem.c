@@ -17,19 +17,26 @@
 #include <utils/hsearch.h>
 #include <utils/timestamp.h>
 
+#include "passwordpolicy_banned.h"
+#include "passwordpolicy_changes.h"
 #include "passwordpolicy_hash_accounts.h"
+#include "passwordpolicy_hash_addresses.h"
 #include "passwordpolicy_hash_history.h"
+#include "passwordpolicy_profiles.h"
+#include "passwordpolicy_snapshot.h"
 #include "passwordpolicy_vars.h"
 
 #define TRANCHE_NAME_ACCOUNTS "passwordpolicy accounts"
+#define TRANCHE_NAME_BANNED "passwordpolicy banned"
 #define TRANCHE_NAME_HISTORY "passwordpolicy history"
+#define TRANCHE_NAME_PROFILES "passwordpolicy profiles"
 
 /* Private functions forward declaration */
 Size passwordpolicy_memsize(void);
 
 bool passwordpolicy_shmem_check(void)
 {
-  return passwordpolicy_shm && passwordpolicy_hash_accounts &&
+  return passwordpolicy_shm && passwordpolicy_hash_accounts && passwordpolicy_hash_addresses && passwordpolicy_changes &&
          pg_atomic_unlocked_test_flag(&(passwordpolicy_shm->flag_shutdown));
 }
 
@@ -48,7 +55,9 @@ void passwordpolicy_shmem_request(void)
   RequestAddinShmemSpace(passwordpolicy_memsize());
   RequestNamedLWLockTranche("passwordpolicy", 1);
   RequestNamedLWLockTranche(TRANCHE_NAME_ACCOUNTS, 1);
-  RequestNamedLWLockTranche(TRANCHE_NAME_HISTORY, 1);
+  RequestNamedLWLockTranche(TRANCHE_NAME_BANNED, 1);
+  RequestNamedLWLockTranche(TRANCHE_NAME_HISTORY, PASSWORDPOLICY_HISTORY_PARTITIONS);
+  RequestNamedLWLockTranche(TRANCHE_NAME_PROFILES, 1);
 }
 
 /**
@@ -67,7 +76,11 @@ void passwordpolicy_shmem_startup(void)
   /* reset in case this is a restart within the postmaster */
   passwordpolicy_shm = NULL;
   passwordpolicy_hash_accounts = NULL;
+  passwordpolicy_hash_addresses = NULL;
+  passwordpolicy_changes = NULL;
   passwordpolicy_hash_history = NULL;
+  passwordpolicy_banned = NULL;
+  passwordpolicy_profiles = NULL;
 
   LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
 
@@ -75,22 +88,46 @@ void passwordpolicy_shmem_startup(void)
   if (!found)
   {
     passwordpolicy_lock_accounts = &(GetNamedLWLockTranche(TRANCHE_NAME_ACCOUNTS))->lock;
-    passwordpolicy_lock_history = &(GetNamedLWLockTranche(TRANCHE_NAME_HISTORY))->lock;
+    passwordpolicy_lock_banned = &(GetNamedLWLockTranche(TRANCHE_NAME_BANNED))->lock;
+    passwordpolicy_lock_history = GetNamedLWLockTranche(TRANCHE_NAME_HISTORY);
+    passwordpolicy_lock_profiles = &(GetNamedLWLockTranche(TRANCHE_NAME_PROFILES))->lock;
     passwordpolicy_shm->lock = &(GetNamedLWLockTranche("passwordpolicy"))->lock;
+    passwordpolicy_shm->bgw_latch = NULL;
+    passwordpolicy_shm->changes_head = 0;
+    passwordpolicy_shm->changes_tail = 0;
+    passwordpolicy_shm->changes_overflow = false;
     pg_atomic_init_flag(&(passwordpolicy_shm->flag_shutdown));
+    passwordpolicy_shm->accounts_used = 0;
+    pg_atomic_init_u32(&(passwordpolicy_shm->delay_sleeping), 0);
+    pg_atomic_init_u64(&(passwordpolicy_shm->delay_total), 0);
+    pg_atomic_init_u64(&(passwordpolicy_shm->delay_shed), 0);
+    pg_atomic_init_u64(&(passwordpolicy_shm->lock_changes), 0);
+    passwordpolicy_shm->history_loaded = false;
   }
 
   passwordpolicy_hash_accounts_init();
 
+  passwordpolicy_hash_addresses_init();
+
+  passwordpolicy_changes_init();
+
   passwordpolicy_hash_history_init();
 
+  passwordpolicy_banned_init();
+
+  passwordpolicy_profiles_init();
+
   LWLockRelease(AddinShmemInitLock);
 
   if (!IsUnderPostmaster)
     on_shmem_exit(passwordpolicy_shmem_shutdown, (Datum)0);
 
   if (!found)
+  {
     ereport(LOG, (errmsg("passwordpolicy: shmem initialized")));
+    /* soft-locks are enforced from the first login, no need to wait for the worker */
+    passwordpolicy_snapshot_load();
+  }
 }
 
 /**
@@ -106,6 +143,10 @@ void passwordpolicy_shmem_shutdown(int code, Datum arg)
     return;
 
   pg_atomic_test_set_flag(&(passwordpolicy_shm->flag_shutdown));
+
+  /* don't overwrite the last state saved by the worker with a state after a crash */
+  if (code == 0)
+    passwordpolicy_snapshot_save();
 }
 
 /* Private functions */
@@ -114,8 +155,12 @@ Size passwordpolicy_memsize(void)
   Size size;
 
   size = MAXALIGN(sizeof(PasswordPolicyShm));
-  size = add_size(size, hash_estimate_size(guc_passwordpolicy_lock_max_num_accounts, sizeof(PasswordPolicyAccount)));
-  size = add_size(size, hash_estimate_size(guc_passwordpolicy_lock_max_num_accounts, sizeof(PasswordPolicyHistory)));
+  size = add_size(size, passwordpolicy_hash_accounts_memsize());
+  size = add_size(size, passwordpolicy_hash_addresses_memsize());
+  size = add_size(size, passwordpolicy_changes_memsize());
+  size = add_size(size, passwordpolicy_hash_history_memsize());
+  size = add_size(size, passwordpolicy_banned_memsize());
+  size = add_size(size, passwordpolicy_profiles_memsize());
 
   return size;
 }
\ No newline at end of file
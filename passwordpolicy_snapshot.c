@@ -0,0 +1,247 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_snapshot.c
+ *      Persistence of the soft-lock state
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_snapshot.h"
+
+#include <unistd.h>
+
+#include <miscadmin.h>
+#include <pgstat.h>
+#include <storage/fd.h>
+
+#include "passwordpolicy_hash_accounts.h"
+#include "passwordpolicy_hash_addresses.h"
+#include "passwordpolicy_vars.h"
+
+/*
+ * The soft-lock counters are written to a binary file in the data directory, the same
+ * way pg_stat_statements saves its statistics: by the background worker when they have
+ * changed, and by the postmaster at shutdown. The file is read by the postmaster when
+ * the shared memory is created, so the accounts are soft-locked from the first login
+ * after a restart or a crash, without waiting for the background worker.
+ *
+ * File layout: header, accounts, number of addresses, addresses.
+ */
+#define PASSWORDPOLICY_SNAPSHOT_FILE PGSTAT_STAT_PERMANENT_DIRECTORY "/passwordpolicy.stat"
+#define PASSWORDPOLICY_SNAPSHOT_MAGIC 0x50505331
+#define PASSWORDPOLICY_SNAPSHOT_VERSION 1
+
+typedef struct PasswordPolicySnapshotHeader
+{
+  uint32 magic;
+  uint32 version;
+  uint32 num_accounts;
+} PasswordPolicySnapshotHeader;
+
+typedef struct PasswordPolicySnapshotAccount
+{
+  Oid roleid;
+  uint64 failures;
+  uint64 last_failure;
+  uint64 state;
+  NameData usename;
+} PasswordPolicySnapshotAccount;
+
+typedef struct PasswordPolicySnapshotAddress
+{
+  uint64 key;
+  uint64 failures;
+  uint64 last_failure;
+} PasswordPolicySnapshotAddress;
+
+/* changes already saved, only used by the process writing the file */
+static uint64 passwordpolicy_snapshot_saved_changes = 0;
+
+/**
+ * @brief Load the soft-lock state into shared memory, called by the postmaster
+ * @param void
+ * @return void
+ */
+void passwordpolicy_snapshot_load(void)
+{
+  uint32 i, num_addresses;
+  FILE *file;
+  PasswordPolicyAccount *entry;
+  PasswordPolicyAddress *address;
+  PasswordPolicySnapshotHeader header;
+  PasswordPolicySnapshotAccount account_record;
+  PasswordPolicySnapshotAddress address_record;
+
+  file = AllocateFile(PASSWORDPOLICY_SNAPSHOT_FILE, PG_BINARY_R);
+  if (file == NULL)
+  {
+    if (errno != ENOENT)
+      ereport(LOG, (errcode_for_file_access(),
+                    errmsg("passwordpolicy: could not read file \"%s\": %m", PASSWORDPOLICY_SNAPSHOT_FILE)));
+    return;
+  }
+
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      header.magic != PASSWORDPOLICY_SNAPSHOT_MAGIC ||
+      header.version != PASSWORDPOLICY_SNAPSHOT_VERSION)
+    goto error;
+
+  for (i = 0; i < header.num_accounts; i++)
+  {
+    if (fread(&account_record, sizeof(account_record), 1, file) != 1)
+      goto error;
+
+    /* don't fail if password_policy_lock.max_number_accounts was reduced */
+    if (passwordpolicy_shm->accounts_used >= guc_passwordpolicy_lock_max_num_accounts)
+      continue;
+
+    account_record.usename.data[NAMEDATALEN - 1] = '\0';
+    entry = passwordpolicy_hash_accounts_add(account_record.roleid, NameStr(account_record.usename));
+    if (entry == NULL)
+      continue;
+    pg_atomic_write_u64(&(entry->failures), account_record.failures);
+    pg_atomic_write_u64(&(entry->last_failure), account_record.last_failure);
+    pg_atomic_write_u64(&(entry->state), account_record.state);
+  }
+
+  if (fread(&num_addresses, sizeof(num_addresses), 1, file) != 1)
+    goto error;
+
+  for (i = 0; i < num_addresses; i++)
+  {
+    if (fread(&address_record, sizeof(address_record), 1, file) != 1)
+      goto error;
+
+    address = passwordpolicy_hash_addresses_find_key(address_record.key, true);
+    if (address == NULL)
+      continue;
+    pg_atomic_write_u64(&(address->failures), address_record.failures);
+    pg_atomic_write_u64(&(address->last_failure), address_record.last_failure);
+  }
+
+  FreeFile(file);
+
+  passwordpolicy_snapshot_saved_changes = pg_atomic_read_u64(&(passwordpolicy_shm->lock_changes));
+  ereport(LOG, (errmsg("passwordpolicy: soft-lock state loaded, %u accounts and %u source addresses",
+                       header.num_accounts, num_addresses)));
+  return;
+
+error:
+  ereport(LOG, (errmsg("passwordpolicy: ignoring invalid soft-lock state file \"%s\"", PASSWORDPOLICY_SNAPSHOT_FILE)));
+  FreeFile(file);
+}
+
+/**
+ * @brief Write the soft-lock state to disk, if it changed since the last time
+ * @param void
+ * @return void
+ */
+void passwordpolicy_snapshot_save(void)
+{
+  uint32 i, num_addresses;
+  uint64 changes;
+  FILE *file;
+  PasswordPolicyAccount *entry;
+  PasswordPolicyAddress *address;
+  PasswordPolicySnapshotHeader header;
+  PasswordPolicySnapshotAccount account_record;
+  PasswordPolicySnapshotAddress address_record;
+
+  changes = pg_atomic_read_u64(&(passwordpolicy_shm->lock_changes));
+  if (changes == passwordpolicy_snapshot_saved_changes)
+    return;
+
+  file = AllocateFile(PASSWORDPOLICY_SNAPSHOT_FILE ".tmp", PG_BINARY_W);
+  if (file == NULL)
+    goto error;
+
+  MemSet(&header, 0, sizeof(header));
+  header.magic = PASSWORDPOLICY_SNAPSHOT_MAGIC;
+  header.version = PASSWORDPOLICY_SNAPSHOT_VERSION;
+  header.num_accounts = 0;
+  if (fwrite(&header, sizeof(header), 1, file) != 1)
+    goto error;
+
+  /* account names only change with the lock held, the postmaster runs alone */
+  if (IsUnderPostmaster)
+    LWLockAcquire(passwordpolicy_lock_accounts, LW_SHARED);
+  for (i = 0; i <= passwordpolicy_hash_accounts_mask; i++)
+  {
+    entry = &(passwordpolicy_hash_accounts[i].account);
+    MemSet(&account_record, 0, sizeof(account_record));
+    account_record.roleid = pg_atomic_read_u32(&(entry->roleid));
+    if (account_record.roleid == InvalidOid || pg_atomic_read_u32(&(entry->deleted)) == 1)
+      continue;
+    account_record.failures = pg_atomic_read_u64(&(entry->failures));
+    account_record.last_failure = pg_atomic_read_u64(&(entry->last_failure));
+    account_record.state = pg_atomic_read_u64(&(entry->state));
+    namestrcpy(&(account_record.usename), NameStr(entry->usename));
+    if (fwrite(&account_record, sizeof(account_record), 1, file) != 1)
+    {
+      if (IsUnderPostmaster)
+        LWLockRelease(passwordpolicy_lock_accounts);
+      goto error;
+    }
+    header.num_accounts++;
+  }
+  if (IsUnderPostmaster)
+    LWLockRelease(passwordpolicy_lock_accounts);
+
+  num_addresses = 0;
+  for (i = 0; i <= passwordpolicy_hash_addresses_mask; i++)
+  {
+    if (pg_atomic_read_u64(&(passwordpolicy_hash_addresses[i].address.failures)) != 0)
+      num_addresses++;
+  }
+  if (fwrite(&num_addresses, sizeof(num_addresses), 1, file) != 1)
+    goto error;
+
+  for (i = 0; i <= passwordpolicy_hash_addresses_mask && num_addresses > 0; i++)
+  {
+    address = &(passwordpolicy_hash_addresses[i].address);
+    address_record.key = pg_atomic_read_u64(&(address->key));
+    address_record.failures = pg_atomic_read_u64(&(address->failures));
+    address_record.last_failure = pg_atomic_read_u64(&(address->last_failure));
+    if (address_record.key == 0 || address_record.failures == 0)
+      continue;
+    if (fwrite(&address_record, sizeof(address_record), 1, file) != 1)
+      goto error;
+    /* addresses change concurrently, never write more than announced */
+    if (--num_addresses == 0)
+      break;
+  }
+  /* fill the addresses that stopped failing meanwhile */
+  MemSet(&address_record, 0, sizeof(address_record));
+  while (num_addresses-- > 0)
+  {
+    if (fwrite(&address_record, sizeof(address_record), 1, file) != 1)
+      goto error;
+  }
+
+  /* rewrite the header with the number of accounts */
+  if (fseek(file, 0, SEEK_SET) != 0 ||
+      fwrite(&header, sizeof(header), 1, file) != 1)
+    goto error;
+
+  if (FreeFile(file))
+  {
+    file = NULL;
+    goto error;
+  }
+
+  (void)durable_rename(PASSWORDPOLICY_SNAPSHOT_FILE ".tmp", PASSWORDPOLICY_SNAPSHOT_FILE, LOG);
+  passwordpolicy_snapshot_saved_changes = changes;
+  ereport(DEBUG3, (errmsg("passwordpolicy: soft-lock state saved, %u accounts", header.num_accounts)));
+  return;
+
+error:
+  ereport(LOG, (errcode_for_file_access(),
+                errmsg("passwordpolicy: could not write file \"%s\": %m", PASSWORDPOLICY_SNAPSHOT_FILE ".tmp")));
+  if (file)
+    FreeFile(file);
+  unlink(PASSWORDPOLICY_SNAPSHOT_FILE ".tmp");
+}
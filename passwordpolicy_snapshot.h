@@ -0,0 +1,20 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_snapshot.h
+ *      Persistence of the soft-lock state
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_SNAPSHOT_H_
+#define _PASSWORDPOLICY_SNAPSHOT_H_
+
+#include <postgres.h>
+
+extern PGDLLEXPORT void passwordpolicy_snapshot_load(void);
+extern PGDLLEXPORT void passwordpolicy_snapshot_save(void);
+
+#endif
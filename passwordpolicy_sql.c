@@ -12,23 +12,39 @@
 
 #include "passwordpolicy_sql.h"
 
+#include <access/htup_details.h>
+#include <catalog/pg_type.h>
+#include <commands/trigger.h>
+#include <executor/spi.h>
 #include <funcapi.h>
 #include <nodes/execnodes.h>
-#include <utils/hsearch.h>
+#include <utils/acl.h>
+#include <utils/array.h>
+#include <utils/builtins.h>
+#include <utils/memutils.h>
 #include <utils/timestamp.h>
 
+#include "passwordpolicy_changes.h"
+#include "passwordpolicy_check.h"
+#include "passwordpolicy_hash_accounts.h"
+#include "passwordpolicy_hash_history.h"
+#include "passwordpolicy_rotate.h"
 #include "passwordpolicy_shmem.h"
 #include "passwordpolicy_vars.h"
 
 #define PASSWORD_POLICY_SQL_LOCKED_NUMC 3
 #define PASSWORD_POLICY_SQL_HISTORY_NUMC 3
+#define PASSWORD_POLICY_SQL_DELAY_NUMC 3
+#define PASSWORD_POLICY_SQL_SLAB_NUMC 4
+#define PASSWORD_POLICY_SQL_VALIDATE_NUMC 2
+#define PASSWORD_POLICY_SQL_VALIDATE_ARRAY_NUMC 3
+#define PASSWORD_POLICY_SQL_ROTATE_NUMC 3
 
 /* We don't need to return on error on functions */
 
 PG_FUNCTION_INFO_V1(account_locked_reset);
 Datum account_locked_reset(PG_FUNCTION_ARGS)
 {
-  bool found;
   char *usename;
   PasswordPolicyAccount *entry;
 
@@ -42,11 +58,13 @@ Datum account_locked_reset(PG_FUNCTION_ARGS)
 
   usename = PG_GETARG_CSTRING(0);
 
-  entry = (PasswordPolicyAccount *)hash_search(passwordpolicy_hash_accounts, usename, HASH_FIND, &found);
-  if (found)
+  entry = passwordpolicy_hash_accounts_find(get_role_oid(usename, true));
+  if (entry != NULL)
   {
     ereport(DEBUG3, (errmsg("usename '%s' failures manually reset", usename)));
     pg_atomic_write_u64(&(entry->failures), 0);
+    pg_atomic_write_u64(&(entry->state), 0);
+    pg_atomic_fetch_add_u64(&(passwordpolicy_shm->lock_changes), 1);
   }
   else
   {
@@ -59,7 +77,7 @@ Datum account_locked_reset(PG_FUNCTION_ARGS)
 PG_FUNCTION_INFO_V1(accounts_locked);
 Datum accounts_locked(PG_FUNCTION_ARGS)
 {
-  HASH_SEQ_STATUS hash_seq;
+  uint32 i;
   MemoryContext per_query_ctx;
   MemoryContext oldcontext;
   PasswordPolicyAccount *entry;
@@ -96,20 +114,23 @@ Datum accounts_locked(PG_FUNCTION_ARGS)
 
   LWLockAcquire(passwordpolicy_lock_accounts, LW_SHARED);
 
-  hash_seq_init(&hash_seq, passwordpolicy_hash_accounts);
-  while ((entry = (PasswordPolicyAccount *)hash_seq_search(&hash_seq)) != NULL)
+  for (i = 0; i <= passwordpolicy_hash_accounts_mask; i++)
   {
     Datum values[PASSWORD_POLICY_SQL_LOCKED_NUMC];
     bool nulls[PASSWORD_POLICY_SQL_LOCKED_NUMC];
     TimestampTz last_failure;
 
+    entry = &(passwordpolicy_hash_accounts[i].account);
+    if (pg_atomic_read_u32(&(entry->roleid)) == InvalidOid || pg_atomic_read_u32(&(entry->deleted)) == 1)
+      continue;
+
     memset(values, 0, sizeof(values));
     memset(nulls, 0, sizeof(nulls));
 
-    values[0] = CStringGetDatum(entry->key);
+    values[0] = NameGetDatum(&(entry->usename));
     values[1] = Int64GetDatum(pg_atomic_read_u64(&(entry->failures)));
     last_failure = pg_atomic_read_u64(&(entry->last_failure));
-    ereport(DEBUG3, (errmsg("usename '%s' %ld", entry->key, last_failure)));
+    ereport(DEBUG3, (errmsg("usename '%s' %ld", NameStr(entry->usename), last_failure)));
     if (last_failure > 0)
       values[2] = TimestampTzGetDatum(last_failure);
     else
@@ -122,3 +143,318 @@ Datum accounts_locked(PG_FUNCTION_ARGS)
 
   PG_RETURN_INT32(0);
 }
+
+PG_FUNCTION_INFO_V1(failure_delay_stats);
+Datum failure_delay_stats(PG_FUNCTION_ARGS)
+{
+  Datum values[PASSWORD_POLICY_SQL_DELAY_NUMC];
+  bool nulls[PASSWORD_POLICY_SQL_DELAY_NUMC];
+  TupleDesc tupdesc;
+
+  passwordpolicy_shmem_check();
+
+  if (!superuser())
+    ereport(ERROR, (errmsg("only superuser can execute this function")));
+
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    elog(ERROR, "return type must be a row type");
+
+  memset(nulls, 0, sizeof(nulls));
+  values[0] = Int32GetDatum(pg_atomic_read_u32(&(passwordpolicy_shm->delay_sleeping)));
+  values[1] = Int64GetDatum(pg_atomic_read_u64(&(passwordpolicy_shm->delay_total)));
+  values[2] = Int64GetDatum(pg_atomic_read_u64(&(passwordpolicy_shm->delay_shed)));
+
+  PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
+
+PG_FUNCTION_INFO_V1(accounts_lockable_changed);
+Datum accounts_lockable_changed(PG_FUNCTION_ARGS)
+{
+  int attnum;
+  TriggerData *trigdata;
+
+  if (!CALLED_AS_TRIGGER(fcinfo))
+    ereport(ERROR, (errmsg("function must be called as trigger")));
+
+  trigdata = (TriggerData *)fcinfo->context;
+
+  if (TRIGGER_FIRED_BY_TRUNCATE(trigdata->tg_event))
+  {
+    passwordpolicy_changes_add(PASSWORDPOLICY_CHANGE_FULL, InvalidOid, NULL, NULL);
+    return PointerGetDatum(NULL);
+  }
+
+  attnum = SPI_fnumber(trigdata->tg_relation->rd_att, "usename");
+  if (attnum <= 0)
+    ereport(ERROR, (errmsg("passwordpolicy: column usename not found in accounts_lockable")));
+
+  /* the old row for updates and deletes, the new row for inserts */
+  passwordpolicy_changes_add(PASSWORDPOLICY_CHANGE_LOCKABLE, InvalidOid,
+                             SPI_getvalue(trigdata->tg_trigtuple, trigdata->tg_relation->rd_att, attnum), NULL);
+  if (TRIGGER_FIRED_BY_UPDATE(trigdata->tg_event))
+    passwordpolicy_changes_add(PASSWORDPOLICY_CHANGE_LOCKABLE, InvalidOid,
+                               SPI_getvalue(trigdata->tg_newtuple, trigdata->tg_relation->rd_att, attnum), NULL);
+
+  return PointerGetDatum(NULL);
+}
+
+PG_FUNCTION_INFO_V1(profiles_changed);
+Datum profiles_changed(PG_FUNCTION_ARGS)
+{
+  if (!CALLED_AS_TRIGGER(fcinfo))
+    ereport(ERROR, (errmsg("function must be called as trigger")));
+
+  /* the worker resolves the profiles of all the roles again */
+  passwordpolicy_changes_add(PASSWORDPOLICY_CHANGE_PROFILES, InvalidOid, NULL, NULL);
+
+  return PointerGetDatum(NULL);
+}
+
+PG_FUNCTION_INFO_V1(history_slab_stats);
+Datum history_slab_stats(PG_FUNCTION_ARGS)
+{
+  Datum values[PASSWORD_POLICY_SQL_SLAB_NUMC];
+  bool nulls[PASSWORD_POLICY_SQL_SLAB_NUMC];
+  uint32 num_slots, used;
+  TupleDesc tupdesc;
+
+  passwordpolicy_shmem_check();
+
+  if (!superuser())
+    ereport(ERROR, (errmsg("only superuser can execute this function")));
+
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    elog(ERROR, "return type must be a row type");
+
+  passwordpolicy_hash_history_slab_stats(&num_slots, &used);
+
+  memset(nulls, 0, sizeof(nulls));
+  values[0] = Int32GetDatum(num_slots);
+  values[1] = Int32GetDatum(used);
+  values[2] = Int32GetDatum(guc_passwordpolicy_history_max_num_entries);
+  values[3] = Int64GetDatum(passwordpolicy_hash_history_memsize());
+
+  PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
+
+PG_FUNCTION_INFO_V1(min_password_age_bypass);
+Datum min_password_age_bypass(PG_FUNCTION_ARGS)
+{
+  char *usename;
+
+  passwordpolicy_shmem_check();
+
+  if (!superuser())
+    ereport(ERROR, (errmsg("only superuser can execute this function")));
+
+  usename = NameStr(*PG_GETARG_NAME(0));
+
+  if (!passwordpolicy_hash_history_bypass_age(get_role_oid(usename, false)))
+    ereport(ERROR, (errmsg("usename '%s' not found in password history", usename)));
+
+  ereport(DEBUG3, (errmsg("usename '%s' can change the password before min_password_age", usename)));
+
+  PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(validate);
+Datum validate(PG_FUNCTION_ARGS)
+{
+  Datum values[PASSWORD_POLICY_SQL_VALIDATE_NUMC];
+  bool nulls[PASSWORD_POLICY_SQL_VALIDATE_NUMC];
+  char *password;
+  TupleDesc tupdesc;
+  PasswordPolicyRejection rejection;
+
+  passwordpolicy_shmem_check();
+
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    elog(ERROR, "return type must be a row type");
+
+  memset(values, 0, sizeof(values));
+  memset(nulls, 0, sizeof(nulls));
+
+  password = text_to_cstring(PG_GETARG_TEXT_PP(0));
+  if (passwordpolicy_check_validate(NameStr(*PG_GETARG_NAME(1)), password, &rejection))
+  {
+    values[0] = CStringGetTextDatum("accepted");
+    nulls[1] = true;
+  }
+  else
+  {
+    values[0] = CStringGetTextDatum("rejected");
+    values[1] = CStringGetTextDatum(rejection.message);
+  }
+  explicit_bzero(password, strlen(password));
+  pfree(password);
+
+  PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
+
+PG_FUNCTION_INFO_V1(validate_array);
+Datum validate_array(PG_FUNCTION_ARGS)
+{
+  int i, num;
+  bool *elem_nulls;
+  char *password, *rolname;
+  Datum *elems;
+  MemoryContext per_query_ctx, oldcontext, row_ctx;
+  PasswordPolicyRejection rejection;
+  ReturnSetInfo *rsinfo;
+  TupleDesc tupdesc;
+  Tuplestorestate *tupstore;
+
+  passwordpolicy_shmem_check();
+
+  rsinfo = (ReturnSetInfo *)fcinfo->resultinfo;
+
+  if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+    ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED), errmsg("context doesn't support return set")));
+
+  if (!(rsinfo->allowedModes & SFRM_Materialize))
+    ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED), errmsg("context doesn't support materialize mode")));
+
+  per_query_ctx = rsinfo->econtext->ecxt_per_query_memory;
+  oldcontext = MemoryContextSwitchTo(per_query_ctx);
+
+  /* Build a tuple descriptor for our result type */
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    elog(ERROR, "return type must be a row type");
+
+  tupstore = tuplestore_begin_heap(true, false, work_mem);
+  rsinfo->returnMode = SFRM_Materialize;
+  rsinfo->setResult = tupstore;
+  rsinfo->setDesc = tupdesc;
+
+  MemoryContextSwitchTo(oldcontext);
+
+  rolname = NameStr(*PG_GETARG_NAME(1));
+  deconstruct_array(PG_GETARG_ARRAYTYPE_P(0), TEXTOID, -1, false, 'i', &elems, &elem_nulls, &num);
+
+  /* the memory of a candidate is released before the next one */
+  row_ctx = AllocSetContextCreate(CurrentMemoryContext, "passwordpolicy validate", ALLOCSET_DEFAULT_SIZES);
+  for (i = 0; i < num; i++)
+  {
+    Datum values[PASSWORD_POLICY_SQL_VALIDATE_ARRAY_NUMC];
+    bool nulls[PASSWORD_POLICY_SQL_VALIDATE_ARRAY_NUMC];
+
+    memset(values, 0, sizeof(values));
+    memset(nulls, 0, sizeof(nulls));
+
+    values[0] = Int32GetDatum(i + 1);
+    if (elem_nulls[i])
+    {
+      nulls[1] = true;
+      nulls[2] = true;
+      tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+      continue;
+    }
+
+    oldcontext = MemoryContextSwitchTo(row_ctx);
+    password = TextDatumGetCString(elems[i]);
+    if (passwordpolicy_check_validate(rolname, password, &rejection))
+    {
+      values[1] = CStringGetTextDatum("accepted");
+      nulls[2] = true;
+    }
+    else
+    {
+      values[1] = CStringGetTextDatum("rejected");
+      values[2] = CStringGetTextDatum(rejection.message);
+    }
+    explicit_bzero(password, strlen(password));
+    MemoryContextSwitchTo(oldcontext);
+
+    tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+    MemoryContextReset(row_ctx);
+  }
+  MemoryContextDelete(row_ctx);
+
+  PG_RETURN_INT32(0);
+}
+
+PG_FUNCTION_INFO_V1(rotate_passwords);
+Datum rotate_passwords(PG_FUNCTION_ARGS)
+{
+  int i, num_roles, num_passwords;
+  bool *role_nulls, *password_nulls;
+  Datum *roles, *passwords;
+  MemoryContext per_query_ctx, oldcontext;
+  PasswordPolicyRotation *rotations;
+  ReturnSetInfo *rsinfo;
+  TupleDesc tupdesc;
+  Tuplestorestate *tupstore;
+
+  passwordpolicy_shmem_check();
+
+  rsinfo = (ReturnSetInfo *)fcinfo->resultinfo;
+
+  if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+    ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED), errmsg("context doesn't support return set")));
+
+  if (!(rsinfo->allowedModes & SFRM_Materialize))
+    ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED), errmsg("context doesn't support materialize mode")));
+
+  deconstruct_array(PG_GETARG_ARRAYTYPE_P(0), NAMEOID, NAMEDATALEN, false, 'c', &roles, &role_nulls, &num_roles);
+  deconstruct_array(PG_GETARG_ARRAYTYPE_P(1), TEXTOID, -1, false, 'i', &passwords, &password_nulls, &num_passwords);
+
+  if (num_roles != num_passwords)
+    ereport(ERROR, (errcode(ERRCODE_ARRAY_SUBSCRIPT_ERROR),
+                    errmsg("passwordpolicy: roles and passwords must have the same number of elements")));
+
+  per_query_ctx = rsinfo->econtext->ecxt_per_query_memory;
+  oldcontext = MemoryContextSwitchTo(per_query_ctx);
+
+  /* Build a tuple descriptor for our result type */
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    elog(ERROR, "return type must be a row type");
+
+  tupstore = tuplestore_begin_heap(true, false, work_mem);
+  rsinfo->returnMode = SFRM_Materialize;
+  rsinfo->setResult = tupstore;
+  rsinfo->setDesc = tupdesc;
+
+  MemoryContextSwitchTo(oldcontext);
+
+  rotations = (PasswordPolicyRotation *)palloc0(Max(num_roles, 1) * sizeof(PasswordPolicyRotation));
+  for (i = 0; i < num_roles; i++)
+  {
+    rotations[i].rolname = role_nulls[i] ? NULL : NameStr(*DatumGetName(roles[i]));
+    rotations[i].password = password_nulls[i] ? NULL : TextDatumGetCString(passwords[i]);
+  }
+
+  passwordpolicy_rotate_passwords(rotations, num_roles);
+
+  for (i = 0; i < num_roles; i++)
+  {
+    Datum values[PASSWORD_POLICY_SQL_ROTATE_NUMC];
+    bool nulls[PASSWORD_POLICY_SQL_ROTATE_NUMC];
+
+    memset(values, 0, sizeof(values));
+    memset(nulls, 0, sizeof(nulls));
+
+    if (rotations[i].rolname != NULL)
+      values[0] = roles[i];
+    else
+      nulls[0] = true;
+
+    if (rotations[i].changed)
+    {
+      values[1] = CStringGetTextDatum("changed");
+      nulls[2] = true;
+    }
+    else
+    {
+      values[1] = CStringGetTextDatum("rejected");
+      values[2] = CStringGetTextDatum(rotations[i].reason);
+    }
+
+    if (rotations[i].password != NULL)
+      explicit_bzero((char *)rotations[i].password, strlen(rotations[i].password));
+
+    tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+  }
+  pfree(rotations);
+
+  PG_RETURN_INT32(0);
+}
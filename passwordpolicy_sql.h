@@ -16,6 +16,14 @@
 #include <fmgr.h>
 
 extern Datum account_locked_reset(PG_FUNCTION_ARGS);
+extern Datum accounts_lockable_changed(PG_FUNCTION_ARGS);
 extern Datum accounts_locked(PG_FUNCTION_ARGS);
+extern Datum failure_delay_stats(PG_FUNCTION_ARGS);
+extern Datum history_slab_stats(PG_FUNCTION_ARGS);
+extern Datum min_password_age_bypass(PG_FUNCTION_ARGS);
+extern Datum profiles_changed(PG_FUNCTION_ARGS);
+extern Datum rotate_passwords(PG_FUNCTION_ARGS);
+extern Datum validate(PG_FUNCTION_ARGS);
+extern Datum validate_array(PG_FUNCTION_ARGS);
 
 #endif // _PASSWORDPOLICY_SQL_H_
\ No newline at end of file
@@ -0,0 +1,40 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_unicode.c
+ *      Classification of the password characters
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include "passwordpolicy_unicode.h"
+
+#include "passwordpolicy_unicode_table.h"
+
+/*
+ * @brief Class of a Unicode character, from its general category
+ **/
+PasswordPolicyCharClass passwordpolicy_unicode_class(pg_wchar c)
+{
+  int lo, hi, mid;
+
+  if (c < 0x80)
+    return (PasswordPolicyCharClass)passwordpolicy_unicode_ascii[c];
+
+  lo = 0;
+  hi = lengthof(passwordpolicy_unicode_ranges) - 1;
+  while (lo <= hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (c < passwordpolicy_unicode_ranges[mid].first)
+      hi = mid - 1;
+    else if (c > passwordpolicy_unicode_ranges[mid].last)
+      lo = mid + 1;
+    else
+      return (PasswordPolicyCharClass)passwordpolicy_unicode_ranges[mid].class;
+  }
+  return PASSWORDPOLICY_CHAR_SPECIAL;
+}
@@ -0,0 +1,52 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_unicode.h
+ *      Classification of the password characters
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_UNICODE_H_
+#define _PASSWORDPOLICY_UNICODE_H_
+
+#include <postgres.h>
+
+#include <mb/pg_wchar.h>
+
+typedef enum PasswordPolicyCharClass
+{
+  PASSWORDPOLICY_CHAR_SPECIAL, /* punctuation, symbols, spaces, everything else */
+  PASSWORDPOLICY_CHAR_UPPER,   /* Lu, Lt */
+  PASSWORDPOLICY_CHAR_LOWER,   /* Ll */
+  PASSWORDPOLICY_CHAR_LETTER,  /* Lm, Lo: letters without case */
+  PASSWORDPOLICY_CHAR_DIGIT,   /* Nd */
+  PASSWORDPOLICY_CHAR_MARK     /* Mn, Mc, Me: combining marks, part of the previous character */
+} PasswordPolicyCharClass;
+
+typedef struct PasswordPolicyUnicodeRange
+{
+  uint32 first;
+  uint32 last;
+  uint8 class;
+} PasswordPolicyUnicodeRange;
+
+extern PGDLLEXPORT const uint8 passwordpolicy_unicode_ascii[128];
+
+extern PGDLLEXPORT PasswordPolicyCharClass passwordpolicy_unicode_class(pg_wchar c);
+
+/*
+ * @brief Check if the 16 bytes at s are ASCII, 8 bytes at a time
+ **/
+static inline bool passwordpolicy_unicode_ascii16(const char *s)
+{
+  uint64 a, b;
+
+  memcpy(&a, s, sizeof(a));
+  memcpy(&b, s + sizeof(a), sizeof(b));
+  return ((a | b) & UINT64CONST(0x8080808080808080)) == 0;
+}
+
+#endif
@@ -0,0 +1,2268 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_unicode_table.h
+ *      Classes of the Unicode characters for the password checks
+ *
+ * Generated by tools/generate_unicode_table.py from Unicode 14.0.0, don't edit.
+ * Only included by passwordpolicy_unicode.c.
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_UNICODE_TABLE_H_
+#define _PASSWORDPOLICY_UNICODE_TABLE_H_
+
+#include "passwordpolicy_unicode.h"
+
+/* class of the ASCII characters, declared in passwordpolicy_unicode.h */
+const uint8 passwordpolicy_unicode_ascii[128] = {
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_DIGIT, PASSWORDPOLICY_CHAR_DIGIT, PASSWORDPOLICY_CHAR_DIGIT, PASSWORDPOLICY_CHAR_DIGIT,
+    PASSWORDPOLICY_CHAR_DIGIT, PASSWORDPOLICY_CHAR_DIGIT, PASSWORDPOLICY_CHAR_DIGIT, PASSWORDPOLICY_CHAR_DIGIT,
+    PASSWORDPOLICY_CHAR_DIGIT, PASSWORDPOLICY_CHAR_DIGIT, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER,
+    PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER,
+    PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER,
+    PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER,
+    PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER,
+    PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER,
+    PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_UPPER, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER,
+    PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER,
+    PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER,
+    PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER,
+    PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER,
+    PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER,
+    PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_LOWER, PASSWORDPOLICY_CHAR_SPECIAL,
+    PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL, PASSWORDPOLICY_CHAR_SPECIAL,
+};
+
+/* classes of the other characters, ordered, the characters not listed are special characters */
+static const PasswordPolicyUnicodeRange passwordpolicy_unicode_ranges[2208] = {
+    {0x00AA, 0x00AA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x00B5, 0x00B5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x00BA, 0x00BA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x00C0, 0x00D6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x00D8, 0x00DE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x00DF, 0x00F6, PASSWORDPOLICY_CHAR_LOWER},
+    {0x00F8, 0x00FF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0100, 0x0100, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0101, 0x0101, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0102, 0x0102, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0103, 0x0103, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0104, 0x0104, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0105, 0x0105, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0106, 0x0106, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0107, 0x0107, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0108, 0x0108, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0109, 0x0109, PASSWORDPOLICY_CHAR_LOWER},
+    {0x010A, 0x010A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x010B, 0x010B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x010C, 0x010C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x010D, 0x010D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x010E, 0x010E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x010F, 0x010F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0110, 0x0110, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0111, 0x0111, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0112, 0x0112, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0113, 0x0113, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0114, 0x0114, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0115, 0x0115, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0116, 0x0116, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0117, 0x0117, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0118, 0x0118, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0119, 0x0119, PASSWORDPOLICY_CHAR_LOWER},
+    {0x011A, 0x011A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x011B, 0x011B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x011C, 0x011C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x011D, 0x011D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x011E, 0x011E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x011F, 0x011F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0120, 0x0120, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0121, 0x0121, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0122, 0x0122, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0123, 0x0123, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0124, 0x0124, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0125, 0x0125, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0126, 0x0126, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0127, 0x0127, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0128, 0x0128, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0129, 0x0129, PASSWORDPOLICY_CHAR_LOWER},
+    {0x012A, 0x012A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x012B, 0x012B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x012C, 0x012C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x012D, 0x012D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x012E, 0x012E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x012F, 0x012F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0130, 0x0130, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0131, 0x0131, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0132, 0x0132, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0133, 0x0133, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0134, 0x0134, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0135, 0x0135, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0136, 0x0136, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0137, 0x0138, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0139, 0x0139, PASSWORDPOLICY_CHAR_UPPER},
+    {0x013A, 0x013A, PASSWORDPOLICY_CHAR_LOWER},
+    {0x013B, 0x013B, PASSWORDPOLICY_CHAR_UPPER},
+    {0x013C, 0x013C, PASSWORDPOLICY_CHAR_LOWER},
+    {0x013D, 0x013D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x013E, 0x013E, PASSWORDPOLICY_CHAR_LOWER},
+    {0x013F, 0x013F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0140, 0x0140, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0141, 0x0141, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0142, 0x0142, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0143, 0x0143, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0144, 0x0144, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0145, 0x0145, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0146, 0x0146, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0147, 0x0147, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0148, 0x0149, PASSWORDPOLICY_CHAR_LOWER},
+    {0x014A, 0x014A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x014B, 0x014B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x014C, 0x014C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x014D, 0x014D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x014E, 0x014E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x014F, 0x014F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0150, 0x0150, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0151, 0x0151, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0152, 0x0152, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0153, 0x0153, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0154, 0x0154, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0155, 0x0155, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0156, 0x0156, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0157, 0x0157, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0158, 0x0158, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0159, 0x0159, PASSWORDPOLICY_CHAR_LOWER},
+    {0x015A, 0x015A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x015B, 0x015B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x015C, 0x015C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x015D, 0x015D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x015E, 0x015E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x015F, 0x015F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0160, 0x0160, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0161, 0x0161, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0162, 0x0162, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0163, 0x0163, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0164, 0x0164, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0165, 0x0165, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0166, 0x0166, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0167, 0x0167, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0168, 0x0168, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0169, 0x0169, PASSWORDPOLICY_CHAR_LOWER},
+    {0x016A, 0x016A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x016B, 0x016B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x016C, 0x016C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x016D, 0x016D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x016E, 0x016E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x016F, 0x016F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0170, 0x0170, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0171, 0x0171, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0172, 0x0172, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0173, 0x0173, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0174, 0x0174, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0175, 0x0175, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0176, 0x0176, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0177, 0x0177, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0178, 0x0179, PASSWORDPOLICY_CHAR_UPPER},
+    {0x017A, 0x017A, PASSWORDPOLICY_CHAR_LOWER},
+    {0x017B, 0x017B, PASSWORDPOLICY_CHAR_UPPER},
+    {0x017C, 0x017C, PASSWORDPOLICY_CHAR_LOWER},
+    {0x017D, 0x017D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x017E, 0x0180, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0181, 0x0182, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0183, 0x0183, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0184, 0x0184, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0185, 0x0185, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0186, 0x0187, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0188, 0x0188, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0189, 0x018B, PASSWORDPOLICY_CHAR_UPPER},
+    {0x018C, 0x018D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x018E, 0x0191, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0192, 0x0192, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0193, 0x0194, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0195, 0x0195, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0196, 0x0198, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0199, 0x019B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x019C, 0x019D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x019E, 0x019E, PASSWORDPOLICY_CHAR_LOWER},
+    {0x019F, 0x01A0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01A1, 0x01A1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01A2, 0x01A2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01A3, 0x01A3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01A4, 0x01A4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01A5, 0x01A5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01A6, 0x01A7, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01A8, 0x01A8, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01A9, 0x01A9, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01AA, 0x01AB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01AC, 0x01AC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01AD, 0x01AD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01AE, 0x01AF, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01B0, 0x01B0, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01B1, 0x01B3, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01B4, 0x01B4, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01B5, 0x01B5, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01B6, 0x01B6, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01B7, 0x01B8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01B9, 0x01BA, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01BB, 0x01BB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x01BC, 0x01BC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01BD, 0x01BF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01C0, 0x01C3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x01C4, 0x01C5, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01C6, 0x01C6, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01C7, 0x01C8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01C9, 0x01C9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01CA, 0x01CB, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01CC, 0x01CC, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01CD, 0x01CD, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01CE, 0x01CE, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01CF, 0x01CF, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01D0, 0x01D0, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01D1, 0x01D1, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01D2, 0x01D2, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01D3, 0x01D3, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01D4, 0x01D4, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01D5, 0x01D5, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01D6, 0x01D6, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01D7, 0x01D7, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01D8, 0x01D8, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01D9, 0x01D9, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01DA, 0x01DA, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01DB, 0x01DB, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01DC, 0x01DD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01DE, 0x01DE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01DF, 0x01DF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01E0, 0x01E0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01E1, 0x01E1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01E2, 0x01E2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01E3, 0x01E3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01E4, 0x01E4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01E5, 0x01E5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01E6, 0x01E6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01E7, 0x01E7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01E8, 0x01E8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01E9, 0x01E9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01EA, 0x01EA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01EB, 0x01EB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01EC, 0x01EC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01ED, 0x01ED, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01EE, 0x01EE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01EF, 0x01F0, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01F1, 0x01F2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01F3, 0x01F3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01F4, 0x01F4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01F5, 0x01F5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01F6, 0x01F8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01F9, 0x01F9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01FA, 0x01FA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01FB, 0x01FB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01FC, 0x01FC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01FD, 0x01FD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x01FE, 0x01FE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x01FF, 0x01FF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0200, 0x0200, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0201, 0x0201, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0202, 0x0202, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0203, 0x0203, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0204, 0x0204, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0205, 0x0205, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0206, 0x0206, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0207, 0x0207, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0208, 0x0208, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0209, 0x0209, PASSWORDPOLICY_CHAR_LOWER},
+    {0x020A, 0x020A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x020B, 0x020B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x020C, 0x020C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x020D, 0x020D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x020E, 0x020E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x020F, 0x020F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0210, 0x0210, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0211, 0x0211, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0212, 0x0212, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0213, 0x0213, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0214, 0x0214, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0215, 0x0215, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0216, 0x0216, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0217, 0x0217, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0218, 0x0218, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0219, 0x0219, PASSWORDPOLICY_CHAR_LOWER},
+    {0x021A, 0x021A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x021B, 0x021B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x021C, 0x021C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x021D, 0x021D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x021E, 0x021E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x021F, 0x021F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0220, 0x0220, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0221, 0x0221, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0222, 0x0222, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0223, 0x0223, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0224, 0x0224, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0225, 0x0225, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0226, 0x0226, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0227, 0x0227, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0228, 0x0228, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0229, 0x0229, PASSWORDPOLICY_CHAR_LOWER},
+    {0x022A, 0x022A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x022B, 0x022B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x022C, 0x022C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x022D, 0x022D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x022E, 0x022E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x022F, 0x022F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0230, 0x0230, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0231, 0x0231, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0232, 0x0232, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0233, 0x0239, PASSWORDPOLICY_CHAR_LOWER},
+    {0x023A, 0x023B, PASSWORDPOLICY_CHAR_UPPER},
+    {0x023C, 0x023C, PASSWORDPOLICY_CHAR_LOWER},
+    {0x023D, 0x023E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x023F, 0x0240, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0241, 0x0241, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0242, 0x0242, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0243, 0x0246, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0247, 0x0247, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0248, 0x0248, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0249, 0x0249, PASSWORDPOLICY_CHAR_LOWER},
+    {0x024A, 0x024A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x024B, 0x024B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x024C, 0x024C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x024D, 0x024D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x024E, 0x024E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x024F, 0x0293, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0294, 0x0294, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0295, 0x02AF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x02B0, 0x02C1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x02C6, 0x02D1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x02E0, 0x02E4, PASSWORDPOLICY_CHAR_LETTER},
+    {0x02EC, 0x02EC, PASSWORDPOLICY_CHAR_LETTER},
+    {0x02EE, 0x02EE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0300, 0x036F, PASSWORDPOLICY_CHAR_MARK},
+    {0x0370, 0x0370, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0371, 0x0371, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0372, 0x0372, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0373, 0x0373, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0374, 0x0374, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0376, 0x0376, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0377, 0x0377, PASSWORDPOLICY_CHAR_LOWER},
+    {0x037A, 0x037A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x037B, 0x037D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x037F, 0x037F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0386, 0x0386, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0388, 0x038A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x038C, 0x038C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x038E, 0x038F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0390, 0x0390, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0391, 0x03A1, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03A3, 0x03AB, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03AC, 0x03CE, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03CF, 0x03CF, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03D0, 0x03D1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03D2, 0x03D4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03D5, 0x03D7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03D8, 0x03D8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03D9, 0x03D9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03DA, 0x03DA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03DB, 0x03DB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03DC, 0x03DC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03DD, 0x03DD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03DE, 0x03DE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03DF, 0x03DF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03E0, 0x03E0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03E1, 0x03E1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03E2, 0x03E2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03E3, 0x03E3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03E4, 0x03E4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03E5, 0x03E5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03E6, 0x03E6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03E7, 0x03E7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03E8, 0x03E8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03E9, 0x03E9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03EA, 0x03EA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03EB, 0x03EB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03EC, 0x03EC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03ED, 0x03ED, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03EE, 0x03EE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03EF, 0x03F3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03F4, 0x03F4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03F5, 0x03F5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03F7, 0x03F7, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03F8, 0x03F8, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03F9, 0x03FA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x03FB, 0x03FC, PASSWORDPOLICY_CHAR_LOWER},
+    {0x03FD, 0x042F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0430, 0x045F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0460, 0x0460, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0461, 0x0461, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0462, 0x0462, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0463, 0x0463, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0464, 0x0464, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0465, 0x0465, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0466, 0x0466, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0467, 0x0467, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0468, 0x0468, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0469, 0x0469, PASSWORDPOLICY_CHAR_LOWER},
+    {0x046A, 0x046A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x046B, 0x046B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x046C, 0x046C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x046D, 0x046D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x046E, 0x046E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x046F, 0x046F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0470, 0x0470, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0471, 0x0471, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0472, 0x0472, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0473, 0x0473, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0474, 0x0474, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0475, 0x0475, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0476, 0x0476, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0477, 0x0477, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0478, 0x0478, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0479, 0x0479, PASSWORDPOLICY_CHAR_LOWER},
+    {0x047A, 0x047A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x047B, 0x047B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x047C, 0x047C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x047D, 0x047D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x047E, 0x047E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x047F, 0x047F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0480, 0x0480, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0481, 0x0481, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0483, 0x0489, PASSWORDPOLICY_CHAR_MARK},
+    {0x048A, 0x048A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x048B, 0x048B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x048C, 0x048C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x048D, 0x048D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x048E, 0x048E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x048F, 0x048F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0490, 0x0490, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0491, 0x0491, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0492, 0x0492, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0493, 0x0493, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0494, 0x0494, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0495, 0x0495, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0496, 0x0496, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0497, 0x0497, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0498, 0x0498, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0499, 0x0499, PASSWORDPOLICY_CHAR_LOWER},
+    {0x049A, 0x049A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x049B, 0x049B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x049C, 0x049C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x049D, 0x049D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x049E, 0x049E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x049F, 0x049F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04A0, 0x04A0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04A1, 0x04A1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04A2, 0x04A2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04A3, 0x04A3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04A4, 0x04A4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04A5, 0x04A5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04A6, 0x04A6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04A7, 0x04A7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04A8, 0x04A8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04A9, 0x04A9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04AA, 0x04AA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04AB, 0x04AB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04AC, 0x04AC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04AD, 0x04AD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04AE, 0x04AE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04AF, 0x04AF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04B0, 0x04B0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04B1, 0x04B1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04B2, 0x04B2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04B3, 0x04B3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04B4, 0x04B4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04B5, 0x04B5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04B6, 0x04B6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04B7, 0x04B7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04B8, 0x04B8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04B9, 0x04B9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04BA, 0x04BA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04BB, 0x04BB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04BC, 0x04BC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04BD, 0x04BD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04BE, 0x04BE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04BF, 0x04BF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04C0, 0x04C1, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04C2, 0x04C2, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04C3, 0x04C3, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04C4, 0x04C4, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04C5, 0x04C5, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04C6, 0x04C6, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04C7, 0x04C7, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04C8, 0x04C8, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04C9, 0x04C9, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04CA, 0x04CA, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04CB, 0x04CB, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04CC, 0x04CC, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04CD, 0x04CD, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04CE, 0x04CF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04D0, 0x04D0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04D1, 0x04D1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04D2, 0x04D2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04D3, 0x04D3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04D4, 0x04D4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04D5, 0x04D5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04D6, 0x04D6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04D7, 0x04D7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04D8, 0x04D8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04D9, 0x04D9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04DA, 0x04DA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04DB, 0x04DB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04DC, 0x04DC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04DD, 0x04DD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04DE, 0x04DE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04DF, 0x04DF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04E0, 0x04E0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04E1, 0x04E1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04E2, 0x04E2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04E3, 0x04E3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04E4, 0x04E4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04E5, 0x04E5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04E6, 0x04E6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04E7, 0x04E7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04E8, 0x04E8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04E9, 0x04E9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04EA, 0x04EA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04EB, 0x04EB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04EC, 0x04EC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04ED, 0x04ED, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04EE, 0x04EE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04EF, 0x04EF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04F0, 0x04F0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04F1, 0x04F1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04F2, 0x04F2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04F3, 0x04F3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04F4, 0x04F4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04F5, 0x04F5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04F6, 0x04F6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04F7, 0x04F7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04F8, 0x04F8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04F9, 0x04F9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04FA, 0x04FA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04FB, 0x04FB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04FC, 0x04FC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04FD, 0x04FD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x04FE, 0x04FE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x04FF, 0x04FF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0500, 0x0500, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0501, 0x0501, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0502, 0x0502, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0503, 0x0503, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0504, 0x0504, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0505, 0x0505, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0506, 0x0506, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0507, 0x0507, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0508, 0x0508, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0509, 0x0509, PASSWORDPOLICY_CHAR_LOWER},
+    {0x050A, 0x050A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x050B, 0x050B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x050C, 0x050C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x050D, 0x050D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x050E, 0x050E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x050F, 0x050F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0510, 0x0510, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0511, 0x0511, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0512, 0x0512, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0513, 0x0513, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0514, 0x0514, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0515, 0x0515, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0516, 0x0516, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0517, 0x0517, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0518, 0x0518, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0519, 0x0519, PASSWORDPOLICY_CHAR_LOWER},
+    {0x051A, 0x051A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x051B, 0x051B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x051C, 0x051C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x051D, 0x051D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x051E, 0x051E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x051F, 0x051F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0520, 0x0520, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0521, 0x0521, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0522, 0x0522, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0523, 0x0523, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0524, 0x0524, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0525, 0x0525, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0526, 0x0526, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0527, 0x0527, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0528, 0x0528, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0529, 0x0529, PASSWORDPOLICY_CHAR_LOWER},
+    {0x052A, 0x052A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x052B, 0x052B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x052C, 0x052C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x052D, 0x052D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x052E, 0x052E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x052F, 0x052F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0531, 0x0556, PASSWORDPOLICY_CHAR_UPPER},
+    {0x0559, 0x0559, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0560, 0x0588, PASSWORDPOLICY_CHAR_LOWER},
+    {0x0591, 0x05BD, PASSWORDPOLICY_CHAR_MARK},
+    {0x05BF, 0x05BF, PASSWORDPOLICY_CHAR_MARK},
+    {0x05C1, 0x05C2, PASSWORDPOLICY_CHAR_MARK},
+    {0x05C4, 0x05C5, PASSWORDPOLICY_CHAR_MARK},
+    {0x05C7, 0x05C7, PASSWORDPOLICY_CHAR_MARK},
+    {0x05D0, 0x05EA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x05EF, 0x05F2, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0610, 0x061A, PASSWORDPOLICY_CHAR_MARK},
+    {0x0620, 0x064A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x064B, 0x065F, PASSWORDPOLICY_CHAR_MARK},
+    {0x0660, 0x0669, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x066E, 0x066F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0670, 0x0670, PASSWORDPOLICY_CHAR_MARK},
+    {0x0671, 0x06D3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x06D5, 0x06D5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x06D6, 0x06DC, PASSWORDPOLICY_CHAR_MARK},
+    {0x06DF, 0x06E4, PASSWORDPOLICY_CHAR_MARK},
+    {0x06E5, 0x06E6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x06E7, 0x06E8, PASSWORDPOLICY_CHAR_MARK},
+    {0x06EA, 0x06ED, PASSWORDPOLICY_CHAR_MARK},
+    {0x06EE, 0x06EF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x06F0, 0x06F9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x06FA, 0x06FC, PASSWORDPOLICY_CHAR_LETTER},
+    {0x06FF, 0x06FF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0710, 0x0710, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0711, 0x0711, PASSWORDPOLICY_CHAR_MARK},
+    {0x0712, 0x072F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0730, 0x074A, PASSWORDPOLICY_CHAR_MARK},
+    {0x074D, 0x07A5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x07A6, 0x07B0, PASSWORDPOLICY_CHAR_MARK},
+    {0x07B1, 0x07B1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x07C0, 0x07C9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x07CA, 0x07EA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x07EB, 0x07F3, PASSWORDPOLICY_CHAR_MARK},
+    {0x07F4, 0x07F5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x07FA, 0x07FA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x07FD, 0x07FD, PASSWORDPOLICY_CHAR_MARK},
+    {0x0800, 0x0815, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0816, 0x0819, PASSWORDPOLICY_CHAR_MARK},
+    {0x081A, 0x081A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x081B, 0x0823, PASSWORDPOLICY_CHAR_MARK},
+    {0x0824, 0x0824, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0825, 0x0827, PASSWORDPOLICY_CHAR_MARK},
+    {0x0828, 0x0828, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0829, 0x082D, PASSWORDPOLICY_CHAR_MARK},
+    {0x0840, 0x0858, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0859, 0x085B, PASSWORDPOLICY_CHAR_MARK},
+    {0x0860, 0x086A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0870, 0x0887, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0889, 0x088E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0898, 0x089F, PASSWORDPOLICY_CHAR_MARK},
+    {0x08A0, 0x08C9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x08CA, 0x08E1, PASSWORDPOLICY_CHAR_MARK},
+    {0x08E3, 0x0903, PASSWORDPOLICY_CHAR_MARK},
+    {0x0904, 0x0939, PASSWORDPOLICY_CHAR_LETTER},
+    {0x093A, 0x093C, PASSWORDPOLICY_CHAR_MARK},
+    {0x093D, 0x093D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x093E, 0x094F, PASSWORDPOLICY_CHAR_MARK},
+    {0x0950, 0x0950, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0951, 0x0957, PASSWORDPOLICY_CHAR_MARK},
+    {0x0958, 0x0961, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0962, 0x0963, PASSWORDPOLICY_CHAR_MARK},
+    {0x0966, 0x096F, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0971, 0x0980, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0981, 0x0983, PASSWORDPOLICY_CHAR_MARK},
+    {0x0985, 0x098C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x098F, 0x0990, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0993, 0x09A8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09AA, 0x09B0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09B2, 0x09B2, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09B6, 0x09B9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09BC, 0x09BC, PASSWORDPOLICY_CHAR_MARK},
+    {0x09BD, 0x09BD, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09BE, 0x09C4, PASSWORDPOLICY_CHAR_MARK},
+    {0x09C7, 0x09C8, PASSWORDPOLICY_CHAR_MARK},
+    {0x09CB, 0x09CD, PASSWORDPOLICY_CHAR_MARK},
+    {0x09CE, 0x09CE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09D7, 0x09D7, PASSWORDPOLICY_CHAR_MARK},
+    {0x09DC, 0x09DD, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09DF, 0x09E1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09E2, 0x09E3, PASSWORDPOLICY_CHAR_MARK},
+    {0x09E6, 0x09EF, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x09F0, 0x09F1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09FC, 0x09FC, PASSWORDPOLICY_CHAR_LETTER},
+    {0x09FE, 0x09FE, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A01, 0x0A03, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A05, 0x0A0A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A0F, 0x0A10, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A13, 0x0A28, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A2A, 0x0A30, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A32, 0x0A33, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A35, 0x0A36, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A38, 0x0A39, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A3C, 0x0A3C, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A3E, 0x0A42, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A47, 0x0A48, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A4B, 0x0A4D, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A51, 0x0A51, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A59, 0x0A5C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A5E, 0x0A5E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A66, 0x0A6F, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0A70, 0x0A71, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A72, 0x0A74, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A75, 0x0A75, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A81, 0x0A83, PASSWORDPOLICY_CHAR_MARK},
+    {0x0A85, 0x0A8D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A8F, 0x0A91, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0A93, 0x0AA8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0AAA, 0x0AB0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0AB2, 0x0AB3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0AB5, 0x0AB9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0ABC, 0x0ABC, PASSWORDPOLICY_CHAR_MARK},
+    {0x0ABD, 0x0ABD, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0ABE, 0x0AC5, PASSWORDPOLICY_CHAR_MARK},
+    {0x0AC7, 0x0AC9, PASSWORDPOLICY_CHAR_MARK},
+    {0x0ACB, 0x0ACD, PASSWORDPOLICY_CHAR_MARK},
+    {0x0AD0, 0x0AD0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0AE0, 0x0AE1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0AE2, 0x0AE3, PASSWORDPOLICY_CHAR_MARK},
+    {0x0AE6, 0x0AEF, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0AF9, 0x0AF9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0AFA, 0x0AFF, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B01, 0x0B03, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B05, 0x0B0C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B0F, 0x0B10, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B13, 0x0B28, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B2A, 0x0B30, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B32, 0x0B33, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B35, 0x0B39, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B3C, 0x0B3C, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B3D, 0x0B3D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B3E, 0x0B44, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B47, 0x0B48, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B4B, 0x0B4D, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B55, 0x0B57, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B5C, 0x0B5D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B5F, 0x0B61, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B62, 0x0B63, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B66, 0x0B6F, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0B71, 0x0B71, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B82, 0x0B82, PASSWORDPOLICY_CHAR_MARK},
+    {0x0B83, 0x0B83, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B85, 0x0B8A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B8E, 0x0B90, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B92, 0x0B95, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B99, 0x0B9A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B9C, 0x0B9C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0B9E, 0x0B9F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0BA3, 0x0BA4, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0BA8, 0x0BAA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0BAE, 0x0BB9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0BBE, 0x0BC2, PASSWORDPOLICY_CHAR_MARK},
+    {0x0BC6, 0x0BC8, PASSWORDPOLICY_CHAR_MARK},
+    {0x0BCA, 0x0BCD, PASSWORDPOLICY_CHAR_MARK},
+    {0x0BD0, 0x0BD0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0BD7, 0x0BD7, PASSWORDPOLICY_CHAR_MARK},
+    {0x0BE6, 0x0BEF, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0C00, 0x0C04, PASSWORDPOLICY_CHAR_MARK},
+    {0x0C05, 0x0C0C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C0E, 0x0C10, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C12, 0x0C28, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C2A, 0x0C39, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C3C, 0x0C3C, PASSWORDPOLICY_CHAR_MARK},
+    {0x0C3D, 0x0C3D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C3E, 0x0C44, PASSWORDPOLICY_CHAR_MARK},
+    {0x0C46, 0x0C48, PASSWORDPOLICY_CHAR_MARK},
+    {0x0C4A, 0x0C4D, PASSWORDPOLICY_CHAR_MARK},
+    {0x0C55, 0x0C56, PASSWORDPOLICY_CHAR_MARK},
+    {0x0C58, 0x0C5A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C5D, 0x0C5D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C60, 0x0C61, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C62, 0x0C63, PASSWORDPOLICY_CHAR_MARK},
+    {0x0C66, 0x0C6F, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0C80, 0x0C80, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C81, 0x0C83, PASSWORDPOLICY_CHAR_MARK},
+    {0x0C85, 0x0C8C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C8E, 0x0C90, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0C92, 0x0CA8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0CAA, 0x0CB3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0CB5, 0x0CB9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0CBC, 0x0CBC, PASSWORDPOLICY_CHAR_MARK},
+    {0x0CBD, 0x0CBD, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0CBE, 0x0CC4, PASSWORDPOLICY_CHAR_MARK},
+    {0x0CC6, 0x0CC8, PASSWORDPOLICY_CHAR_MARK},
+    {0x0CCA, 0x0CCD, PASSWORDPOLICY_CHAR_MARK},
+    {0x0CD5, 0x0CD6, PASSWORDPOLICY_CHAR_MARK},
+    {0x0CDD, 0x0CDE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0CE0, 0x0CE1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0CE2, 0x0CE3, PASSWORDPOLICY_CHAR_MARK},
+    {0x0CE6, 0x0CEF, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0CF1, 0x0CF2, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D00, 0x0D03, PASSWORDPOLICY_CHAR_MARK},
+    {0x0D04, 0x0D0C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D0E, 0x0D10, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D12, 0x0D3A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D3B, 0x0D3C, PASSWORDPOLICY_CHAR_MARK},
+    {0x0D3D, 0x0D3D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D3E, 0x0D44, PASSWORDPOLICY_CHAR_MARK},
+    {0x0D46, 0x0D48, PASSWORDPOLICY_CHAR_MARK},
+    {0x0D4A, 0x0D4D, PASSWORDPOLICY_CHAR_MARK},
+    {0x0D4E, 0x0D4E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D54, 0x0D56, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D57, 0x0D57, PASSWORDPOLICY_CHAR_MARK},
+    {0x0D5F, 0x0D61, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D62, 0x0D63, PASSWORDPOLICY_CHAR_MARK},
+    {0x0D66, 0x0D6F, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0D7A, 0x0D7F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D81, 0x0D83, PASSWORDPOLICY_CHAR_MARK},
+    {0x0D85, 0x0D96, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0D9A, 0x0DB1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0DB3, 0x0DBB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0DBD, 0x0DBD, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0DC0, 0x0DC6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0DCA, 0x0DCA, PASSWORDPOLICY_CHAR_MARK},
+    {0x0DCF, 0x0DD4, PASSWORDPOLICY_CHAR_MARK},
+    {0x0DD6, 0x0DD6, PASSWORDPOLICY_CHAR_MARK},
+    {0x0DD8, 0x0DDF, PASSWORDPOLICY_CHAR_MARK},
+    {0x0DE6, 0x0DEF, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0DF2, 0x0DF3, PASSWORDPOLICY_CHAR_MARK},
+    {0x0E01, 0x0E30, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0E31, 0x0E31, PASSWORDPOLICY_CHAR_MARK},
+    {0x0E32, 0x0E33, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0E34, 0x0E3A, PASSWORDPOLICY_CHAR_MARK},
+    {0x0E40, 0x0E46, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0E47, 0x0E4E, PASSWORDPOLICY_CHAR_MARK},
+    {0x0E50, 0x0E59, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0E81, 0x0E82, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0E84, 0x0E84, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0E86, 0x0E8A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0E8C, 0x0EA3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0EA5, 0x0EA5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0EA7, 0x0EB0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0EB1, 0x0EB1, PASSWORDPOLICY_CHAR_MARK},
+    {0x0EB2, 0x0EB3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0EB4, 0x0EBC, PASSWORDPOLICY_CHAR_MARK},
+    {0x0EBD, 0x0EBD, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0EC0, 0x0EC4, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0EC6, 0x0EC6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0EC8, 0x0ECD, PASSWORDPOLICY_CHAR_MARK},
+    {0x0ED0, 0x0ED9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0EDC, 0x0EDF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0F00, 0x0F00, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0F18, 0x0F19, PASSWORDPOLICY_CHAR_MARK},
+    {0x0F20, 0x0F29, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x0F35, 0x0F35, PASSWORDPOLICY_CHAR_MARK},
+    {0x0F37, 0x0F37, PASSWORDPOLICY_CHAR_MARK},
+    {0x0F39, 0x0F39, PASSWORDPOLICY_CHAR_MARK},
+    {0x0F3E, 0x0F3F, PASSWORDPOLICY_CHAR_MARK},
+    {0x0F40, 0x0F47, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0F49, 0x0F6C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0F71, 0x0F84, PASSWORDPOLICY_CHAR_MARK},
+    {0x0F86, 0x0F87, PASSWORDPOLICY_CHAR_MARK},
+    {0x0F88, 0x0F8C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x0F8D, 0x0F97, PASSWORDPOLICY_CHAR_MARK},
+    {0x0F99, 0x0FBC, PASSWORDPOLICY_CHAR_MARK},
+    {0x0FC6, 0x0FC6, PASSWORDPOLICY_CHAR_MARK},
+    {0x1000, 0x102A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x102B, 0x103E, PASSWORDPOLICY_CHAR_MARK},
+    {0x103F, 0x103F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1040, 0x1049, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1050, 0x1055, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1056, 0x1059, PASSWORDPOLICY_CHAR_MARK},
+    {0x105A, 0x105D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x105E, 0x1060, PASSWORDPOLICY_CHAR_MARK},
+    {0x1061, 0x1061, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1062, 0x1064, PASSWORDPOLICY_CHAR_MARK},
+    {0x1065, 0x1066, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1067, 0x106D, PASSWORDPOLICY_CHAR_MARK},
+    {0x106E, 0x1070, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1071, 0x1074, PASSWORDPOLICY_CHAR_MARK},
+    {0x1075, 0x1081, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1082, 0x108D, PASSWORDPOLICY_CHAR_MARK},
+    {0x108E, 0x108E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x108F, 0x108F, PASSWORDPOLICY_CHAR_MARK},
+    {0x1090, 0x1099, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x109A, 0x109D, PASSWORDPOLICY_CHAR_MARK},
+    {0x10A0, 0x10C5, PASSWORDPOLICY_CHAR_UPPER},
+    {0x10C7, 0x10C7, PASSWORDPOLICY_CHAR_UPPER},
+    {0x10CD, 0x10CD, PASSWORDPOLICY_CHAR_UPPER},
+    {0x10D0, 0x10FA, PASSWORDPOLICY_CHAR_LOWER},
+    {0x10FC, 0x10FC, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10FD, 0x10FF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1100, 0x1248, PASSWORDPOLICY_CHAR_LETTER},
+    {0x124A, 0x124D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1250, 0x1256, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1258, 0x1258, PASSWORDPOLICY_CHAR_LETTER},
+    {0x125A, 0x125D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1260, 0x1288, PASSWORDPOLICY_CHAR_LETTER},
+    {0x128A, 0x128D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1290, 0x12B0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12B2, 0x12B5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12B8, 0x12BE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12C0, 0x12C0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12C2, 0x12C5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12C8, 0x12D6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12D8, 0x1310, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1312, 0x1315, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1318, 0x135A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x135D, 0x135F, PASSWORDPOLICY_CHAR_MARK},
+    {0x1380, 0x138F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x13A0, 0x13F5, PASSWORDPOLICY_CHAR_UPPER},
+    {0x13F8, 0x13FD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1401, 0x166C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x166F, 0x167F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1681, 0x169A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16A0, 0x16EA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16F1, 0x16F8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1700, 0x1711, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1712, 0x1715, PASSWORDPOLICY_CHAR_MARK},
+    {0x171F, 0x1731, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1732, 0x1734, PASSWORDPOLICY_CHAR_MARK},
+    {0x1740, 0x1751, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1752, 0x1753, PASSWORDPOLICY_CHAR_MARK},
+    {0x1760, 0x176C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x176E, 0x1770, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1772, 0x1773, PASSWORDPOLICY_CHAR_MARK},
+    {0x1780, 0x17B3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x17B4, 0x17D3, PASSWORDPOLICY_CHAR_MARK},
+    {0x17D7, 0x17D7, PASSWORDPOLICY_CHAR_LETTER},
+    {0x17DC, 0x17DC, PASSWORDPOLICY_CHAR_LETTER},
+    {0x17DD, 0x17DD, PASSWORDPOLICY_CHAR_MARK},
+    {0x17E0, 0x17E9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x180B, 0x180D, PASSWORDPOLICY_CHAR_MARK},
+    {0x180F, 0x180F, PASSWORDPOLICY_CHAR_MARK},
+    {0x1810, 0x1819, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1820, 0x1878, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1880, 0x1884, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1885, 0x1886, PASSWORDPOLICY_CHAR_MARK},
+    {0x1887, 0x18A8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x18A9, 0x18A9, PASSWORDPOLICY_CHAR_MARK},
+    {0x18AA, 0x18AA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x18B0, 0x18F5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1900, 0x191E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1920, 0x192B, PASSWORDPOLICY_CHAR_MARK},
+    {0x1930, 0x193B, PASSWORDPOLICY_CHAR_MARK},
+    {0x1946, 0x194F, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1950, 0x196D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1970, 0x1974, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1980, 0x19AB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x19B0, 0x19C9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x19D0, 0x19D9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1A00, 0x1A16, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1A17, 0x1A1B, PASSWORDPOLICY_CHAR_MARK},
+    {0x1A20, 0x1A54, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1A55, 0x1A5E, PASSWORDPOLICY_CHAR_MARK},
+    {0x1A60, 0x1A7C, PASSWORDPOLICY_CHAR_MARK},
+    {0x1A7F, 0x1A7F, PASSWORDPOLICY_CHAR_MARK},
+    {0x1A80, 0x1A89, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1A90, 0x1A99, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1AA7, 0x1AA7, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1AB0, 0x1ACE, PASSWORDPOLICY_CHAR_MARK},
+    {0x1B00, 0x1B04, PASSWORDPOLICY_CHAR_MARK},
+    {0x1B05, 0x1B33, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1B34, 0x1B44, PASSWORDPOLICY_CHAR_MARK},
+    {0x1B45, 0x1B4C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1B50, 0x1B59, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1B6B, 0x1B73, PASSWORDPOLICY_CHAR_MARK},
+    {0x1B80, 0x1B82, PASSWORDPOLICY_CHAR_MARK},
+    {0x1B83, 0x1BA0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1BA1, 0x1BAD, PASSWORDPOLICY_CHAR_MARK},
+    {0x1BAE, 0x1BAF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1BB0, 0x1BB9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1BBA, 0x1BE5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1BE6, 0x1BF3, PASSWORDPOLICY_CHAR_MARK},
+    {0x1C00, 0x1C23, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1C24, 0x1C37, PASSWORDPOLICY_CHAR_MARK},
+    {0x1C40, 0x1C49, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1C4D, 0x1C4F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1C50, 0x1C59, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1C5A, 0x1C7D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1C80, 0x1C88, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1C90, 0x1CBA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1CBD, 0x1CBF, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1CD0, 0x1CD2, PASSWORDPOLICY_CHAR_MARK},
+    {0x1CD4, 0x1CE8, PASSWORDPOLICY_CHAR_MARK},
+    {0x1CE9, 0x1CEC, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1CED, 0x1CED, PASSWORDPOLICY_CHAR_MARK},
+    {0x1CEE, 0x1CF3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1CF4, 0x1CF4, PASSWORDPOLICY_CHAR_MARK},
+    {0x1CF5, 0x1CF6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1CF7, 0x1CF9, PASSWORDPOLICY_CHAR_MARK},
+    {0x1CFA, 0x1CFA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1D00, 0x1D2B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D2C, 0x1D6A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1D6B, 0x1D77, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D78, 0x1D78, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1D79, 0x1D9A, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D9B, 0x1DBF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1DC0, 0x1DFF, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E00, 0x1E00, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E01, 0x1E01, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E02, 0x1E02, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E03, 0x1E03, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E04, 0x1E04, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E05, 0x1E05, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E06, 0x1E06, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E07, 0x1E07, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E08, 0x1E08, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E09, 0x1E09, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E0A, 0x1E0A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E0B, 0x1E0B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E0C, 0x1E0C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E0D, 0x1E0D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E0E, 0x1E0E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E0F, 0x1E0F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E10, 0x1E10, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E11, 0x1E11, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E12, 0x1E12, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E13, 0x1E13, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E14, 0x1E14, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E15, 0x1E15, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E16, 0x1E16, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E17, 0x1E17, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E18, 0x1E18, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E19, 0x1E19, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E1A, 0x1E1A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E1B, 0x1E1B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E1C, 0x1E1C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E1D, 0x1E1D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E1E, 0x1E1E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E1F, 0x1E1F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E20, 0x1E20, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E21, 0x1E21, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E22, 0x1E22, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E23, 0x1E23, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E24, 0x1E24, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E25, 0x1E25, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E26, 0x1E26, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E27, 0x1E27, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E28, 0x1E28, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E29, 0x1E29, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E2A, 0x1E2A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E2B, 0x1E2B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E2C, 0x1E2C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E2D, 0x1E2D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E2E, 0x1E2E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E2F, 0x1E2F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E30, 0x1E30, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E31, 0x1E31, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E32, 0x1E32, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E33, 0x1E33, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E34, 0x1E34, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E35, 0x1E35, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E36, 0x1E36, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E37, 0x1E37, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E38, 0x1E38, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E39, 0x1E39, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E3A, 0x1E3A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E3B, 0x1E3B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E3C, 0x1E3C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E3D, 0x1E3D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E3E, 0x1E3E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E3F, 0x1E3F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E40, 0x1E40, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E41, 0x1E41, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E42, 0x1E42, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E43, 0x1E43, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E44, 0x1E44, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E45, 0x1E45, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E46, 0x1E46, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E47, 0x1E47, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E48, 0x1E48, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E49, 0x1E49, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E4A, 0x1E4A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E4B, 0x1E4B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E4C, 0x1E4C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E4D, 0x1E4D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E4E, 0x1E4E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E4F, 0x1E4F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E50, 0x1E50, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E51, 0x1E51, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E52, 0x1E52, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E53, 0x1E53, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E54, 0x1E54, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E55, 0x1E55, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E56, 0x1E56, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E57, 0x1E57, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E58, 0x1E58, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E59, 0x1E59, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E5A, 0x1E5A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E5B, 0x1E5B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E5C, 0x1E5C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E5D, 0x1E5D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E5E, 0x1E5E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E5F, 0x1E5F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E60, 0x1E60, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E61, 0x1E61, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E62, 0x1E62, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E63, 0x1E63, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E64, 0x1E64, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E65, 0x1E65, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E66, 0x1E66, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E67, 0x1E67, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E68, 0x1E68, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E69, 0x1E69, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E6A, 0x1E6A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E6B, 0x1E6B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E6C, 0x1E6C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E6D, 0x1E6D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E6E, 0x1E6E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E6F, 0x1E6F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E70, 0x1E70, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E71, 0x1E71, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E72, 0x1E72, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E73, 0x1E73, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E74, 0x1E74, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E75, 0x1E75, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E76, 0x1E76, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E77, 0x1E77, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E78, 0x1E78, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E79, 0x1E79, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E7A, 0x1E7A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E7B, 0x1E7B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E7C, 0x1E7C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E7D, 0x1E7D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E7E, 0x1E7E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E7F, 0x1E7F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E80, 0x1E80, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E81, 0x1E81, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E82, 0x1E82, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E83, 0x1E83, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E84, 0x1E84, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E85, 0x1E85, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E86, 0x1E86, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E87, 0x1E87, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E88, 0x1E88, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E89, 0x1E89, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E8A, 0x1E8A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E8B, 0x1E8B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E8C, 0x1E8C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E8D, 0x1E8D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E8E, 0x1E8E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E8F, 0x1E8F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E90, 0x1E90, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E91, 0x1E91, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E92, 0x1E92, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E93, 0x1E93, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E94, 0x1E94, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E95, 0x1E9D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E9E, 0x1E9E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E9F, 0x1E9F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EA0, 0x1EA0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EA1, 0x1EA1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EA2, 0x1EA2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EA3, 0x1EA3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EA4, 0x1EA4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EA5, 0x1EA5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EA6, 0x1EA6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EA7, 0x1EA7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EA8, 0x1EA8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EA9, 0x1EA9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EAA, 0x1EAA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EAB, 0x1EAB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EAC, 0x1EAC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EAD, 0x1EAD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EAE, 0x1EAE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EAF, 0x1EAF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EB0, 0x1EB0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EB1, 0x1EB1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EB2, 0x1EB2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EB3, 0x1EB3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EB4, 0x1EB4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EB5, 0x1EB5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EB6, 0x1EB6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EB7, 0x1EB7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EB8, 0x1EB8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EB9, 0x1EB9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EBA, 0x1EBA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EBB, 0x1EBB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EBC, 0x1EBC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EBD, 0x1EBD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EBE, 0x1EBE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EBF, 0x1EBF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EC0, 0x1EC0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EC1, 0x1EC1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EC2, 0x1EC2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EC3, 0x1EC3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EC4, 0x1EC4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EC5, 0x1EC5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EC6, 0x1EC6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EC7, 0x1EC7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EC8, 0x1EC8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EC9, 0x1EC9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1ECA, 0x1ECA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1ECB, 0x1ECB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1ECC, 0x1ECC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1ECD, 0x1ECD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1ECE, 0x1ECE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1ECF, 0x1ECF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1ED0, 0x1ED0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1ED1, 0x1ED1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1ED2, 0x1ED2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1ED3, 0x1ED3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1ED4, 0x1ED4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1ED5, 0x1ED5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1ED6, 0x1ED6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1ED7, 0x1ED7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1ED8, 0x1ED8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1ED9, 0x1ED9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EDA, 0x1EDA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EDB, 0x1EDB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EDC, 0x1EDC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EDD, 0x1EDD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EDE, 0x1EDE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EDF, 0x1EDF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EE0, 0x1EE0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EE1, 0x1EE1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EE2, 0x1EE2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EE3, 0x1EE3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EE4, 0x1EE4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EE5, 0x1EE5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EE6, 0x1EE6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EE7, 0x1EE7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EE8, 0x1EE8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EE9, 0x1EE9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EEA, 0x1EEA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EEB, 0x1EEB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EEC, 0x1EEC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EED, 0x1EED, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EEE, 0x1EEE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EEF, 0x1EEF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EF0, 0x1EF0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EF1, 0x1EF1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EF2, 0x1EF2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EF3, 0x1EF3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EF4, 0x1EF4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EF5, 0x1EF5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EF6, 0x1EF6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EF7, 0x1EF7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EF8, 0x1EF8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EF9, 0x1EF9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EFA, 0x1EFA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EFB, 0x1EFB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EFC, 0x1EFC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EFD, 0x1EFD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1EFE, 0x1EFE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1EFF, 0x1F07, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F08, 0x1F0F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F10, 0x1F15, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F18, 0x1F1D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F20, 0x1F27, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F28, 0x1F2F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F30, 0x1F37, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F38, 0x1F3F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F40, 0x1F45, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F48, 0x1F4D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F50, 0x1F57, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F59, 0x1F59, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F5B, 0x1F5B, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F5D, 0x1F5D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F5F, 0x1F5F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F60, 0x1F67, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F68, 0x1F6F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F70, 0x1F7D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F80, 0x1F87, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F88, 0x1F8F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1F90, 0x1F97, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1F98, 0x1F9F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1FA0, 0x1FA7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FA8, 0x1FAF, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1FB0, 0x1FB4, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FB6, 0x1FB7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FB8, 0x1FBC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1FBE, 0x1FBE, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FC2, 0x1FC4, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FC6, 0x1FC7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FC8, 0x1FCC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1FD0, 0x1FD3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FD6, 0x1FD7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FD8, 0x1FDB, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1FE0, 0x1FE7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FE8, 0x1FEC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1FF2, 0x1FF4, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FF6, 0x1FF7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1FF8, 0x1FFC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2071, 0x2071, PASSWORDPOLICY_CHAR_LETTER},
+    {0x207F, 0x207F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2090, 0x209C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x20D0, 0x20F0, PASSWORDPOLICY_CHAR_MARK},
+    {0x2102, 0x2102, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2107, 0x2107, PASSWORDPOLICY_CHAR_UPPER},
+    {0x210A, 0x210A, PASSWORDPOLICY_CHAR_LOWER},
+    {0x210B, 0x210D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x210E, 0x210F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2110, 0x2112, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2113, 0x2113, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2115, 0x2115, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2119, 0x211D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2124, 0x2124, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2126, 0x2126, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2128, 0x2128, PASSWORDPOLICY_CHAR_UPPER},
+    {0x212A, 0x212D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x212F, 0x212F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2130, 0x2133, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2134, 0x2134, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2135, 0x2138, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2139, 0x2139, PASSWORDPOLICY_CHAR_LOWER},
+    {0x213C, 0x213D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x213E, 0x213F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2145, 0x2145, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2146, 0x2149, PASSWORDPOLICY_CHAR_LOWER},
+    {0x214E, 0x214E, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2183, 0x2183, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2184, 0x2184, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C00, 0x2C2F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C30, 0x2C5F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C60, 0x2C60, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C61, 0x2C61, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C62, 0x2C64, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C65, 0x2C66, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C67, 0x2C67, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C68, 0x2C68, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C69, 0x2C69, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C6A, 0x2C6A, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C6B, 0x2C6B, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C6C, 0x2C6C, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C6D, 0x2C70, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C71, 0x2C71, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C72, 0x2C72, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C73, 0x2C74, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C75, 0x2C75, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C76, 0x2C7B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C7C, 0x2C7D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2C7E, 0x2C80, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C81, 0x2C81, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C82, 0x2C82, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C83, 0x2C83, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C84, 0x2C84, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C85, 0x2C85, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C86, 0x2C86, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C87, 0x2C87, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C88, 0x2C88, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C89, 0x2C89, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C8A, 0x2C8A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C8B, 0x2C8B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C8C, 0x2C8C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C8D, 0x2C8D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C8E, 0x2C8E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C8F, 0x2C8F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C90, 0x2C90, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C91, 0x2C91, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C92, 0x2C92, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C93, 0x2C93, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C94, 0x2C94, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C95, 0x2C95, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C96, 0x2C96, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C97, 0x2C97, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C98, 0x2C98, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C99, 0x2C99, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C9A, 0x2C9A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C9B, 0x2C9B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C9C, 0x2C9C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C9D, 0x2C9D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2C9E, 0x2C9E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2C9F, 0x2C9F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CA0, 0x2CA0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CA1, 0x2CA1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CA2, 0x2CA2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CA3, 0x2CA3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CA4, 0x2CA4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CA5, 0x2CA5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CA6, 0x2CA6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CA7, 0x2CA7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CA8, 0x2CA8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CA9, 0x2CA9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CAA, 0x2CAA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CAB, 0x2CAB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CAC, 0x2CAC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CAD, 0x2CAD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CAE, 0x2CAE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CAF, 0x2CAF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CB0, 0x2CB0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CB1, 0x2CB1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CB2, 0x2CB2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CB3, 0x2CB3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CB4, 0x2CB4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CB5, 0x2CB5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CB6, 0x2CB6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CB7, 0x2CB7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CB8, 0x2CB8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CB9, 0x2CB9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CBA, 0x2CBA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CBB, 0x2CBB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CBC, 0x2CBC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CBD, 0x2CBD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CBE, 0x2CBE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CBF, 0x2CBF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CC0, 0x2CC0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CC1, 0x2CC1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CC2, 0x2CC2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CC3, 0x2CC3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CC4, 0x2CC4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CC5, 0x2CC5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CC6, 0x2CC6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CC7, 0x2CC7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CC8, 0x2CC8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CC9, 0x2CC9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CCA, 0x2CCA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CCB, 0x2CCB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CCC, 0x2CCC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CCD, 0x2CCD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CCE, 0x2CCE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CCF, 0x2CCF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CD0, 0x2CD0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CD1, 0x2CD1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CD2, 0x2CD2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CD3, 0x2CD3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CD4, 0x2CD4, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CD5, 0x2CD5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CD6, 0x2CD6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CD7, 0x2CD7, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CD8, 0x2CD8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CD9, 0x2CD9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CDA, 0x2CDA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CDB, 0x2CDB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CDC, 0x2CDC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CDD, 0x2CDD, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CDE, 0x2CDE, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CDF, 0x2CDF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CE0, 0x2CE0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CE1, 0x2CE1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CE2, 0x2CE2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CE3, 0x2CE4, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CEB, 0x2CEB, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CEC, 0x2CEC, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CED, 0x2CED, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CEE, 0x2CEE, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2CEF, 0x2CF1, PASSWORDPOLICY_CHAR_MARK},
+    {0x2CF2, 0x2CF2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x2CF3, 0x2CF3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2D00, 0x2D25, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2D27, 0x2D27, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2D2D, 0x2D2D, PASSWORDPOLICY_CHAR_LOWER},
+    {0x2D30, 0x2D67, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2D6F, 0x2D6F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2D7F, 0x2D7F, PASSWORDPOLICY_CHAR_MARK},
+    {0x2D80, 0x2D96, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DA0, 0x2DA6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DA8, 0x2DAE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DB0, 0x2DB6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DB8, 0x2DBE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DC0, 0x2DC6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DC8, 0x2DCE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DD0, 0x2DD6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DD8, 0x2DDE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2DE0, 0x2DFF, PASSWORDPOLICY_CHAR_MARK},
+    {0x2E2F, 0x2E2F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x3005, 0x3006, PASSWORDPOLICY_CHAR_LETTER},
+    {0x302A, 0x302F, PASSWORDPOLICY_CHAR_MARK},
+    {0x3031, 0x3035, PASSWORDPOLICY_CHAR_LETTER},
+    {0x303B, 0x303C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x3041, 0x3096, PASSWORDPOLICY_CHAR_LETTER},
+    {0x3099, 0x309A, PASSWORDPOLICY_CHAR_MARK},
+    {0x309D, 0x309F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x30A1, 0x30FA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x30FC, 0x30FF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x3105, 0x312F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x3131, 0x318E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x31A0, 0x31BF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x31F0, 0x31FF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x3400, 0x4DBF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x4E00, 0xA48C, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA4D0, 0xA4FD, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA500, 0xA60C, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA610, 0xA61F, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA620, 0xA629, PASSWORDPOLICY_CHAR_DIGIT},
+    {0xA62A, 0xA62B, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA640, 0xA640, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA641, 0xA641, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA642, 0xA642, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA643, 0xA643, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA644, 0xA644, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA645, 0xA645, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA646, 0xA646, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA647, 0xA647, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA648, 0xA648, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA649, 0xA649, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA64A, 0xA64A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA64B, 0xA64B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA64C, 0xA64C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA64D, 0xA64D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA64E, 0xA64E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA64F, 0xA64F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA650, 0xA650, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA651, 0xA651, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA652, 0xA652, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA653, 0xA653, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA654, 0xA654, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA655, 0xA655, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA656, 0xA656, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA657, 0xA657, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA658, 0xA658, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA659, 0xA659, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA65A, 0xA65A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA65B, 0xA65B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA65C, 0xA65C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA65D, 0xA65D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA65E, 0xA65E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA65F, 0xA65F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA660, 0xA660, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA661, 0xA661, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA662, 0xA662, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA663, 0xA663, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA664, 0xA664, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA665, 0xA665, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA666, 0xA666, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA667, 0xA667, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA668, 0xA668, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA669, 0xA669, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA66A, 0xA66A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA66B, 0xA66B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA66C, 0xA66C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA66D, 0xA66D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA66E, 0xA66E, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA66F, 0xA672, PASSWORDPOLICY_CHAR_MARK},
+    {0xA674, 0xA67D, PASSWORDPOLICY_CHAR_MARK},
+    {0xA67F, 0xA67F, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA680, 0xA680, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA681, 0xA681, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA682, 0xA682, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA683, 0xA683, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA684, 0xA684, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA685, 0xA685, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA686, 0xA686, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA687, 0xA687, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA688, 0xA688, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA689, 0xA689, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA68A, 0xA68A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA68B, 0xA68B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA68C, 0xA68C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA68D, 0xA68D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA68E, 0xA68E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA68F, 0xA68F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA690, 0xA690, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA691, 0xA691, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA692, 0xA692, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA693, 0xA693, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA694, 0xA694, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA695, 0xA695, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA696, 0xA696, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA697, 0xA697, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA698, 0xA698, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA699, 0xA699, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA69A, 0xA69A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA69B, 0xA69B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA69C, 0xA69D, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA69E, 0xA69F, PASSWORDPOLICY_CHAR_MARK},
+    {0xA6A0, 0xA6E5, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA6F0, 0xA6F1, PASSWORDPOLICY_CHAR_MARK},
+    {0xA717, 0xA71F, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA722, 0xA722, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA723, 0xA723, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA724, 0xA724, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA725, 0xA725, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA726, 0xA726, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA727, 0xA727, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA728, 0xA728, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA729, 0xA729, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA72A, 0xA72A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA72B, 0xA72B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA72C, 0xA72C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA72D, 0xA72D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA72E, 0xA72E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA72F, 0xA731, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA732, 0xA732, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA733, 0xA733, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA734, 0xA734, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA735, 0xA735, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA736, 0xA736, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA737, 0xA737, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA738, 0xA738, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA739, 0xA739, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA73A, 0xA73A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA73B, 0xA73B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA73C, 0xA73C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA73D, 0xA73D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA73E, 0xA73E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA73F, 0xA73F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA740, 0xA740, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA741, 0xA741, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA742, 0xA742, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA743, 0xA743, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA744, 0xA744, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA745, 0xA745, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA746, 0xA746, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA747, 0xA747, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA748, 0xA748, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA749, 0xA749, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA74A, 0xA74A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA74B, 0xA74B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA74C, 0xA74C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA74D, 0xA74D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA74E, 0xA74E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA74F, 0xA74F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA750, 0xA750, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA751, 0xA751, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA752, 0xA752, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA753, 0xA753, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA754, 0xA754, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA755, 0xA755, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA756, 0xA756, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA757, 0xA757, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA758, 0xA758, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA759, 0xA759, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA75A, 0xA75A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA75B, 0xA75B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA75C, 0xA75C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA75D, 0xA75D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA75E, 0xA75E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA75F, 0xA75F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA760, 0xA760, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA761, 0xA761, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA762, 0xA762, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA763, 0xA763, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA764, 0xA764, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA765, 0xA765, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA766, 0xA766, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA767, 0xA767, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA768, 0xA768, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA769, 0xA769, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA76A, 0xA76A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA76B, 0xA76B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA76C, 0xA76C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA76D, 0xA76D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA76E, 0xA76E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA76F, 0xA76F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA770, 0xA770, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA771, 0xA778, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA779, 0xA779, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA77A, 0xA77A, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA77B, 0xA77B, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA77C, 0xA77C, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA77D, 0xA77E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA77F, 0xA77F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA780, 0xA780, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA781, 0xA781, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA782, 0xA782, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA783, 0xA783, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA784, 0xA784, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA785, 0xA785, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA786, 0xA786, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA787, 0xA787, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA788, 0xA788, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA78B, 0xA78B, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA78C, 0xA78C, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA78D, 0xA78D, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA78E, 0xA78E, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA78F, 0xA78F, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA790, 0xA790, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA791, 0xA791, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA792, 0xA792, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA793, 0xA795, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA796, 0xA796, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA797, 0xA797, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA798, 0xA798, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA799, 0xA799, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA79A, 0xA79A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA79B, 0xA79B, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA79C, 0xA79C, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA79D, 0xA79D, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA79E, 0xA79E, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA79F, 0xA79F, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7A0, 0xA7A0, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7A1, 0xA7A1, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7A2, 0xA7A2, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7A3, 0xA7A3, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7A4, 0xA7A4, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7A5, 0xA7A5, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7A6, 0xA7A6, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7A7, 0xA7A7, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7A8, 0xA7A8, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7A9, 0xA7A9, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7AA, 0xA7AE, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7AF, 0xA7AF, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7B0, 0xA7B4, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7B5, 0xA7B5, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7B6, 0xA7B6, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7B7, 0xA7B7, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7B8, 0xA7B8, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7B9, 0xA7B9, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7BA, 0xA7BA, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7BB, 0xA7BB, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7BC, 0xA7BC, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7BD, 0xA7BD, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7BE, 0xA7BE, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7BF, 0xA7BF, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7C0, 0xA7C0, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7C1, 0xA7C1, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7C2, 0xA7C2, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7C3, 0xA7C3, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7C4, 0xA7C7, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7C8, 0xA7C8, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7C9, 0xA7C9, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7CA, 0xA7CA, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7D0, 0xA7D0, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7D1, 0xA7D1, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7D3, 0xA7D3, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7D5, 0xA7D5, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7D6, 0xA7D6, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7D7, 0xA7D7, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7D8, 0xA7D8, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7D9, 0xA7D9, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7F2, 0xA7F4, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA7F5, 0xA7F5, PASSWORDPOLICY_CHAR_UPPER},
+    {0xA7F6, 0xA7F6, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7F7, 0xA7F9, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA7FA, 0xA7FA, PASSWORDPOLICY_CHAR_LOWER},
+    {0xA7FB, 0xA801, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA802, 0xA802, PASSWORDPOLICY_CHAR_MARK},
+    {0xA803, 0xA805, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA806, 0xA806, PASSWORDPOLICY_CHAR_MARK},
+    {0xA807, 0xA80A, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA80B, 0xA80B, PASSWORDPOLICY_CHAR_MARK},
+    {0xA80C, 0xA822, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA823, 0xA827, PASSWORDPOLICY_CHAR_MARK},
+    {0xA82C, 0xA82C, PASSWORDPOLICY_CHAR_MARK},
+    {0xA840, 0xA873, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA880, 0xA881, PASSWORDPOLICY_CHAR_MARK},
+    {0xA882, 0xA8B3, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA8B4, 0xA8C5, PASSWORDPOLICY_CHAR_MARK},
+    {0xA8D0, 0xA8D9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0xA8E0, 0xA8F1, PASSWORDPOLICY_CHAR_MARK},
+    {0xA8F2, 0xA8F7, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA8FB, 0xA8FB, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA8FD, 0xA8FE, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA8FF, 0xA8FF, PASSWORDPOLICY_CHAR_MARK},
+    {0xA900, 0xA909, PASSWORDPOLICY_CHAR_DIGIT},
+    {0xA90A, 0xA925, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA926, 0xA92D, PASSWORDPOLICY_CHAR_MARK},
+    {0xA930, 0xA946, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA947, 0xA953, PASSWORDPOLICY_CHAR_MARK},
+    {0xA960, 0xA97C, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA980, 0xA983, PASSWORDPOLICY_CHAR_MARK},
+    {0xA984, 0xA9B2, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA9B3, 0xA9C0, PASSWORDPOLICY_CHAR_MARK},
+    {0xA9CF, 0xA9CF, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA9D0, 0xA9D9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0xA9E0, 0xA9E4, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA9E5, 0xA9E5, PASSWORDPOLICY_CHAR_MARK},
+    {0xA9E6, 0xA9EF, PASSWORDPOLICY_CHAR_LETTER},
+    {0xA9F0, 0xA9F9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0xA9FA, 0xA9FE, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAA00, 0xAA28, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAA29, 0xAA36, PASSWORDPOLICY_CHAR_MARK},
+    {0xAA40, 0xAA42, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAA43, 0xAA43, PASSWORDPOLICY_CHAR_MARK},
+    {0xAA44, 0xAA4B, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAA4C, 0xAA4D, PASSWORDPOLICY_CHAR_MARK},
+    {0xAA50, 0xAA59, PASSWORDPOLICY_CHAR_DIGIT},
+    {0xAA60, 0xAA76, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAA7A, 0xAA7A, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAA7B, 0xAA7D, PASSWORDPOLICY_CHAR_MARK},
+    {0xAA7E, 0xAAAF, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAAB0, 0xAAB0, PASSWORDPOLICY_CHAR_MARK},
+    {0xAAB1, 0xAAB1, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAAB2, 0xAAB4, PASSWORDPOLICY_CHAR_MARK},
+    {0xAAB5, 0xAAB6, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAAB7, 0xAAB8, PASSWORDPOLICY_CHAR_MARK},
+    {0xAAB9, 0xAABD, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAABE, 0xAABF, PASSWORDPOLICY_CHAR_MARK},
+    {0xAAC0, 0xAAC0, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAAC1, 0xAAC1, PASSWORDPOLICY_CHAR_MARK},
+    {0xAAC2, 0xAAC2, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAADB, 0xAADD, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAAE0, 0xAAEA, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAAEB, 0xAAEF, PASSWORDPOLICY_CHAR_MARK},
+    {0xAAF2, 0xAAF4, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAAF5, 0xAAF6, PASSWORDPOLICY_CHAR_MARK},
+    {0xAB01, 0xAB06, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAB09, 0xAB0E, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAB11, 0xAB16, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAB20, 0xAB26, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAB28, 0xAB2E, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAB30, 0xAB5A, PASSWORDPOLICY_CHAR_LOWER},
+    {0xAB5C, 0xAB5F, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAB60, 0xAB68, PASSWORDPOLICY_CHAR_LOWER},
+    {0xAB69, 0xAB69, PASSWORDPOLICY_CHAR_LETTER},
+    {0xAB70, 0xABBF, PASSWORDPOLICY_CHAR_LOWER},
+    {0xABC0, 0xABE2, PASSWORDPOLICY_CHAR_LETTER},
+    {0xABE3, 0xABEA, PASSWORDPOLICY_CHAR_MARK},
+    {0xABEC, 0xABED, PASSWORDPOLICY_CHAR_MARK},
+    {0xABF0, 0xABF9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0xAC00, 0xD7A3, PASSWORDPOLICY_CHAR_LETTER},
+    {0xD7B0, 0xD7C6, PASSWORDPOLICY_CHAR_LETTER},
+    {0xD7CB, 0xD7FB, PASSWORDPOLICY_CHAR_LETTER},
+    {0xF900, 0xFA6D, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFA70, 0xFAD9, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFB00, 0xFB06, PASSWORDPOLICY_CHAR_LOWER},
+    {0xFB13, 0xFB17, PASSWORDPOLICY_CHAR_LOWER},
+    {0xFB1D, 0xFB1D, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFB1E, 0xFB1E, PASSWORDPOLICY_CHAR_MARK},
+    {0xFB1F, 0xFB28, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFB2A, 0xFB36, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFB38, 0xFB3C, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFB3E, 0xFB3E, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFB40, 0xFB41, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFB43, 0xFB44, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFB46, 0xFBB1, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFBD3, 0xFD3D, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFD50, 0xFD8F, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFD92, 0xFDC7, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFDF0, 0xFDFB, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFE00, 0xFE0F, PASSWORDPOLICY_CHAR_MARK},
+    {0xFE20, 0xFE2F, PASSWORDPOLICY_CHAR_MARK},
+    {0xFE70, 0xFE74, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFE76, 0xFEFC, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFF10, 0xFF19, PASSWORDPOLICY_CHAR_DIGIT},
+    {0xFF21, 0xFF3A, PASSWORDPOLICY_CHAR_UPPER},
+    {0xFF41, 0xFF5A, PASSWORDPOLICY_CHAR_LOWER},
+    {0xFF66, 0xFFBE, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFFC2, 0xFFC7, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFFCA, 0xFFCF, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFFD2, 0xFFD7, PASSWORDPOLICY_CHAR_LETTER},
+    {0xFFDA, 0xFFDC, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10000, 0x1000B, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1000D, 0x10026, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10028, 0x1003A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1003C, 0x1003D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1003F, 0x1004D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10050, 0x1005D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10080, 0x100FA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x101FD, 0x101FD, PASSWORDPOLICY_CHAR_MARK},
+    {0x10280, 0x1029C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x102A0, 0x102D0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x102E0, 0x102E0, PASSWORDPOLICY_CHAR_MARK},
+    {0x10300, 0x1031F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1032D, 0x10340, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10342, 0x10349, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10350, 0x10375, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10376, 0x1037A, PASSWORDPOLICY_CHAR_MARK},
+    {0x10380, 0x1039D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x103A0, 0x103C3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x103C8, 0x103CF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10400, 0x10427, PASSWORDPOLICY_CHAR_UPPER},
+    {0x10428, 0x1044F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x10450, 0x1049D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x104A0, 0x104A9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x104B0, 0x104D3, PASSWORDPOLICY_CHAR_UPPER},
+    {0x104D8, 0x104FB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x10500, 0x10527, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10530, 0x10563, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10570, 0x1057A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1057C, 0x1058A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1058C, 0x10592, PASSWORDPOLICY_CHAR_UPPER},
+    {0x10594, 0x10595, PASSWORDPOLICY_CHAR_UPPER},
+    {0x10597, 0x105A1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x105A3, 0x105B1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x105B3, 0x105B9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x105BB, 0x105BC, PASSWORDPOLICY_CHAR_LOWER},
+    {0x10600, 0x10736, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10740, 0x10755, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10760, 0x10767, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10780, 0x10785, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10787, 0x107B0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x107B2, 0x107BA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10800, 0x10805, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10808, 0x10808, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1080A, 0x10835, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10837, 0x10838, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1083C, 0x1083C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1083F, 0x10855, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10860, 0x10876, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10880, 0x1089E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x108E0, 0x108F2, PASSWORDPOLICY_CHAR_LETTER},
+    {0x108F4, 0x108F5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10900, 0x10915, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10920, 0x10939, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10980, 0x109B7, PASSWORDPOLICY_CHAR_LETTER},
+    {0x109BE, 0x109BF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10A00, 0x10A00, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10A01, 0x10A03, PASSWORDPOLICY_CHAR_MARK},
+    {0x10A05, 0x10A06, PASSWORDPOLICY_CHAR_MARK},
+    {0x10A0C, 0x10A0F, PASSWORDPOLICY_CHAR_MARK},
+    {0x10A10, 0x10A13, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10A15, 0x10A17, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10A19, 0x10A35, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10A38, 0x10A3A, PASSWORDPOLICY_CHAR_MARK},
+    {0x10A3F, 0x10A3F, PASSWORDPOLICY_CHAR_MARK},
+    {0x10A60, 0x10A7C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10A80, 0x10A9C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10AC0, 0x10AC7, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10AC9, 0x10AE4, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10AE5, 0x10AE6, PASSWORDPOLICY_CHAR_MARK},
+    {0x10B00, 0x10B35, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10B40, 0x10B55, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10B60, 0x10B72, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10B80, 0x10B91, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10C00, 0x10C48, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10C80, 0x10CB2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x10CC0, 0x10CF2, PASSWORDPOLICY_CHAR_LOWER},
+    {0x10D00, 0x10D23, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10D24, 0x10D27, PASSWORDPOLICY_CHAR_MARK},
+    {0x10D30, 0x10D39, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x10E80, 0x10EA9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10EAB, 0x10EAC, PASSWORDPOLICY_CHAR_MARK},
+    {0x10EB0, 0x10EB1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10F00, 0x10F1C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10F27, 0x10F27, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10F30, 0x10F45, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10F46, 0x10F50, PASSWORDPOLICY_CHAR_MARK},
+    {0x10F70, 0x10F81, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10F82, 0x10F85, PASSWORDPOLICY_CHAR_MARK},
+    {0x10FB0, 0x10FC4, PASSWORDPOLICY_CHAR_LETTER},
+    {0x10FE0, 0x10FF6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11000, 0x11002, PASSWORDPOLICY_CHAR_MARK},
+    {0x11003, 0x11037, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11038, 0x11046, PASSWORDPOLICY_CHAR_MARK},
+    {0x11066, 0x1106F, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11070, 0x11070, PASSWORDPOLICY_CHAR_MARK},
+    {0x11071, 0x11072, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11073, 0x11074, PASSWORDPOLICY_CHAR_MARK},
+    {0x11075, 0x11075, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1107F, 0x11082, PASSWORDPOLICY_CHAR_MARK},
+    {0x11083, 0x110AF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x110B0, 0x110BA, PASSWORDPOLICY_CHAR_MARK},
+    {0x110C2, 0x110C2, PASSWORDPOLICY_CHAR_MARK},
+    {0x110D0, 0x110E8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x110F0, 0x110F9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11100, 0x11102, PASSWORDPOLICY_CHAR_MARK},
+    {0x11103, 0x11126, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11127, 0x11134, PASSWORDPOLICY_CHAR_MARK},
+    {0x11136, 0x1113F, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11144, 0x11144, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11145, 0x11146, PASSWORDPOLICY_CHAR_MARK},
+    {0x11147, 0x11147, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11150, 0x11172, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11173, 0x11173, PASSWORDPOLICY_CHAR_MARK},
+    {0x11176, 0x11176, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11180, 0x11182, PASSWORDPOLICY_CHAR_MARK},
+    {0x11183, 0x111B2, PASSWORDPOLICY_CHAR_LETTER},
+    {0x111B3, 0x111C0, PASSWORDPOLICY_CHAR_MARK},
+    {0x111C1, 0x111C4, PASSWORDPOLICY_CHAR_LETTER},
+    {0x111C9, 0x111CC, PASSWORDPOLICY_CHAR_MARK},
+    {0x111CE, 0x111CF, PASSWORDPOLICY_CHAR_MARK},
+    {0x111D0, 0x111D9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x111DA, 0x111DA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x111DC, 0x111DC, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11200, 0x11211, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11213, 0x1122B, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1122C, 0x11237, PASSWORDPOLICY_CHAR_MARK},
+    {0x1123E, 0x1123E, PASSWORDPOLICY_CHAR_MARK},
+    {0x11280, 0x11286, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11288, 0x11288, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1128A, 0x1128D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1128F, 0x1129D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1129F, 0x112A8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x112B0, 0x112DE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x112DF, 0x112EA, PASSWORDPOLICY_CHAR_MARK},
+    {0x112F0, 0x112F9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11300, 0x11303, PASSWORDPOLICY_CHAR_MARK},
+    {0x11305, 0x1130C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1130F, 0x11310, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11313, 0x11328, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1132A, 0x11330, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11332, 0x11333, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11335, 0x11339, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1133B, 0x1133C, PASSWORDPOLICY_CHAR_MARK},
+    {0x1133D, 0x1133D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1133E, 0x11344, PASSWORDPOLICY_CHAR_MARK},
+    {0x11347, 0x11348, PASSWORDPOLICY_CHAR_MARK},
+    {0x1134B, 0x1134D, PASSWORDPOLICY_CHAR_MARK},
+    {0x11350, 0x11350, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11357, 0x11357, PASSWORDPOLICY_CHAR_MARK},
+    {0x1135D, 0x11361, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11362, 0x11363, PASSWORDPOLICY_CHAR_MARK},
+    {0x11366, 0x1136C, PASSWORDPOLICY_CHAR_MARK},
+    {0x11370, 0x11374, PASSWORDPOLICY_CHAR_MARK},
+    {0x11400, 0x11434, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11435, 0x11446, PASSWORDPOLICY_CHAR_MARK},
+    {0x11447, 0x1144A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11450, 0x11459, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1145E, 0x1145E, PASSWORDPOLICY_CHAR_MARK},
+    {0x1145F, 0x11461, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11480, 0x114AF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x114B0, 0x114C3, PASSWORDPOLICY_CHAR_MARK},
+    {0x114C4, 0x114C5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x114C7, 0x114C7, PASSWORDPOLICY_CHAR_LETTER},
+    {0x114D0, 0x114D9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11580, 0x115AE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x115AF, 0x115B5, PASSWORDPOLICY_CHAR_MARK},
+    {0x115B8, 0x115C0, PASSWORDPOLICY_CHAR_MARK},
+    {0x115D8, 0x115DB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x115DC, 0x115DD, PASSWORDPOLICY_CHAR_MARK},
+    {0x11600, 0x1162F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11630, 0x11640, PASSWORDPOLICY_CHAR_MARK},
+    {0x11644, 0x11644, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11650, 0x11659, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11680, 0x116AA, PASSWORDPOLICY_CHAR_LETTER},
+    {0x116AB, 0x116B7, PASSWORDPOLICY_CHAR_MARK},
+    {0x116B8, 0x116B8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x116C0, 0x116C9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11700, 0x1171A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1171D, 0x1172B, PASSWORDPOLICY_CHAR_MARK},
+    {0x11730, 0x11739, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11740, 0x11746, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11800, 0x1182B, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1182C, 0x1183A, PASSWORDPOLICY_CHAR_MARK},
+    {0x118A0, 0x118BF, PASSWORDPOLICY_CHAR_UPPER},
+    {0x118C0, 0x118DF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x118E0, 0x118E9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x118FF, 0x11906, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11909, 0x11909, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1190C, 0x11913, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11915, 0x11916, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11918, 0x1192F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11930, 0x11935, PASSWORDPOLICY_CHAR_MARK},
+    {0x11937, 0x11938, PASSWORDPOLICY_CHAR_MARK},
+    {0x1193B, 0x1193E, PASSWORDPOLICY_CHAR_MARK},
+    {0x1193F, 0x1193F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11940, 0x11940, PASSWORDPOLICY_CHAR_MARK},
+    {0x11941, 0x11941, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11942, 0x11943, PASSWORDPOLICY_CHAR_MARK},
+    {0x11950, 0x11959, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x119A0, 0x119A7, PASSWORDPOLICY_CHAR_LETTER},
+    {0x119AA, 0x119D0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x119D1, 0x119D7, PASSWORDPOLICY_CHAR_MARK},
+    {0x119DA, 0x119E0, PASSWORDPOLICY_CHAR_MARK},
+    {0x119E1, 0x119E1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x119E3, 0x119E3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x119E4, 0x119E4, PASSWORDPOLICY_CHAR_MARK},
+    {0x11A00, 0x11A00, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11A01, 0x11A0A, PASSWORDPOLICY_CHAR_MARK},
+    {0x11A0B, 0x11A32, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11A33, 0x11A39, PASSWORDPOLICY_CHAR_MARK},
+    {0x11A3A, 0x11A3A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11A3B, 0x11A3E, PASSWORDPOLICY_CHAR_MARK},
+    {0x11A47, 0x11A47, PASSWORDPOLICY_CHAR_MARK},
+    {0x11A50, 0x11A50, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11A51, 0x11A5B, PASSWORDPOLICY_CHAR_MARK},
+    {0x11A5C, 0x11A89, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11A8A, 0x11A99, PASSWORDPOLICY_CHAR_MARK},
+    {0x11A9D, 0x11A9D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11AB0, 0x11AF8, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11C00, 0x11C08, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11C0A, 0x11C2E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11C2F, 0x11C36, PASSWORDPOLICY_CHAR_MARK},
+    {0x11C38, 0x11C3F, PASSWORDPOLICY_CHAR_MARK},
+    {0x11C40, 0x11C40, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11C50, 0x11C59, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11C72, 0x11C8F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11C92, 0x11CA7, PASSWORDPOLICY_CHAR_MARK},
+    {0x11CA9, 0x11CB6, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D00, 0x11D06, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11D08, 0x11D09, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11D0B, 0x11D30, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11D31, 0x11D36, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D3A, 0x11D3A, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D3C, 0x11D3D, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D3F, 0x11D45, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D46, 0x11D46, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11D47, 0x11D47, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D50, 0x11D59, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11D60, 0x11D65, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11D67, 0x11D68, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11D6A, 0x11D89, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11D8A, 0x11D8E, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D90, 0x11D91, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D93, 0x11D97, PASSWORDPOLICY_CHAR_MARK},
+    {0x11D98, 0x11D98, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11DA0, 0x11DA9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x11EE0, 0x11EF2, PASSWORDPOLICY_CHAR_LETTER},
+    {0x11EF3, 0x11EF6, PASSWORDPOLICY_CHAR_MARK},
+    {0x11FB0, 0x11FB0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12000, 0x12399, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12480, 0x12543, PASSWORDPOLICY_CHAR_LETTER},
+    {0x12F90, 0x12FF0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x13000, 0x1342E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x14400, 0x14646, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16800, 0x16A38, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16A40, 0x16A5E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16A60, 0x16A69, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x16A70, 0x16ABE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16AC0, 0x16AC9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x16AD0, 0x16AED, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16AF0, 0x16AF4, PASSWORDPOLICY_CHAR_MARK},
+    {0x16B00, 0x16B2F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16B30, 0x16B36, PASSWORDPOLICY_CHAR_MARK},
+    {0x16B40, 0x16B43, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16B50, 0x16B59, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x16B63, 0x16B77, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16B7D, 0x16B8F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16E40, 0x16E5F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x16E60, 0x16E7F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x16F00, 0x16F4A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16F4F, 0x16F4F, PASSWORDPOLICY_CHAR_MARK},
+    {0x16F50, 0x16F50, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16F51, 0x16F87, PASSWORDPOLICY_CHAR_MARK},
+    {0x16F8F, 0x16F92, PASSWORDPOLICY_CHAR_MARK},
+    {0x16F93, 0x16F9F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16FE0, 0x16FE1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16FE3, 0x16FE3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x16FE4, 0x16FE4, PASSWORDPOLICY_CHAR_MARK},
+    {0x16FF0, 0x16FF1, PASSWORDPOLICY_CHAR_MARK},
+    {0x17000, 0x187F7, PASSWORDPOLICY_CHAR_LETTER},
+    {0x18800, 0x18CD5, PASSWORDPOLICY_CHAR_LETTER},
+    {0x18D00, 0x18D08, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1AFF0, 0x1AFF3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1AFF5, 0x1AFFB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1AFFD, 0x1AFFE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1B000, 0x1B122, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1B150, 0x1B152, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1B164, 0x1B167, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1B170, 0x1B2FB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1BC00, 0x1BC6A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1BC70, 0x1BC7C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1BC80, 0x1BC88, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1BC90, 0x1BC99, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1BC9D, 0x1BC9E, PASSWORDPOLICY_CHAR_MARK},
+    {0x1CF00, 0x1CF2D, PASSWORDPOLICY_CHAR_MARK},
+    {0x1CF30, 0x1CF46, PASSWORDPOLICY_CHAR_MARK},
+    {0x1D165, 0x1D169, PASSWORDPOLICY_CHAR_MARK},
+    {0x1D16D, 0x1D172, PASSWORDPOLICY_CHAR_MARK},
+    {0x1D17B, 0x1D182, PASSWORDPOLICY_CHAR_MARK},
+    {0x1D185, 0x1D18B, PASSWORDPOLICY_CHAR_MARK},
+    {0x1D1AA, 0x1D1AD, PASSWORDPOLICY_CHAR_MARK},
+    {0x1D242, 0x1D244, PASSWORDPOLICY_CHAR_MARK},
+    {0x1D400, 0x1D419, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D41A, 0x1D433, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D434, 0x1D44D, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D44E, 0x1D454, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D456, 0x1D467, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D468, 0x1D481, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D482, 0x1D49B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D49C, 0x1D49C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D49E, 0x1D49F, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D4A2, 0x1D4A2, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D4A5, 0x1D4A6, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D4A9, 0x1D4AC, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D4AE, 0x1D4B5, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D4B6, 0x1D4B9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D4BB, 0x1D4BB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D4BD, 0x1D4C3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D4C5, 0x1D4CF, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D4D0, 0x1D4E9, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D4EA, 0x1D503, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D504, 0x1D505, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D507, 0x1D50A, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D50D, 0x1D514, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D516, 0x1D51C, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D51E, 0x1D537, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D538, 0x1D539, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D53B, 0x1D53E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D540, 0x1D544, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D546, 0x1D546, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D54A, 0x1D550, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D552, 0x1D56B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D56C, 0x1D585, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D586, 0x1D59F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D5A0, 0x1D5B9, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D5BA, 0x1D5D3, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D5D4, 0x1D5ED, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D5EE, 0x1D607, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D608, 0x1D621, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D622, 0x1D63B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D63C, 0x1D655, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D656, 0x1D66F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D670, 0x1D689, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D68A, 0x1D6A5, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D6A8, 0x1D6C0, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D6C2, 0x1D6DA, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D6DC, 0x1D6E1, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D6E2, 0x1D6FA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D6FC, 0x1D714, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D716, 0x1D71B, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D71C, 0x1D734, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D736, 0x1D74E, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D750, 0x1D755, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D756, 0x1D76E, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D770, 0x1D788, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D78A, 0x1D78F, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D790, 0x1D7A8, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D7AA, 0x1D7C2, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D7C4, 0x1D7C9, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D7CA, 0x1D7CA, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1D7CB, 0x1D7CB, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1D7CE, 0x1D7FF, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1DA00, 0x1DA36, PASSWORDPOLICY_CHAR_MARK},
+    {0x1DA3B, 0x1DA6C, PASSWORDPOLICY_CHAR_MARK},
+    {0x1DA75, 0x1DA75, PASSWORDPOLICY_CHAR_MARK},
+    {0x1DA84, 0x1DA84, PASSWORDPOLICY_CHAR_MARK},
+    {0x1DA9B, 0x1DA9F, PASSWORDPOLICY_CHAR_MARK},
+    {0x1DAA1, 0x1DAAF, PASSWORDPOLICY_CHAR_MARK},
+    {0x1DF00, 0x1DF09, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1DF0A, 0x1DF0A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1DF0B, 0x1DF1E, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E000, 0x1E006, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E008, 0x1E018, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E01B, 0x1E021, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E023, 0x1E024, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E026, 0x1E02A, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E100, 0x1E12C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E130, 0x1E136, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E137, 0x1E13D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E140, 0x1E149, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1E14E, 0x1E14E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E290, 0x1E2AD, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E2AE, 0x1E2AE, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E2C0, 0x1E2EB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E2EC, 0x1E2EF, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E2F0, 0x1E2F9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1E7E0, 0x1E7E6, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E7E8, 0x1E7EB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E7ED, 0x1E7EE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E7F0, 0x1E7FE, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E800, 0x1E8C4, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E8D0, 0x1E8D6, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E900, 0x1E921, PASSWORDPOLICY_CHAR_UPPER},
+    {0x1E922, 0x1E943, PASSWORDPOLICY_CHAR_LOWER},
+    {0x1E944, 0x1E94A, PASSWORDPOLICY_CHAR_MARK},
+    {0x1E94B, 0x1E94B, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1E950, 0x1E959, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x1EE00, 0x1EE03, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE05, 0x1EE1F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE21, 0x1EE22, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE24, 0x1EE24, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE27, 0x1EE27, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE29, 0x1EE32, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE34, 0x1EE37, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE39, 0x1EE39, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE3B, 0x1EE3B, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE42, 0x1EE42, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE47, 0x1EE47, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE49, 0x1EE49, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE4B, 0x1EE4B, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE4D, 0x1EE4F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE51, 0x1EE52, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE54, 0x1EE54, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE57, 0x1EE57, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE59, 0x1EE59, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE5B, 0x1EE5B, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE5D, 0x1EE5D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE5F, 0x1EE5F, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE61, 0x1EE62, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE64, 0x1EE64, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE67, 0x1EE6A, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE6C, 0x1EE72, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE74, 0x1EE77, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE79, 0x1EE7C, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE7E, 0x1EE7E, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE80, 0x1EE89, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EE8B, 0x1EE9B, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EEA1, 0x1EEA3, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EEA5, 0x1EEA9, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1EEAB, 0x1EEBB, PASSWORDPOLICY_CHAR_LETTER},
+    {0x1FBF0, 0x1FBF9, PASSWORDPOLICY_CHAR_DIGIT},
+    {0x20000, 0x2A6DF, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2A700, 0x2B738, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2B740, 0x2B81D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2B820, 0x2CEA1, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2CEB0, 0x2EBE0, PASSWORDPOLICY_CHAR_LETTER},
+    {0x2F800, 0x2FA1D, PASSWORDPOLICY_CHAR_LETTER},
+    {0x30000, 0x3134A, PASSWORDPOLICY_CHAR_LETTER},
+    {0xE0100, 0xE01EF, PASSWORDPOLICY_CHAR_MARK},
+};
+
+#endif
@@ -12,35 +12,69 @@
 #include "passwordpolicy_vars.h"
 
 // GUC Password checks
+char *guc_passwordpolicy_banned_words_file = NULL;  // Default: disabled
+int guc_passwordpolicy_banned_words_max_size = 1024; // Default: 1 MB
+char *guc_passwordpolicy_breached_file = NULL;       // Default: disabled
 bool guc_passwordpolicy_enable_dict_check = true;   // Default: true
+int guc_passwordpolicy_dictionary_engine = PASSWORDPOLICY_DICTIONARY_ENGINE; // Default: cracklib, if built with it
+char *guc_passwordpolicy_dictionary_path = NULL;    // Default: CRACKLIB_DICTPATH
+int guc_passwordpolicy_min_entropy_bits = 0;        // Default: 0 (disabled)
 int guc_passwordpolicy_min_length = 15;             // Default: 15
 int guc_passwordpolicy_min_spc_char = 1;            // Default: 1
 int guc_passwordpolicy_min_number_char = 1;         // Default: 1
 int guc_passwordpolicy_min_upper_char = 1;          // Default: 1
 int guc_passwordpolicy_min_lower_char = 1;          // Default: 1
+int guc_passwordpolicy_rejection_cache_size = 16;   // Default: 16
+int guc_passwordpolicy_rejection_cache_ttl = 300;   // Default: 5 minutes
 bool guc_passwordpolicy_require_validuntil = false; // Default: false
 // GUC Auth Soft-lock
 int guc_passwordpolicy_lock_after = 5;              // Default: 5
+int guc_passwordpolicy_lock_algorithm = PASSWORDPOLICY_LOCK_CONSECUTIVE; // Default: consecutive
+int guc_passwordpolicy_lock_backoff_max = 3600;     // Default: 1 hour
+int guc_passwordpolicy_lock_refill_rate = 1;        // Default: 1 failure per minute
+int guc_passwordpolicy_lock_window = 300;           // Default: 5 minutes
 bool guc_passwordpolicy_lock_all_accounts = true;   // Default: true
+bool guc_passwordpolicy_lock_on_demand = false;     // Default: false
 bool guc_passwordpolicy_lock_auto_unlock = true;    // Default: true
 int guc_passwordpolicy_lock_auto_unlock_after = 0;  // Default: 0 seconds (immediate)
 int guc_passwordpolicy_lock_failure_delay = 5;      // Default: 5 seconds
 int guc_passwordpolicy_lock_max_num_accounts = 100; // Default: 100
+int guc_passwordpolicy_lock_max_delayed_backends = 10; // Default: 10
+int guc_passwordpolicy_lock_address_after = 0;              // Default: 0 (disabled)
+int guc_passwordpolicy_lock_address_auto_unlock_after = 60; // Default: 60 seconds
+int guc_passwordpolicy_lock_address_failure_delay = 5;      // Default: 5 seconds
+int guc_passwordpolicy_lock_address_max_num = 1024;         // Default: 1024
 // GUC Password History
+int guc_passwordpolicy_history_flush_delay = 10;       // Default: 10 milliseconds
 int guc_passwordpolicy_history_max_num_accounts = 100; // Default: 100
 int guc_passwordpolicy_history_max_num_entries = 5;    // Default: 5
+int guc_passwordpolicy_history_min_password_age = 0;   // Default: 0 seconds
+// GUC Profiles
+int guc_passwordpolicy_profiles_max_num_roles = 1024;  // Default: 1024
 
 // Hooks
 check_password_hook_type passwordpolicy_prev_check_password_hook = NULL;
 ClientAuthentication_hook_type passwordpolicy_prev_client_authentication_hook = NULL;
+ProcessUtility_hook_type passwordpolicy_prev_process_utility_hook = NULL;
+object_access_hook_type passwordpolicy_prev_object_access_hook = NULL;
 
 // Shared memory
 PasswordPolicyShm *passwordpolicy_shm = NULL;
-HTAB *passwordpolicy_hash_accounts = NULL;
+PasswordPolicyBanned *passwordpolicy_banned = NULL;
+PasswordPolicyAccountPadded *passwordpolicy_hash_accounts = NULL;
+uint32 passwordpolicy_hash_accounts_mask = 0;
+PasswordPolicyAddressPadded *passwordpolicy_hash_addresses = NULL;
+uint32 passwordpolicy_hash_addresses_mask = 0;
+PasswordPolicyChange *passwordpolicy_changes = NULL;
 HTAB *passwordpolicy_hash_history = NULL;
-TimestampTz passwordpolicy_hash_history_last_save = 0;
+PasswordPolicyHistorySlab *passwordpolicy_history_slab = NULL;
+char *passwordpolicy_history_slab_data = NULL;
+PasswordPolicyHistoryQueue *passwordpolicy_history_queue = NULL;
+PasswordPolicyProfiles *passwordpolicy_profiles = NULL;
 LWLock *passwordpolicy_lock_accounts = NULL;
-LWLock *passwordpolicy_lock_history = NULL;
+LWLock *passwordpolicy_lock_banned = NULL;
+LWLockPadded *passwordpolicy_lock_history = NULL;
+LWLock *passwordpolicy_lock_profiles = NULL;
 
 // Shared memory hook
 shmem_startup_hook_type passwordpolicy_prev_shmem_startup_hook = NULL;
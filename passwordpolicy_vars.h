@@ -13,6 +13,7 @@
 #define _PASSWORDPOLICY_VARS_H_
 
 #include <postgres.h>
+#include <catalog/objectaccess.h>
 #include <commands/user.h>
 #include <common/sha2.h>
 #include <datatype/timestamp.h>
@@ -21,67 +22,274 @@
 #include <pgtime.h>
 #include <port/atomics.h>
 #include <storage/ipc.h>
+#include <storage/latch.h>
 #include <storage/lwlock.h>
+#include <storage/spin.h>
+#include <tcop/utility.h>
 #include <utils/hsearch.h>
 
 // GUC Password checks
+extern char *guc_passwordpolicy_banned_words_file;
+extern int guc_passwordpolicy_banned_words_max_size;
+extern char *guc_passwordpolicy_breached_file;
 extern bool guc_passwordpolicy_enable_dict_check;
+typedef enum PasswordPolicyDictionaryEngine
+{
+  PASSWORDPOLICY_DICTIONARY_CRACKLIB,
+  PASSWORDPOLICY_DICTIONARY_NATIVE
+} PasswordPolicyDictionaryEngine;
+
+extern int guc_passwordpolicy_dictionary_engine;
+extern char *guc_passwordpolicy_dictionary_path;
+extern int guc_passwordpolicy_min_entropy_bits;
 extern int guc_passwordpolicy_min_length;
 extern int guc_passwordpolicy_min_lower_char;
 extern int guc_passwordpolicy_min_number_char;
 extern int guc_passwordpolicy_min_spc_char;
 extern int guc_passwordpolicy_min_upper_char;
+extern int guc_passwordpolicy_rejection_cache_size;
+extern int guc_passwordpolicy_rejection_cache_ttl;
 extern bool guc_passwordpolicy_require_validuntil;
 // GUC Auth Soft-lock
+typedef enum PasswordPolicyLockAlgorithm
+{
+  PASSWORDPOLICY_LOCK_CONSECUTIVE,
+  PASSWORDPOLICY_LOCK_SLIDING_WINDOW,
+  PASSWORDPOLICY_LOCK_TOKEN_BUCKET,
+  PASSWORDPOLICY_LOCK_EXPONENTIAL_BACKOFF
+} PasswordPolicyLockAlgorithm;
+
 extern int guc_passwordpolicy_lock_after;
+extern int guc_passwordpolicy_lock_algorithm;
+extern int guc_passwordpolicy_lock_backoff_max;
+extern int guc_passwordpolicy_lock_refill_rate;
+extern int guc_passwordpolicy_lock_window;
 extern bool guc_passwordpolicy_lock_all_accounts;
+extern bool guc_passwordpolicy_lock_on_demand;
 extern bool guc_passwordpolicy_lock_auto_unlock;
 extern int guc_passwordpolicy_lock_auto_unlock_after;
 extern int guc_passwordpolicy_lock_failure_delay;
 extern int guc_passwordpolicy_lock_max_num_accounts;
+extern int guc_passwordpolicy_lock_max_delayed_backends;
+extern int guc_passwordpolicy_lock_address_after;
+extern int guc_passwordpolicy_lock_address_auto_unlock_after;
+extern int guc_passwordpolicy_lock_address_failure_delay;
+extern int guc_passwordpolicy_lock_address_max_num;
 // GUC Password History
+extern int guc_passwordpolicy_history_flush_delay;
 extern int guc_passwordpolicy_history_max_num_accounts;
 extern int guc_passwordpolicy_history_max_num_entries;
+extern int guc_passwordpolicy_history_min_password_age;
+// GUC Profiles
+extern int guc_passwordpolicy_profiles_max_num_roles;
 
 // Hooks
 extern check_password_hook_type passwordpolicy_prev_check_password_hook;
 extern ClientAuthentication_hook_type passwordpolicy_prev_client_authentication_hook;
+extern ProcessUtility_hook_type passwordpolicy_prev_process_utility_hook;
+extern object_access_hook_type passwordpolicy_prev_object_access_hook;
 
 // Shared Memory types
-typedef char PasswordPolicyAccountKey[NAMEDATALEN + 1];
 typedef struct PasswordPolicyAccount
 {
-  PasswordPolicyAccountKey key;
+  pg_atomic_uint32 roleid;       /* InvalidOid while the slot was never used */
+  pg_atomic_uint32 deleted;      /* 0: active, 1: deleted, 2: candidate for deletion */
+  pg_atomic_uint32 usage;        /* set on failure, cleared by the clock sweep of on-demand mode */
   pg_atomic_uint64 failures;
   pg_atomic_uint64 last_failure; /* typedef int64 pg_time_t */
-  pg_atomic_uint64 deleted;
+  pg_atomic_uint64 state;        /* sliding_window and token_bucket state */
+  NameData usename;
 } PasswordPolicyAccount;
 
-typedef struct PasswordPolicyHistoryHash
+/* One account per cache line, logins of different roles don't false-share */
+typedef union PasswordPolicyAccountPadded
 {
-  char password_hash[PG_SHA256_DIGEST_STRING_LENGTH];
-  TimestampTz changed_at;
-} PasswordPolicyHistoryHash;
+  PasswordPolicyAccount account;
+  char pad[PG_CACHE_LINE_SIZE];
+} PasswordPolicyAccountPadded;
+
+typedef struct PasswordPolicyAddress
+{
+  pg_atomic_uint64 key;          /* hash of the source address, 0 while the slot is free */
+  pg_atomic_uint64 failures;
+  pg_atomic_uint64 last_failure; /* typedef int64 pg_time_t */
+} PasswordPolicyAddress;
+
+typedef union PasswordPolicyAddressPadded
+{
+  PasswordPolicyAddress address;
+  char pad[PG_CACHE_LINE_SIZE];
+} PasswordPolicyAddressPadded;
 
+/* defaults of password_policy.dictionary_engine and password_policy.dictionary_path, set at build time */
+#ifdef USE_CRACKLIB
+#define PASSWORDPOLICY_DICTIONARY_ENGINE PASSWORDPOLICY_DICTIONARY_CRACKLIB
+#else
+#define PASSWORDPOLICY_DICTIONARY_ENGINE PASSWORDPOLICY_DICTIONARY_NATIVE
+#endif
+#ifdef CRACKLIB_DICTPATH
+#define PASSWORDPOLICY_DICTIONARY_PATH CRACKLIB_DICTPATH
+#else
+#define PASSWORDPOLICY_DICTIONARY_PATH ""
+#endif
+
+/* number of locks protecting the password history, must be a power of 2 */
+#define PASSWORDPOLICY_HISTORY_PARTITIONS 16
+
+typedef uint8 PasswordPolicyHistoryDigest[PG_SHA256_DIGEST_LENGTH];
+
+/*
+ * The history of an account is a ring of max_password_history digests, head is the next
+ * position to write, and the oldest digest once the ring is full. Digests and change times
+ * are kept in separate arrays so the digests are scanned contiguously.
+ */
 typedef struct PasswordPolicyHistory
 {
-  PasswordPolicyAccountKey key;
-  PasswordPolicyHistoryHash *hashes;
+  Oid roleid;
+  int32 slot;                           /* slot of the history slab */
+  uint32 head;
+  uint32 count;                         /* digests in use, positions 0 to count - 1 */
+  bool age_bypass;                      /* next change ignores min_password_age */
+  PasswordPolicyHistoryDigest *digests; /* max_password_history digests... */
+  TimestampTz *changed_at;              /* ...and their change times, in the slot */
 } PasswordPolicyHistory;
 
+/* Fixed arena of history slots, max_number_accounts slots of max_password_history digests */
+typedef struct PasswordPolicyHistorySlab
+{
+  slock_t mutex;    /* protects free_head, used and next_free */
+  int32 free_head;  /* first free slot, -1 when all the slots are in use */
+  uint32 num_slots;
+  uint32 used;
+  int32 next_free[FLEXIBLE_ARRAY_MEMBER]; /* next free slot, for each free slot */
+} PasswordPolicyHistorySlab;
+
+/* Role changes, applied by the background worker after the transaction commits */
+typedef enum PasswordPolicyChangeKind
+{
+  PASSWORDPOLICY_CHANGE_ROLE,        /* created or altered, check if the account must be tracked */
+  PASSWORDPOLICY_CHANGE_ROLE_DROP,   /* dropped, forget the account and its password history */
+  PASSWORDPOLICY_CHANGE_ROLE_RENAME, /* renamed, move the password history to the new name */
+  PASSWORDPOLICY_CHANGE_LOCKABLE,    /* row of passwordpolicy.accounts_lockable inserted, updated or deleted */
+  PASSWORDPOLICY_CHANGE_PROFILES,    /* passwordpolicy.profiles or passwordpolicy.roles_profile changed */
+  PASSWORDPOLICY_CHANGE_FULL         /* too many changes to track, read all the accounts again */
+} PasswordPolicyChangeKind;
+
+typedef struct PasswordPolicyChange
+{
+  PasswordPolicyChangeKind kind;
+  Oid roleid;
+  NameData usename;
+  NameData oldname;
+} PasswordPolicyChange;
+
 typedef struct PasswordPolicyShm
 {
-  LWLock *lock;
+  LWLock *lock;                    /* protects bgw_latch and the change queue */
+  Latch *bgw_latch;                /* latch of the background worker, NULL if not running */
+  uint32 changes_head;             /* next change to write */
+  uint32 changes_tail;             /* next change to apply */
+  bool changes_overflow;           /* changes were lost, a full reload is needed */
   pg_atomic_flag flag_shutdown;
+  uint32 accounts_used; /* protected by passwordpolicy_lock_accounts */
+  pg_atomic_uint32 delay_sleeping; /* backends sleeping in a failure delay */
+  pg_atomic_uint64 delay_total;    /* failure delays applied */
+  pg_atomic_uint64 delay_shed;     /* failure delays skipped because of max_delayed_backends */
+  pg_atomic_uint64 lock_changes;   /* soft-lock counter changes, to know when to save them */
+  bool history_loaded;             /* the history table was read, only used by the background worker */
 } PasswordPolicyShm;
 
+/*
+ * Banned words, compiled into an Aho-Corasick automaton. Every state has a transition for every
+ * character class, the scan of a password is a lookup per character without failure links.
+ */
+#define PASSWORDPOLICY_BANNED_MATCH 0x80000000 /* transition to a state ending a banned word */
+
+typedef struct PasswordPolicyBanned
+{
+  char path[MAXPGPATH];      /* file compiled, empty if none */
+  dev_t dev;                 /* identity of the file compiled, to detect changes */
+  ino_t ino;
+  time_t mtime;
+  off_t size;
+  uint32 num_words;
+  uint32 num_states;
+  uint32 num_classes;        /* class 0 is the characters not in any banned word */
+  uint32 max_transitions;    /* capacity of transitions */
+  uint8 classes[256];        /* class of each byte, upper case letters share the class of the lower case */
+  uint32 transitions[FLEXIBLE_ARRAY_MEMBER]; /* num_states * num_classes, next state | PASSWORDPOLICY_BANNED_MATCH */
+} PasswordPolicyBanned;
+
+/*
+ * Policy profiles, read from passwordpolicy.profiles by the background worker. A setting
+ * below 0 is not set by the profile, the value of the GUC applies.
+ */
+#define PASSWORDPOLICY_PROFILES_MAX 64
+
+typedef struct PasswordPolicyProfile
+{
+  int min_length;
+  int min_spc_char;
+  int min_number_char;
+  int min_upper_char;
+  int min_lower_char;
+  int history_max_num_entries; /* at most password_policy_history.max_password_history */
+  int lock_after;
+} PasswordPolicyProfile;
+
+typedef struct PasswordPolicyProfileRole
+{
+  Oid roleid;                  /* InvalidOid while the slot is free */
+  int32 profile;               /* index in profiles */
+} PasswordPolicyProfileRole;
+
+/*
+ * Profile of the roles, an open addressing table keyed by role Oid. Only the roles with a
+ * profile, their own or one of their groups, are in the table.
+ */
+typedef struct PasswordPolicyProfiles
+{
+  uint32 num_profiles;
+  uint32 num_roles;
+  uint32 mask;                 /* slots of roles - 1 */
+  PasswordPolicyProfile profiles[PASSWORDPOLICY_PROFILES_MAX];
+  PasswordPolicyProfileRole roles[FLEXIBLE_ARRAY_MEMBER];
+} PasswordPolicyProfiles;
+
+/* Password history change not yet written to the history table */
+typedef struct PasswordPolicyHistoryRecord
+{
+  Oid roleid;
+  PasswordPolicyHistoryDigest digest;
+  TimestampTz changed_at;
+} PasswordPolicyHistoryRecord;
+
+typedef struct PasswordPolicyHistoryQueue
+{
+  slock_t mutex;  /* protects head, tail and overflow */
+  uint32 head;    /* next record to write */
+  uint32 tail;    /* next record to flush */
+  bool overflow;  /* records were lost, all the history must be flushed */
+  PasswordPolicyHistoryRecord records[FLEXIBLE_ARRAY_MEMBER];
+} PasswordPolicyHistoryQueue;
+
 // Shared Memory
 extern PasswordPolicyShm *passwordpolicy_shm;
-extern HTAB *passwordpolicy_hash_accounts;
+extern PasswordPolicyBanned *passwordpolicy_banned;
+extern PasswordPolicyAccountPadded *passwordpolicy_hash_accounts;
+extern uint32 passwordpolicy_hash_accounts_mask;
+extern PasswordPolicyAddressPadded *passwordpolicy_hash_addresses;
+extern uint32 passwordpolicy_hash_addresses_mask;
+extern PasswordPolicyChange *passwordpolicy_changes;
 extern HTAB *passwordpolicy_hash_history;
-extern TimestampTz passwordpolicy_hash_history_last_save;
+extern PasswordPolicyHistorySlab *passwordpolicy_history_slab;
+extern char *passwordpolicy_history_slab_data;
+extern PasswordPolicyHistoryQueue *passwordpolicy_history_queue;
+extern PasswordPolicyProfiles *passwordpolicy_profiles;
 extern LWLock *passwordpolicy_lock_accounts;
-extern LWLock *passwordpolicy_lock_history;
+extern LWLock *passwordpolicy_lock_banned;
+extern LWLockPadded *passwordpolicy_lock_history;
+extern LWLock *passwordpolicy_lock_profiles;
 
 // Shared Memory - Hook
 extern shmem_startup_hook_type passwordpolicy_prev_shmem_startup_hook;
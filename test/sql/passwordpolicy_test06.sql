@@ -0,0 +1,68 @@
+CREATE EXTENSION dblink;
+
+CREATE FUNCTION passwordpolicy_test_login(usename name, password text) RETURNS text AS $$
+BEGIN
+  PERFORM dblink_connect('passwordpolicy_test', format('dbname=%s host=127.0.0.1 port=%s user=%s password=%s',
+                                                      current_database(), current_setting('port'), usename, password));
+  PERFORM dblink_disconnect('passwordpolicy_test');
+  RETURN 'connected';
+EXCEPTION WHEN OTHERS THEN
+  RETURN 'failed';
+END
+$$ LANGUAGE plpgsql;
+
+\c postgres
+
+SET client_min_messages = warning;
+
+CREATE EXTENSION IF NOT EXISTS passwordpolicy;
+
+ALTER EXTENSION passwordpolicy UPDATE;
+
+RESET client_min_messages;
+
+DROP USER IF EXISTS test_lock;
+
+CREATE USER test_lock WITH PASSWORD 'Xq7#vLp9!zR2';
+
+INSERT INTO passwordpolicy.accounts_lockable (usename) VALUES ('test_lock');
+
+SELECT pg_reload_conf();
+
+\c contrib_regression
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN EXISTS (SELECT 1 FROM passwordpolicy.accounts_locked() WHERE usename = 'test_lock'); PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT usename, failure_count FROM passwordpolicy.accounts_locked() WHERE usename = 'test_lock';
+
+SELECT passwordpolicy_test_login('test_lock', 'wrong');
+
+SELECT passwordpolicy_test_login('test_lock', 'wrong');
+
+SELECT passwordpolicy_test_login('test_lock', 'wrong');
+
+SELECT usename, failure_count FROM passwordpolicy.accounts_locked() WHERE usename = 'test_lock';
+
+SELECT passwordpolicy_test_login('test_lock', 'Xq7#vLp9!zR2');
+
+SELECT passwordpolicy.account_locked_reset('test_lock');
+
+SELECT usename, failure_count FROM passwordpolicy.accounts_locked() WHERE usename = 'test_lock';
+
+SELECT passwordpolicy_test_login('test_lock', 'Xq7#vLp9!zR2');
+
+SELECT passwordpolicy.account_locked_reset('test_nobody');
+
+\c postgres
+
+DELETE FROM passwordpolicy.accounts_lockable WHERE usename = 'test_lock';
+
+DROP USER test_lock;
+
+ALTER SYSTEM RESET password_policy_lock.failure_delay;
+
+ALTER SYSTEM RESET password_policy_lock.number_failures;
+
+ALTER SYSTEM RESET password_policy_lock.auto_unlock_after;
+
+SELECT pg_reload_conf();
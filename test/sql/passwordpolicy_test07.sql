@@ -0,0 +1,9 @@
+SELECT name, setting FROM pg_settings WHERE name LIKE 'password_policy_lock.address%' ORDER BY name;
+
+ALTER SYSTEM SET password_policy_lock.address_max_number = 4;
+
+ALTER SYSTEM SET password_policy_lock.address_number_failures = -1;
+
+ALTER SYSTEM SET password_policy_lock.address_failure_delay = -1;
+
+ALTER SYSTEM SET password_policy_lock.address_auto_unlock_after = -1;
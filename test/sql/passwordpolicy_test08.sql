@@ -0,0 +1,35 @@
+SELECT sleeping, delayed >= 0 AS delayed, shed >= 0 AS shed FROM passwordpolicy.failure_delay_stats();
+
+ALTER SYSTEM SET password_policy_lock.max_delayed_backends = -1;
+
+ALTER SYSTEM SET password_policy_lock.failure_delay = -1;
+
+DROP USER IF EXISTS test_delay;
+
+CREATE USER test_delay;
+
+SELECT * FROM passwordpolicy.accounts_locked() WHERE usename = 'test_delay';
+
+GRANT USAGE ON SCHEMA passwordpolicy TO test_delay;
+
+SET ROLE test_delay;
+
+SELECT * FROM passwordpolicy.failure_delay_stats();
+
+SELECT * FROM passwordpolicy.accounts_locked();
+
+RESET ROLE;
+
+GRANT EXECUTE ON FUNCTION passwordpolicy.failure_delay_stats() TO test_delay;
+
+SET ROLE test_delay;
+
+SELECT * FROM passwordpolicy.failure_delay_stats();
+
+RESET ROLE;
+
+REVOKE EXECUTE ON FUNCTION passwordpolicy.failure_delay_stats() FROM test_delay;
+
+REVOKE USAGE ON SCHEMA passwordpolicy FROM test_delay;
+
+DROP USER IF EXISTS test_delay;
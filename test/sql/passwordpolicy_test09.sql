@@ -0,0 +1,15 @@
+SELECT name, setting FROM pg_settings WHERE name IN ('password_policy_lock.algorithm', 'password_policy_lock.window', 'password_policy_lock.refill_rate', 'password_policy_lock.backoff_max') ORDER BY name;
+
+SELECT enumvals FROM pg_settings WHERE name = 'password_policy_lock.algorithm';
+
+ALTER SYSTEM SET password_policy_lock.algorithm = 'bogus';
+
+ALTER SYSTEM SET password_policy_lock."window" = 0;
+
+ALTER SYSTEM SET password_policy_lock.refill_rate = -1;
+
+ALTER SYSTEM SET password_policy_lock.backoff_max = 0;
+
+ALTER SYSTEM SET password_policy_lock.algorithm = 'token_bucket';
+
+ALTER SYSTEM RESET password_policy_lock.algorithm;
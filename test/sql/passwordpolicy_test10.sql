@@ -0,0 +1,29 @@
+\c postgres
+
+DROP USER IF EXISTS test_snapshot;
+
+CREATE USER test_snapshot WITH PASSWORD 'Xq7#vLp9!zR2';
+
+INSERT INTO passwordpolicy.accounts_lockable (usename) VALUES ('test_snapshot');
+
+SELECT pg_reload_conf();
+
+\c contrib_regression
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN EXISTS (SELECT 1 FROM passwordpolicy.accounts_locked() WHERE usename = 'test_snapshot'); PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT passwordpolicy_test_login('test_snapshot', 'wrong');
+
+SELECT usename, failure_count FROM passwordpolicy.accounts_locked() WHERE usename = 'test_snapshot';
+
+SELECT pg_reload_conf();
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN (SELECT CASE WHEN position('test_snapshot'::bytea IN f) > 25 THEN get_byte(f, position('test_snapshot'::bytea IN f) - 25) END FROM pg_read_binary_file('pg_stat/passwordpolicy.stat', 0, 1048576, true) AS f) = 1; PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT get_byte(f, position('test_snapshot'::bytea IN f) - 25) AS failures FROM pg_read_binary_file('pg_stat/passwordpolicy.stat') AS f;
+
+\c postgres
+
+DELETE FROM passwordpolicy.accounts_lockable WHERE usename = 'test_snapshot';
+
+DROP USER test_snapshot;
@@ -0,0 +1,11 @@
+ALTER SYSTEM SET password_policy_lock.include_all = on;
+
+ALTER SYSTEM SET password_policy_lock.on_demand = on;
+
+ALTER SYSTEM SET password_policy_lock.failure_delay = 0;
+
+ALTER SYSTEM SET password_policy_lock.number_failures = 3;
+
+ALTER SYSTEM SET password_policy_lock.auto_unlock_after = 3600;
+
+SELECT pg_reload_conf();
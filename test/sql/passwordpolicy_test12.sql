@@ -0,0 +1,35 @@
+DROP USER IF EXISTS test_demand;
+
+CREATE USER test_demand WITH PASSWORD 'Xq7#vLp9!zR2';
+
+SELECT usename, failure_count FROM passwordpolicy.accounts_locked() WHERE usename = 'test_demand';
+
+SELECT passwordpolicy_test_login('test_demand', 'wrong');
+
+SELECT usename, failure_count FROM passwordpolicy.accounts_locked() WHERE usename = 'test_demand';
+
+SELECT passwordpolicy_test_login('test_demand', 'wrong');
+
+SELECT passwordpolicy_test_login('test_demand', 'wrong');
+
+SELECT usename, failure_count FROM passwordpolicy.accounts_locked() WHERE usename = 'test_demand';
+
+SELECT passwordpolicy_test_login('test_demand', 'Xq7#vLp9!zR2');
+
+SELECT passwordpolicy.account_locked_reset('test_demand');
+
+SELECT passwordpolicy_test_login('test_demand', 'Xq7#vLp9!zR2');
+
+DROP USER test_demand;
+
+ALTER SYSTEM RESET password_policy_lock.include_all;
+
+ALTER SYSTEM RESET password_policy_lock.on_demand;
+
+ALTER SYSTEM RESET password_policy_lock.failure_delay;
+
+ALTER SYSTEM RESET password_policy_lock.number_failures;
+
+ALTER SYSTEM RESET password_policy_lock.auto_unlock_after;
+
+SELECT pg_reload_conf();
@@ -0,0 +1,39 @@
+\c postgres
+
+DROP USER IF EXISTS test_changes;
+
+CREATE USER test_changes;
+
+INSERT INTO passwordpolicy.accounts_lockable (usename) VALUES ('test_changes');
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN EXISTS (SELECT 1 FROM passwordpolicy.accounts_locked() WHERE usename = 'test_changes'); PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT usename FROM passwordpolicy.accounts_locked() WHERE usename LIKE 'test_changes%';
+
+ALTER USER test_changes RENAME TO test_changes_renamed;
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN NOT EXISTS (SELECT 1 FROM passwordpolicy.accounts_locked() WHERE usename LIKE 'test_changes%'); PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT usename FROM passwordpolicy.accounts_locked() WHERE usename LIKE 'test_changes%';
+
+UPDATE passwordpolicy.accounts_lockable SET usename = 'test_changes_renamed' WHERE usename = 'test_changes';
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN EXISTS (SELECT 1 FROM passwordpolicy.accounts_locked() WHERE usename = 'test_changes_renamed'); PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT usename FROM passwordpolicy.accounts_locked() WHERE usename LIKE 'test_changes%';
+
+DROP USER test_changes_renamed;
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN NOT EXISTS (SELECT 1 FROM passwordpolicy.accounts_locked() WHERE usename LIKE 'test_changes%'); PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT usename FROM passwordpolicy.accounts_locked() WHERE usename LIKE 'test_changes%';
+
+DELETE FROM passwordpolicy.accounts_lockable WHERE usename = 'test_changes_renamed';
+
+BEGIN;
+
+CREATE ROLE test_changes_prepared;
+
+PREPARE TRANSACTION 'passwordpolicy_test';
+
+SELECT count(*) FROM pg_roles WHERE rolname = 'test_changes_prepared';
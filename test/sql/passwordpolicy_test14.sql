@@ -0,0 +1,21 @@
+SELECT slots = current_setting('password_policy_history.max_number_accounts')::integer AS slots, used BETWEEN 0 AND slots AS used, entries_per_slot = current_setting('password_policy_history.max_password_history')::integer AS entries_per_slot, bytes > 0 AS bytes FROM passwordpolicy.history_slab_stats();
+
+ALTER SYSTEM SET password_policy_history.max_number_accounts = 0;
+
+ALTER SYSTEM SET password_policy_history.max_password_history = 0;
+
+DROP USER IF EXISTS test_slab;
+
+CREATE USER test_slab;
+
+GRANT USAGE ON SCHEMA passwordpolicy TO test_slab;
+
+SET ROLE test_slab;
+
+SELECT * FROM passwordpolicy.history_slab_stats();
+
+RESET ROLE;
+
+REVOKE USAGE ON SCHEMA passwordpolicy FROM test_slab;
+
+DROP USER IF EXISTS test_slab;
@@ -0,0 +1,23 @@
+DROP USER IF EXISTS test_ring;
+
+CREATE USER test_ring WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_ring WITH PASSWORD 'Tm4$wKd8@hN6';
+
+ALTER USER test_ring WITH PASSWORD 'Wd3%jNq5&kB7';
+
+ALTER USER test_ring WITH PASSWORD 'Hy6^rPc2*mF9';
+
+ALTER USER test_ring WITH PASSWORD 'Jb8!sGv4#tL1';
+
+ALTER USER test_ring WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_ring WITH PASSWORD 'Rk5@zXm7$pQ3';
+
+ALTER USER test_ring WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_ring WITH PASSWORD 'Wd3%jNq5&kB7';
+
+ALTER USER test_ring WITH PASSWORD 'Tm4$wKd8@hN6';
+
+DROP USER test_ring;
@@ -0,0 +1,15 @@
+DROP USER IF EXISTS test_flush;
+
+CREATE USER test_flush WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_flush WITH PASSWORD 'Tm4$wKd8@hN6';
+
+\c postgres
+
+SELECT pg_reload_conf();
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN (SELECT count(*) FROM passwordpolicy.accounts_password_history WHERE roleid = 'test_flush'::regrole) = 2; PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT count(*) FROM passwordpolicy.accounts_password_history WHERE roleid = 'test_flush'::regrole;
+
+DROP USER test_flush;
@@ -0,0 +1,45 @@
+DROP USER IF EXISTS test_xact;
+
+CREATE USER test_xact;
+
+BEGIN;
+
+ALTER USER test_xact WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ROLLBACK;
+
+ALTER USER test_xact WITH PASSWORD 'Xq7#vLp9!zR2';
+
+BEGIN;
+
+SAVEPOINT before_change;
+
+ALTER USER test_xact WITH PASSWORD 'Tm4$wKd8@hN6';
+
+ROLLBACK TO SAVEPOINT before_change;
+
+ALTER USER test_xact WITH PASSWORD 'Tm4$wKd8@hN6';
+
+COMMIT;
+
+BEGIN;
+
+ALTER USER test_xact WITH PASSWORD 'Wd3%jNq5&kB7';
+
+ALTER USER test_xact WITH PASSWORD 'Wd3%jNq5&kB7';
+
+ROLLBACK;
+
+ALTER USER test_xact WITH PASSWORD 'Wd3%jNq5&kB7';
+
+ALTER USER test_xact WITH PASSWORD 'Xq7#vLp9!zR2';
+
+BEGIN;
+
+ALTER USER test_xact WITH PASSWORD 'Hy6^rPc2*mF9';
+
+PREPARE TRANSACTION 'passwordpolicy_test';
+
+ALTER USER test_xact WITH PASSWORD 'Hy6^rPc2*mF9';
+
+DROP USER test_xact;
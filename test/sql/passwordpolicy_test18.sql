@@ -0,0 +1,19 @@
+DROP USER IF EXISTS test_part1;
+
+DROP USER IF EXISTS test_part2;
+
+CREATE USER test_part1 WITH PASSWORD 'Xq7#vLp9!zR2';
+
+CREATE USER test_part2 WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_part1 WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_part2 WITH PASSWORD 'Tm4$wKd8@hN6';
+
+ALTER USER test_part1 WITH PASSWORD 'Tm4$wKd8@hN6';
+
+ALTER USER test_part2 WITH PASSWORD 'Xq7#vLp9!zR2';
+
+DROP USER test_part1;
+
+DROP USER test_part2;
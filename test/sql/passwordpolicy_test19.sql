@@ -0,0 +1,3 @@
+ALTER SYSTEM SET password_policy_history.min_password_age = 3600;
+
+SELECT pg_reload_conf();
@@ -0,0 +1,35 @@
+DROP USER IF EXISTS test_age;
+
+DROP USER IF EXISTS test_age_nopass;
+
+CREATE USER test_age WITH PASSWORD 'Xq7#vLp9!zR2';
+
+CREATE USER test_age_nopass;
+
+ALTER USER test_age WITH PASSWORD 'Tm4$wKd8@hN6';
+
+SET ROLE test_age;
+
+ALTER USER test_age WITH PASSWORD 'Wd3%jNq5&kB7';
+
+RESET ROLE;
+
+SELECT passwordpolicy.min_password_age_bypass('test_age');
+
+SET ROLE test_age;
+
+ALTER USER test_age WITH PASSWORD 'Wd3%jNq5&kB7';
+
+ALTER USER test_age WITH PASSWORD 'Hy6^rPc2*mF9';
+
+RESET ROLE;
+
+SELECT passwordpolicy.min_password_age_bypass('test_age_nopass');
+
+DROP USER IF EXISTS test_age;
+
+DROP USER IF EXISTS test_age_nopass;
+
+ALTER SYSTEM RESET password_policy_history.min_password_age;
+
+SELECT pg_reload_conf();
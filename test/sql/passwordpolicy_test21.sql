@@ -0,0 +1,31 @@
+DROP USER IF EXISTS test_load;
+
+CREATE USER test_load WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_load WITH PASSWORD 'Tm4$wKd8@hN6';
+
+ALTER USER test_load WITH PASSWORD 'Wd3%jNq5&kB7';
+
+ALTER USER test_load WITH PASSWORD 'Hy6^rPc2*mF9';
+
+ALTER USER test_load WITH PASSWORD 'Jb8!sGv4#tL1';
+
+ALTER USER test_load WITH PASSWORD 'Rk5@zXm7$pQ3';
+
+SELECT clock_timestamp() AS last_change \gset
+
+ALTER USER test_load WITH PASSWORD 'Nf2&cWy9%dH4';
+
+\c postgres
+
+SET passwordpolicy_test.last_change = :'last_change';
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN (SELECT count(*) = 5 AND max(changed_at) >= current_setting('passwordpolicy_test.last_change')::timestamptz FROM passwordpolicy.accounts_password_history WHERE roleid = 'test_load'::regrole); PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT count(*) FROM passwordpolicy.accounts_password_history WHERE roleid = 'test_load'::regrole;
+
+ALTER USER test_load WITH PASSWORD 'Tm4$wKd8@hN6';
+
+ALTER USER test_load WITH PASSWORD 'Xq7#vLp9!zR2';
+
+DROP USER test_load;
@@ -0,0 +1,33 @@
+DROP EXTENSION passwordpolicy;
+
+CREATE EXTENSION passwordpolicy VERSION '2.1.0';
+
+DROP USER IF EXISTS test_history;
+
+CREATE USER test_history;
+
+INSERT INTO passwordpolicy.accounts_password_history (usename, password_hash, changed_at) VALUES ('test_history', repeat('ab', 32), '2024-01-01 00:00:00+00'), ('test_history', 'not a digest', '2024-01-02 00:00:00+00'), ('test_history', repeat('cd', 32), NULL), ('test_dropped', repeat('ef', 32), '2024-01-03 00:00:00+00');
+
+ALTER EXTENSION passwordpolicy UPDATE TO '3.0.0';
+
+SELECT attname, format_type(atttypid, atttypmod) FROM pg_attribute WHERE attrelid = 'passwordpolicy.accounts_password_history'::regclass AND attnum > 0 AND NOT attisdropped ORDER BY attnum;
+
+SELECT roleid, encode(password_hash, 'hex') = repeat('ab', 32) AS password_hash, changed_at = '2024-01-01 00:00:00+00' AS changed_at FROM passwordpolicy.accounts_password_history;
+
+ALTER EXTENSION passwordpolicy UPDATE;
+
+DELETE FROM passwordpolicy.accounts_password_history;
+
+DROP USER test_history;
+
+DROP USER IF EXISTS test_created;
+
+BEGIN;
+
+CREATE USER test_created WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_created WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ROLLBACK;
+
+SELECT passwordpolicy.min_password_age_bypass('test_nobody');
@@ -0,0 +1,5 @@
+DO $$ DECLARE lo oid := lo_from_bytea(0, decode('48434145524250500100000001000000030000000000000000000000000000000000000000000000000000000000000000000000000000005baa61e4c9b93f3f0682250b6cf8331b7ee68fd87c4a8d09ca3762af61e59520943dc26494f8941bdb033cb6562acd57798f41ceb3d292c960d76b74', 'hex')); BEGIN PERFORM lo_export(lo, current_setting('data_directory') || '/passwordpolicy_breached.idx'); PERFORM lo_unlink(lo); END $$;
+
+ALTER SYSTEM SET password_policy.breached_file = 'passwordpolicy_breached.idx';
+
+SELECT pg_reload_conf();
@@ -0,0 +1,11 @@
+DROP USER IF EXISTS test_breached;
+
+CREATE USER test_breached WITH PASSWORD 'Kp9$vRw2@Lm5';
+
+CREATE USER test_breached WITH PASSWORD 'Xq7#vLp9!zR2';
+
+DROP USER test_breached;
+
+ALTER SYSTEM RESET password_policy.breached_file;
+
+SELECT pg_reload_conf();
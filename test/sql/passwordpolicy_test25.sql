@@ -0,0 +1,5 @@
+ALTER SYSTEM SET password_policy.enable_dictionary_check = on;
+
+ALTER SYSTEM SET password_policy.dictionary_path = 'passwordpolicy_missing';
+
+SELECT pg_reload_conf();
@@ -0,0 +1,9 @@
+DROP USER IF EXISTS test_dictionary;
+
+CREATE USER test_dictionary WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER SYSTEM RESET password_policy.dictionary_path;
+
+ALTER SYSTEM RESET password_policy.enable_dictionary_check;
+
+SELECT pg_reload_conf();
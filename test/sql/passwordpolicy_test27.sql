@@ -0,0 +1,9 @@
+DO $$ DECLARE lo oid := lo_from_bytea(0, decode('414e5443494450500100000000000000dca4853a166be1c0040000000100000005000000252439e7ee89ceaee0c2d6841a6339ef', 'hex')); BEGIN PERFORM lo_export(lo, current_setting('data_directory') || '/passwordpolicy_dictionary.bin'); PERFORM lo_unlink(lo); END $$;
+
+ALTER SYSTEM SET password_policy.enable_dictionary_check = on;
+
+ALTER SYSTEM SET password_policy.dictionary_engine = 'native';
+
+ALTER SYSTEM SET password_policy.dictionary_path = 'passwordpolicy_dictionary.bin';
+
+SELECT pg_reload_conf();
@@ -0,0 +1,17 @@
+DROP USER IF EXISTS test_native;
+
+CREATE USER test_native WITH PASSWORD 'Dr4g0n2024!';
+
+CREATE USER test_native WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_native WITH PASSWORD 'Sunsh1ne#';
+
+DROP USER test_native;
+
+ALTER SYSTEM RESET password_policy.dictionary_path;
+
+ALTER SYSTEM RESET password_policy.dictionary_engine;
+
+ALTER SYSTEM RESET password_policy.enable_dictionary_check;
+
+SELECT pg_reload_conf();
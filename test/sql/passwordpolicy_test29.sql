@@ -0,0 +1,7 @@
+DO $$ BEGIN EXECUTE format('COPY (VALUES (''# banned words''), (''acme''), (''Winter'')) TO %L', current_setting('data_directory') || '/passwordpolicy_banned.txt'); END $$;
+
+ALTER SYSTEM SET password_policy.enable_dictionary_check = off;
+
+ALTER SYSTEM SET password_policy.banned_words_file = 'passwordpolicy_banned.txt';
+
+SELECT pg_reload_conf();
@@ -0,0 +1,17 @@
+DROP USER IF EXISTS test_banned;
+
+CREATE USER test_banned WITH PASSWORD 'Portal-ACME-42';
+
+CREATE USER test_banned WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_banned WITH PASSWORD 'WINTER2024!';
+
+ALTER USER test_banned WITH PASSWORD 'banned words';
+
+DROP USER test_banned;
+
+ALTER SYSTEM RESET password_policy.banned_words_file;
+
+ALTER SYSTEM RESET password_policy.enable_dictionary_check;
+
+SELECT pg_reload_conf();
@@ -0,0 +1,34 @@
+SELECT getdatabaseencoding() <> 'UTF8' AS skip_test \gset
+\if :skip_test
+\quit
+\endif
+
+ALTER SYSTEM SET password_policy.min_special_chars = 2;
+
+ALTER SYSTEM SET password_policy.min_password_len = 8;
+
+ALTER SYSTEM SET password_policy.enable_dictionary_check = off;
+
+SELECT pg_reload_conf();
+
+\c contrib_regression
+
+SET client_encoding TO UTF8;
+
+DROP USER IF EXISTS test_unicode;
+
+CREATE USER test_unicode WITH PASSWORD 'Xq7vLp€2';
+
+CREATE USER test_unicode WITH PASSWORD 'éèêë#!';
+
+CREATE USER test_unicode WITH PASSWORD 'Xq7vLp€#';
+
+DROP USER test_unicode;
+
+ALTER SYSTEM SET password_policy.min_special_chars = 0;
+
+ALTER SYSTEM SET password_policy.min_password_len = 6;
+
+ALTER SYSTEM RESET password_policy.enable_dictionary_check;
+
+SELECT pg_reload_conf();
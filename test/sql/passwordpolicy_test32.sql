@@ -0,0 +1,7 @@
+ALTER SYSTEM SET password_policy.min_entropy_bits = 257;
+
+ALTER SYSTEM SET password_policy.enable_dictionary_check = off;
+
+ALTER SYSTEM SET password_policy.min_entropy_bits = 30;
+
+SELECT pg_reload_conf();
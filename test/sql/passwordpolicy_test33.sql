@@ -0,0 +1,15 @@
+DROP USER IF EXISTS test_entropy;
+
+CREATE USER test_entropy WITH PASSWORD 'aaaaaaaaaaaa';
+
+CREATE USER test_entropy WITH PASSWORD 'password123';
+
+CREATE USER test_entropy WITH PASSWORD 'Xq7#vLp9!zR2';
+
+DROP USER test_entropy;
+
+ALTER SYSTEM RESET password_policy.min_entropy_bits;
+
+ALTER SYSTEM RESET password_policy.enable_dictionary_check;
+
+SELECT pg_reload_conf();
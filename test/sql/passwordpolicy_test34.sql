@@ -0,0 +1,35 @@
+\c postgres
+
+DROP USER IF EXISTS test_profile;
+
+CREATE USER test_profile WITH PASSWORD 'Xq7#vLp9!zR2';
+
+INSERT INTO passwordpolicy.profiles (profile, min_password_len) VALUES ('test_strict', 20);
+
+INSERT INTO passwordpolicy.roles_profile (roleid, profile) VALUES ('test_profile', 'test_strict');
+
+DO $$ BEGIN FOR i IN 1..300 LOOP BEGIN EXECUTE format('ALTER USER test_profile WITH PASSWORD %L', 'Tm4$wKd8@hN' || i); EXCEPTION WHEN invalid_parameter_value THEN EXIT; END; PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+ALTER USER test_profile WITH PASSWORD 'Wd3%jNq5&kB7';
+
+ALTER USER test_profile WITH PASSWORD 'Wd3%jNq5&kB7Hy6^rPc2';
+
+SELECT roleid, profile FROM passwordpolicy.roles_profile;
+
+UPDATE passwordpolicy.profiles SET profile = 'test_stricter' WHERE profile = 'test_strict';
+
+SELECT roleid, profile FROM passwordpolicy.roles_profile;
+
+INSERT INTO passwordpolicy.profiles (profile, min_password_len) VALUES ('invalid', -1);
+
+ALTER USER test_profile RENAME TO test_profile_renamed;
+
+SELECT roleid, profile FROM passwordpolicy.roles_profile;
+
+DROP USER test_profile_renamed;
+
+DO $$ BEGIN FOR i IN 1..300 LOOP EXIT WHEN NOT EXISTS (SELECT 1 FROM passwordpolicy.roles_profile); PERFORM pg_sleep(0.1); END LOOP; END $$;
+
+SELECT count(*) FROM passwordpolicy.roles_profile;
+
+DELETE FROM passwordpolicy.profiles WHERE profile = 'test_stricter';
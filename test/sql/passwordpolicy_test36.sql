@@ -0,0 +1,21 @@
+DROP USER IF EXISTS test_cache;
+
+CREATE USER test_cache WITH PASSWORD 'Xq7#vLp9!zR2';
+
+ALTER USER test_cache WITH PASSWORD 'password123';
+
+ALTER USER test_cache WITH PASSWORD 'password123';
+
+ALTER USER test_cache WITH PASSWORD 'Xtest_cache9!';
+
+ALTER USER test_cache WITH PASSWORD 'Xtest_cache9!';
+
+ALTER USER test_cache WITH PASSWORD 'Tm4$wKd8@hN6';
+
+DROP USER test_cache;
+
+ALTER SYSTEM RESET password_policy.min_entropy_bits;
+
+ALTER SYSTEM RESET password_policy.enable_dictionary_check;
+
+SELECT pg_reload_conf();
@@ -0,0 +1,7 @@
+SELECT * FROM passwordpolicy.validate('abc', 'test_pass');
+
+SELECT * FROM passwordpolicy.validate('my_test_pass1', 'test_pass');
+
+SELECT * FROM passwordpolicy.validate('Xq7#vLp9!zR2', 'test_pass');
+
+SELECT * FROM passwordpolicy.validate(ARRAY['abc', 'my_test_pass1', NULL, 'Xq7#vLp9!zR2'], 'test_pass');
@@ -0,0 +1,43 @@
+DROP USER IF EXISTS test_rotate1;
+
+DROP USER IF EXISTS test_rotate2;
+
+CREATE USER test_rotate1 WITH PASSWORD 'Xq7#vLp9!zR2';
+
+CREATE USER test_rotate2;
+
+SELECT * FROM passwordpolicy.rotate_passwords(ARRAY['test_rotate1', 'test_rotate2', 'test_nobody', NULL, 'test_rotate2']::name[], ARRAY['Tm4$wKd8@hN6', 'abc', 'Wd3%jNq5&kB7', 'Hy6^rPc2*mF9', NULL]);
+
+SELECT rolname, rolpassword IS NOT NULL AS has_password FROM pg_authid WHERE rolname LIKE 'test_rotate%' ORDER BY rolname;
+
+SELECT * FROM passwordpolicy.rotate_passwords(ARRAY['test_rotate1']::name[], ARRAY['Xq7#vLp9!zR2']);
+
+ALTER USER test_rotate1 WITH PASSWORD 'Tm4$wKd8@hN6';
+
+SELECT * FROM passwordpolicy.rotate_passwords(ARRAY['test_rotate1']::name[], ARRAY['Wd3%jNq5&kB7', 'Hy6^rPc2*mF9']);
+
+GRANT USAGE ON SCHEMA passwordpolicy TO test_rotate2;
+
+SET ROLE test_rotate2;
+
+SELECT * FROM passwordpolicy.rotate_passwords(ARRAY['test_rotate2']::name[], ARRAY['Wd3%jNq5&kB7']);
+
+RESET ROLE;
+
+GRANT EXECUTE ON FUNCTION passwordpolicy.rotate_passwords(name[], text[]) TO test_rotate2;
+
+SET ROLE test_rotate2;
+
+SELECT * FROM passwordpolicy.rotate_passwords(ARRAY['test_rotate1', 'test_rotate2']::name[], ARRAY['Wd3%jNq5&kB7', 'Wd3%jNq5&kB7']);
+
+RESET ROLE;
+
+SELECT rolname, rolpassword IS NOT NULL AS has_password FROM pg_authid WHERE rolname LIKE 'test_rotate%' ORDER BY rolname;
+
+REVOKE EXECUTE ON FUNCTION passwordpolicy.rotate_passwords(name[], text[]) FROM test_rotate2;
+
+REVOKE USAGE ON SCHEMA passwordpolicy FROM test_rotate2;
+
+DROP USER IF EXISTS test_rotate1;
+
+DROP USER IF EXISTS test_rotate2;
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+#-------------------------------------------------------------------------
+#
+# generate_entropy_table.py
+#      Generate passwordpolicy_entropy_table.h, the keyboard adjacency graphs
+#      and the ranked words of the strength estimator
+#
+#   python3 tools/generate_entropy_table.py [ranked_list ...] > passwordpolicy_entropy_table.h
+#
+# A ranked list has a word per line, most frequent first. Without lists the
+# built-in list of common passwords and words is used. A word keeps its best
+# rank among all the lists.
+#
+# Copyright (c) 2024, Francisco Miguel Biete Banon
+#
+# This code is released under the PostgreSQL licence, as given at
+#  http://www.postgresql.org/about/licence/
+#-------------------------------------------------------------------------
+
+import sys
+
+MAX_WORD = 32
+MIN_WORD = 3
+
+# keys of each row, unshifted and shifted, with the offset of the row in half keys
+QWERTY = [
+    (0, '`1234567890-=', '~!@#$%^&*()_+'),
+    (3, 'qwertyuiop[]\\', 'QWERTYUIOP{}|'),
+    (4, "asdfghjkl;'", 'ASDFGHJKL:"'),
+    (5, 'zxcvbnm,./', 'ZXCVBNM<>?'),
+]
+
+# keypad rows, aligned keys, None is a gap
+KEYPAD = [
+    [None, '/', '*', '-'],
+    ['7', '8', '9', '+'],
+    ['4', '5', '6', None],
+    ['1', '2', '3', None],
+    [None, '0', '.', None],
+]
+
+# most common passwords and words, most frequent first
+BUILTIN = '''
+123456 password 12345678 qwerty 123456789 12345 1234 111111 1234567 dragon 123123 baseball
+abc123 football monkey letmein 696969 shadow master 666666 qwertyuiop 123321 mustang 1234567890
+michael 654321 superman 1qaz2wsx 7777777 121212 000000 qazwsx 123qwe killer trustno1 jordan
+jennifer zxcvbnm asdfgh hunter buster soccer harley batman andrew tigger sunshine iloveyou 2000
+charlie robert thomas hockey ranger daniel starwars klaster 112233 george computer michelle jessica
+pepper 1111 zxcvbn 555555 11111111 131313 freedom 777777 pass maggie 159753 aaaaaa ginger princess
+joshua cheese amanda summer love ashley nicole chelsea biteme matthew access yankees 987654321
+dallas austin thunder taylor matrix william corvette hello martin heather secret merlin diamond
+1234qwer gfhjkm hammer silver 222222 88888888 anthony justin test bailey q1w2e3r4t5 patrick
+internet scooter orange 11111 golfer cookie richard samantha bigdog guitar jackson whatever
+mickey chicken sparky snoopy maverick phoenix camaro peanut morgan welcome falcon cowboy ferrari
+samsung andrea smokey steelers joseph mercedes dakota arsenal eagles melissa boomer booboo spider
+nascar monster tigers yellow xxxxxx 123123123 gateway marina diablo bulldog qwer1234 compaq purple
+hardcore banana junior hannah 123654 porsche lakers iceman money cowboys 987654 london tennis
+999999 ncc1701 coffee scooby 0000 miller boston q1w2e3r4 brandon yamaha chester mother forever
+johnny edward 333333 oliver redsox player nikita knight fender barney midnight please brandy
+chicago badboy slayer rangers charles angel flower rabbit wizard bigdick jasper enter rachel
+chris steven winner adidas victoria natasha 1q2w3e4r jasmine winter prince panties marine
+ghbdtn fishing cocacola casper james 232323 raiders 888888 marlboro gandalf asdfasdf crystal
+87654321 12344321 golden 8675309 blowme dolphin admin administrator root login passw0rd
+changeme default guest user postgres oracle mysql database server system manager company
+spring autumn fall january february march april may june july august september october november
+december monday tuesday wednesday thursday friday saturday sunday letmein123 welcome1 password1
+abcdef abcd1234 qwerty123 iloveyou1 monkey1 dragon1 football1 baseball1 princess1 sunshine1
+hello123 test123 admin123 root123 pass123 secret123 master1 shadow1 superman1 batman1
+love you the and for are but not all any can had her was one our out day get has him his how man
+new now old see two way who boy did its let put say she too use dad mom family house home
+money business office work world life time year people water music school friend god jesus
+heart baby sweet happy lucky magic power dream star moon sun sky ocean river mountain tiger lion
+bear wolf eagle shark snake horse puppy kitty angel devil ninja pirate zombie hero king queen
+'''
+
+
+def keyboard_graph(rows):
+    """Neighbors of each key of a slanted keyboard, in the directions left, upper left,
+    upper right, right, lower right, lower left"""
+    position = {}
+    for y, (offset, unshifted, shifted) in enumerate(rows):
+        for x, key in enumerate(unshifted):
+            position[(offset + 2 * x, y)] = key
+    graph = {}
+    shift = {}
+    for y, (offset, unshifted, shifted) in enumerate(rows):
+        for x, key in enumerate(unshifted):
+            shift[shifted[x]] = key
+            px = offset + 2 * x
+            graph[key] = [position.get(p) for p in
+                          [(px - 2, y), (px - 1, y - 1), (px + 1, y - 1), (px + 2, y), (px + 1, y + 1), (px - 1, y + 1)]]
+    return graph, shift
+
+
+def keypad_graph(rows):
+    """Neighbors of each key of an aligned keypad, in the 8 directions"""
+    graph = {}
+    for y, row in enumerate(rows):
+        for x, key in enumerate(row):
+            if key is None:
+                continue
+            neighbors = []
+            for dx, dy in [(-1, 0), (-1, -1), (0, -1), (1, -1), (1, 0), (1, 1), (0, 1), (-1, 1)]:
+                nx, ny = x + dx, y + dy
+                if 0 <= ny < len(rows) and 0 <= nx < len(rows[ny]):
+                    neighbors.append(rows[ny][nx])
+                else:
+                    neighbors.append(None)
+            graph[key] = neighbors
+    return graph
+
+
+def c_char(c):
+    if c is None:
+        return '0'
+    if c in "\\'":
+        return "'\\%s'" % c
+    return "'%s'" % c
+
+
+def c_string(s):
+    return '"%s"' % s.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def ranked_words(paths):
+    ranks = {}
+    sources = [open(p, encoding='utf-8', errors='replace').read() for p in paths] if paths else [BUILTIN]
+    for source in sources:
+        rank = 0
+        for word in source.split():
+            word = word.strip().lower()
+            if not (MIN_WORD <= len(word) <= MAX_WORD) or not word.isascii():
+                continue
+            rank += 1
+            if word not in ranks or rank < ranks[word]:
+                ranks[word] = rank
+    return sorted(ranks.items())
+
+
+def write_graph(out, name, graph, directions):
+    out.write('static const char %s[128][%d] = {\n' % (name, directions))
+    for key in sorted(graph):
+        out.write("    [%s] = {%s},\n" % (c_char(key), ', '.join(c_char(n) for n in graph[key])))
+    out.write('};\n\n')
+
+
+def average_degree(graph):
+    return sum(len([n for n in neighbors if n is not None]) for neighbors in graph.values()) / len(graph)
+
+
+def main():
+    out = sys.stdout
+    qwerty, qwerty_shift = keyboard_graph(QWERTY)
+    keypad = keypad_graph(KEYPAD)
+    words = ranked_words(sys.argv[1:])
+
+    out.write('''/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_entropy_table.h
+ *      Keyboard adjacency graphs and ranked words of the strength estimator
+ *
+ * Generated by tools/generate_entropy_table.py, don't edit.
+ * Only included by passwordpolicy_entropy.c.
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_ENTROPY_TABLE_H_
+#define _PASSWORDPOLICY_ENTROPY_TABLE_H_
+
+#define PASSWORDPOLICY_ENTROPY_MAX_WORD %d
+#define PASSWORDPOLICY_ENTROPY_MIN_WORD %d
+
+#define PASSWORDPOLICY_ENTROPY_QWERTY_KEYS %d
+#define PASSWORDPOLICY_ENTROPY_QWERTY_DEGREE %.4f
+#define PASSWORDPOLICY_ENTROPY_KEYPAD_KEYS %d
+#define PASSWORDPOLICY_ENTROPY_KEYPAD_DEGREE %.4f
+
+typedef struct PasswordPolicyEntropyWord
+{
+  const char *word;
+  int rank;
+} PasswordPolicyEntropyWord;
+
+/* neighbors of the qwerty keys (unshifted): left, upper left, upper right, right, lower right, lower left */
+''' % (MAX_WORD, MIN_WORD, len(qwerty), average_degree(qwerty), len(keypad), average_degree(keypad)))
+    write_graph(out, 'passwordpolicy_entropy_qwerty', qwerty, 6)
+
+    out.write('/* unshifted key of the shifted characters */\n')
+    out.write('static const char passwordpolicy_entropy_qwerty_shift[128] = {\n')
+    for shifted in sorted(qwerty_shift):
+        out.write('    [%s] = %s,\n' % (c_char(shifted), c_char(qwerty_shift[shifted])))
+    out.write('};\n\n')
+
+    out.write('/* neighbors of the keypad keys, clockwise from the left */\n')
+    write_graph(out, 'passwordpolicy_entropy_keypad', keypad, 8)
+
+    out.write('/* common words, ordered for a binary search, rank 1 is the most common */\n')
+    out.write('static const PasswordPolicyEntropyWord passwordpolicy_entropy_words[%d] = {\n' % len(words))
+    for word, rank in words:
+        out.write('    {%s, %d},\n' % (c_string(word), rank))
+    out.write('''};
+
+#endif
+''')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#-------------------------------------------------------------------------
+#
+# generate_unicode_table.py
+#      Generate passwordpolicy_unicode_table.h from the Unicode character
+#      database of Python
+#
+#   python3 tools/generate_unicode_table.py > passwordpolicy_unicode_table.h
+#
+# Copyright (c) 2024, Francisco Miguel Biete Banon
+#
+# This code is released under the PostgreSQL licence, as given at
+#  http://www.postgresql.org/about/licence/
+#-------------------------------------------------------------------------
+
+import sys
+import unicodedata
+
+# general category -> class of the password checks, the other categories are special characters
+CLASSES = {
+    'Lu': 'PASSWORDPOLICY_CHAR_UPPER',
+    'Lt': 'PASSWORDPOLICY_CHAR_UPPER',
+    'Ll': 'PASSWORDPOLICY_CHAR_LOWER',
+    'Lm': 'PASSWORDPOLICY_CHAR_LETTER',
+    'Lo': 'PASSWORDPOLICY_CHAR_LETTER',
+    'Nd': 'PASSWORDPOLICY_CHAR_DIGIT',
+    'Mn': 'PASSWORDPOLICY_CHAR_MARK',
+    'Mc': 'PASSWORDPOLICY_CHAR_MARK',
+    'Me': 'PASSWORDPOLICY_CHAR_MARK',
+}
+SPECIAL = 'PASSWORDPOLICY_CHAR_SPECIAL'
+
+
+def char_class(cp):
+    return CLASSES.get(unicodedata.category(chr(cp)), SPECIAL)
+
+
+def ranges(first, last):
+    """Ranges of consecutive code points of the same class, special characters excluded"""
+    result = []
+    start, current = first, char_class(first)
+    for cp in range(first + 1, last + 2):
+        cls = char_class(cp) if cp <= last else None
+        if cls != current:
+            if current != SPECIAL:
+                result.append((start, cp - 1, current))
+            start, current = cp, cls
+    return result
+
+
+def main():
+    out = sys.stdout
+    table = ranges(0x80, 0x10FFFF)
+
+    out.write('''/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_unicode_table.h
+ *      Classes of the Unicode characters for the password checks
+ *
+ * Generated by tools/generate_unicode_table.py from Unicode %s, don't edit.
+ * Only included by passwordpolicy_unicode.c.
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+#ifndef _PASSWORDPOLICY_UNICODE_TABLE_H_
+#define _PASSWORDPOLICY_UNICODE_TABLE_H_
+
+#include "passwordpolicy_unicode.h"
+
+/* class of the ASCII characters, declared in passwordpolicy_unicode.h */
+const uint8 passwordpolicy_unicode_ascii[128] = {
+''' % unicodedata.unidata_version)
+    for row in range(0, 128, 4):
+        out.write('    ' + ' '.join('%s,' % char_class(cp) for cp in range(row, row + 4)) + '\n')
+    out.write('''};
+
+/* classes of the other characters, ordered, the characters not listed are special characters */
+static const PasswordPolicyUnicodeRange passwordpolicy_unicode_ranges[%d] = {
+''' % len(table))
+    for first, last, cls in table:
+        out.write('    {0x%04X, 0x%04X, %s},\n' % (first, last, cls))
+    out.write('''};
+
+#endif
+''')
+
+
+if __name__ == '__main__':
+    main()
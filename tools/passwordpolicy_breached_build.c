@@ -0,0 +1,416 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_breached_build.c
+ *      Offline builder of the breached passwords index
+ *
+ * Reads SHA-1 digests in hexadecimal, one per line, optionally followed by
+ * ":count" as in the Have I Been Pwned dumps, and writes the file used by
+ * password_policy.breached_file.
+ *
+ *   passwordpolicy_breached_build [-f sorted|fuse] input output
+ *
+ * The sorted format keeps every digest (20 bytes per entry) and only matches
+ * exact digests, the fuse format is a binary fuse filter (about 9 bits per
+ * entry) with 0.4% of false positives.
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "passwordpolicy_breached_format.h"
+
+#define BREACHED_BUILD_MAX_ITERATIONS 100
+
+typedef struct BreachedDigest
+{
+  uint8_t bytes[PASSWORDPOLICY_BREACHED_DIGEST_LENGTH];
+} BreachedDigest;
+
+static const char *progname = "passwordpolicy_breached_build";
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: %s [-f sorted|fuse] input output\n", progname);
+  exit(2);
+}
+
+static void *xmalloc(size_t size)
+{
+  void *ptr = calloc(1, size > 0 ? size : 1);
+
+  if (ptr == NULL)
+  {
+    fprintf(stderr, "%s: out of memory allocating %zu bytes\n", progname, size);
+    exit(1);
+  }
+  return ptr;
+}
+
+static int hex_value(int c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  c = tolower(c);
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+static int digest_cmp(const void *a, const void *b)
+{
+  return memcmp(a, b, PASSWORDPOLICY_BREACHED_DIGEST_LENGTH);
+}
+
+static int key_cmp(const void *a, const void *b)
+{
+  uint64_t ka = *(const uint64_t *)a, kb = *(const uint64_t *)b;
+
+  return (ka > kb) - (ka < kb);
+}
+
+/*
+ * @brief Read the digests of the input file, invalid lines are skipped
+ **/
+static BreachedDigest *read_digests(const char *path, uint64_t *count)
+{
+  char line[256];
+  int i, hi, lo;
+  uint64_t capacity = 1 << 20, num = 0, skipped = 0;
+  BreachedDigest *digests;
+  FILE *file;
+
+  file = (strcmp(path, "-") == 0) ? stdin : fopen(path, "r");
+  if (file == NULL)
+  {
+    fprintf(stderr, "%s: could not open \"%s\": %s\n", progname, path, strerror(errno));
+    exit(1);
+  }
+
+  digests = xmalloc(capacity * sizeof(BreachedDigest));
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    if (num == capacity)
+    {
+      capacity *= 2;
+      digests = realloc(digests, capacity * sizeof(BreachedDigest));
+      if (digests == NULL)
+      {
+        fprintf(stderr, "%s: out of memory reading \"%s\"\n", progname, path);
+        exit(1);
+      }
+    }
+    for (i = 0; i < PASSWORDPOLICY_BREACHED_DIGEST_LENGTH; i++)
+    {
+      hi = hex_value((unsigned char)line[2 * i]);
+      lo = hex_value((unsigned char)line[2 * i + 1]);
+      if (hi < 0 || lo < 0)
+        break;
+      digests[num].bytes[i] = (uint8_t)(hi << 4 | lo);
+    }
+    if (i < PASSWORDPOLICY_BREACHED_DIGEST_LENGTH || isxdigit((unsigned char)line[2 * i]))
+    {
+      skipped++;
+      continue;
+    }
+    num++;
+  }
+  if (ferror(file))
+  {
+    fprintf(stderr, "%s: could not read \"%s\": %s\n", progname, path, strerror(errno));
+    exit(1);
+  }
+  if (file != stdin)
+    fclose(file);
+
+  if (skipped > 0)
+    fprintf(stderr, "%s: %llu invalid lines skipped\n", progname, (unsigned long long)skipped);
+  *count = num;
+  return digests;
+}
+
+static uint64_t splitmix64(uint64_t *seed)
+{
+  uint64_t z = (*seed += UINT64_C(0x9E3779B97F4A7C15));
+
+  z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return z ^ (z >> 31);
+}
+
+static uint8_t mod3(uint8_t x)
+{
+  return x > 2 ? x - 3 : x;
+}
+
+/*
+ * @brief Size the binary fuse filter of size keys, with 3 positions per key
+ **/
+static void fuse_allocate(uint32_t size, PasswordPolicyBreachedHeader *header)
+{
+  uint32_t capacity, init_segment_count;
+  double size_factor;
+
+  header->segment_length = size == 0 ? 4 : (uint32_t)1 << (int)floor(log((double)size) / log(3.33) + 2.25);
+  if (header->segment_length > 262144)
+    header->segment_length = 262144;
+  header->segment_length_mask = header->segment_length - 1;
+  size_factor = size <= 1 ? 0 : fmax(1.125, 0.875 + 0.25 * log(1000000.0) / log((double)size));
+  capacity = size <= 1 ? 0 : (uint32_t)round((double)size * size_factor);
+  init_segment_count = (capacity + header->segment_length - 1) / header->segment_length;
+  header->array_length = (init_segment_count + 2) * header->segment_length;
+  header->segment_count = (header->array_length + header->segment_length - 1) / header->segment_length;
+  header->segment_count = header->segment_count <= 2 ? 1 : header->segment_count - 2;
+  header->array_length = (header->segment_count + 2) * header->segment_length;
+  header->segment_count_length = header->segment_count * header->segment_length;
+}
+
+/*
+ * @brief Build the binary fuse filter of the keys, sorted and without duplicates
+ * Peeling algorithm of Graf and Lemire, "Binary Fuse Filters: Fast and Smaller Than Xor Filters"
+ **/
+static uint8_t *fuse_populate(const uint64_t *keys, uint32_t size, PasswordPolicyBreachedHeader *header)
+{
+  uint32_t capacity = header->array_length;
+  uint32_t i, block_bits, block, queue_size, stack_size, index, other, h[5];
+  uint64_t rng = UINT64_C(0x726b2b9d438b9d4d), hash, segment;
+  uint64_t *reverse_order = xmalloc(((uint64_t)size + 1) * sizeof(uint64_t));
+  uint64_t *t2hash = xmalloc((uint64_t)capacity * sizeof(uint64_t));
+  uint32_t *alone = xmalloc((uint64_t)capacity * sizeof(uint32_t));
+  uint8_t *t2count = xmalloc(capacity);
+  uint8_t *reverse_h = xmalloc(size);
+  uint8_t *fingerprints = xmalloc(capacity);
+  uint32_t *start_pos;
+  uint8_t found;
+  int loop, error;
+
+  block_bits = 1;
+  while (((uint32_t)1 << block_bits) < header->segment_count)
+    block_bits++;
+  block = (uint32_t)1 << block_bits;
+  start_pos = xmalloc(block * sizeof(uint32_t));
+
+  header->seed = splitmix64(&rng);
+  reverse_order[size] = 1;
+  for (loop = 0;; loop++)
+  {
+    if (loop + 1 > BREACHED_BUILD_MAX_ITERATIONS)
+    {
+      fprintf(stderr, "%s: could not build the filter\n", progname);
+      exit(1);
+    }
+
+    /* bucket the hashes by segment, the construction then walks memory in order */
+    for (i = 0; i < block; i++)
+      start_pos[i] = (uint32_t)(((uint64_t)i * size) >> block_bits);
+    for (i = 0; i < size; i++)
+    {
+      hash = passwordpolicy_breached_murmur64(keys[i] + header->seed);
+      segment = hash >> (64 - block_bits);
+      while (reverse_order[start_pos[segment]] != 0)
+        segment = (segment + 1) & (block - 1);
+      reverse_order[start_pos[segment]] = hash;
+      start_pos[segment]++;
+    }
+
+    error = 0;
+    for (i = 0; i < size; i++)
+    {
+      hash = reverse_order[i];
+      h[0] = passwordpolicy_breached_fuse_position(0, hash, header);
+      h[1] = passwordpolicy_breached_fuse_position(1, hash, header);
+      h[2] = passwordpolicy_breached_fuse_position(2, hash, header);
+      t2count[h[0]] += 4;
+      t2hash[h[0]] ^= hash;
+      t2count[h[1]] += 4;
+      t2count[h[1]] ^= 1;
+      t2hash[h[1]] ^= hash;
+      t2count[h[2]] += 4;
+      t2count[h[2]] ^= 2;
+      t2hash[h[2]] ^= hash;
+      /* more than 63 keys in a position */
+      if (t2count[h[0]] < 4 || t2count[h[1]] < 4 || t2count[h[2]] < 4)
+        error = 1;
+    }
+
+    if (!error)
+    {
+      /* peel the positions with a single key */
+      queue_size = 0;
+      for (i = 0; i < capacity; i++)
+      {
+        alone[queue_size] = i;
+        queue_size += ((t2count[i] >> 2) == 1) ? 1 : 0;
+      }
+      stack_size = 0;
+      while (queue_size > 0)
+      {
+        index = alone[--queue_size];
+        if ((t2count[index] >> 2) != 1)
+          continue;
+        hash = t2hash[index];
+        h[0] = passwordpolicy_breached_fuse_position(0, hash, header);
+        h[1] = passwordpolicy_breached_fuse_position(1, hash, header);
+        h[2] = passwordpolicy_breached_fuse_position(2, hash, header);
+        h[3] = h[0];
+        h[4] = h[1];
+        found = t2count[index] & 3;
+        reverse_h[stack_size] = found;
+        reverse_order[stack_size] = hash;
+        stack_size++;
+
+        other = h[found + 1];
+        alone[queue_size] = other;
+        queue_size += ((t2count[other] >> 2) == 2) ? 1 : 0;
+        t2count[other] -= 4;
+        t2count[other] ^= mod3(found + 1);
+        t2hash[other] ^= hash;
+
+        other = h[found + 2];
+        alone[queue_size] = other;
+        queue_size += ((t2count[other] >> 2) == 2) ? 1 : 0;
+        t2count[other] -= 4;
+        t2count[other] ^= mod3(found + 2);
+        t2hash[other] ^= hash;
+      }
+      if (stack_size == size)
+        break;
+    }
+
+    /* try again with another seed */
+    memset(reverse_order, 0, (uint64_t)size * sizeof(uint64_t));
+    memset(t2count, 0, capacity);
+    memset(t2hash, 0, (uint64_t)capacity * sizeof(uint64_t));
+    header->seed = splitmix64(&rng);
+  }
+
+  /* assign the fingerprints in the reverse order of the peeling */
+  for (i = size; i-- > 0;)
+  {
+    hash = reverse_order[i];
+    found = reverse_h[i];
+    h[0] = passwordpolicy_breached_fuse_position(0, hash, header);
+    h[1] = passwordpolicy_breached_fuse_position(1, hash, header);
+    h[2] = passwordpolicy_breached_fuse_position(2, hash, header);
+    h[3] = h[0];
+    h[4] = h[1];
+    fingerprints[h[found]] = passwordpolicy_breached_fingerprint(hash) ^ fingerprints[h[found + 1]] ^
+                             fingerprints[h[found + 2]];
+  }
+
+  free(reverse_order);
+  free(t2hash);
+  free(alone);
+  free(t2count);
+  free(reverse_h);
+  free(start_pos);
+  return fingerprints;
+}
+
+static void write_all(FILE *file, const char *path, const void *data, size_t size)
+{
+  if (size > 0 && fwrite(data, size, 1, file) != 1)
+  {
+    fprintf(stderr, "%s: could not write \"%s\": %s\n", progname, path, strerror(errno));
+    exit(1);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int argi = 1;
+  uint32_t format = PASSWORDPOLICY_BREACHED_SORTED;
+  uint64_t i, num, count, *keys;
+  uint8_t *fingerprints;
+  BreachedDigest *digests;
+  PasswordPolicyBreachedHeader header;
+  FILE *file;
+
+  if (argc > 2 && strcmp(argv[1], "-f") == 0)
+  {
+    if (strcmp(argv[2], "sorted") == 0)
+      format = PASSWORDPOLICY_BREACHED_SORTED;
+    else if (strcmp(argv[2], "fuse") == 0)
+      format = PASSWORDPOLICY_BREACHED_FUSE;
+    else
+      usage();
+    argi = 3;
+  }
+  if (argc - argi != 2)
+    usage();
+
+  digests = read_digests(argv[argi], &num);
+
+  memset(&header, 0, sizeof(header));
+  header.magic = PASSWORDPOLICY_BREACHED_MAGIC;
+  header.version = PASSWORDPOLICY_BREACHED_VERSION;
+  header.format = format;
+
+  file = fopen(argv[argi + 1], "wb");
+  if (file == NULL)
+  {
+    fprintf(stderr, "%s: could not create \"%s\": %s\n", progname, argv[argi + 1], strerror(errno));
+    exit(1);
+  }
+
+  if (format == PASSWORDPOLICY_BREACHED_SORTED)
+  {
+    qsort(digests, num, sizeof(BreachedDigest), digest_cmp);
+    for (i = 0, count = 0; i < num; i++)
+    {
+      if (count == 0 || memcmp(&digests[count - 1], &digests[i], sizeof(BreachedDigest)) != 0)
+        digests[count++] = digests[i];
+    }
+    header.count = count;
+    write_all(file, argv[argi + 1], &header, sizeof(header));
+    write_all(file, argv[argi + 1], digests, count * sizeof(BreachedDigest));
+  }
+  else
+  {
+    keys = xmalloc(num * sizeof(uint64_t));
+    for (i = 0; i < num; i++)
+      keys[i] = passwordpolicy_breached_key(digests[i].bytes);
+    free(digests);
+    digests = NULL;
+
+    /* the peeling fails with duplicated keys */
+    qsort(keys, num, sizeof(uint64_t), key_cmp);
+    for (i = 0, count = 0; i < num; i++)
+    {
+      if (count == 0 || keys[count - 1] != keys[i])
+        keys[count++] = keys[i];
+    }
+    if (count > UINT32_MAX)
+    {
+      fprintf(stderr, "%s: too many digests for a filter\n", progname);
+      exit(1);
+    }
+
+    header.count = count;
+    fuse_allocate((uint32_t)count, &header);
+    fingerprints = fuse_populate(keys, (uint32_t)count, &header);
+    write_all(file, argv[argi + 1], &header, sizeof(header));
+    write_all(file, argv[argi + 1], fingerprints, header.array_length);
+    free(fingerprints);
+    free(keys);
+  }
+
+  if (fclose(file) != 0)
+  {
+    fprintf(stderr, "%s: could not write \"%s\": %s\n", progname, argv[argi + 1], strerror(errno));
+    exit(1);
+  }
+  free(digests);
+
+  fprintf(stderr, "%s: %llu digests written to \"%s\"\n", progname, (unsigned long long)header.count, argv[argi + 1]);
+  return 0;
+}
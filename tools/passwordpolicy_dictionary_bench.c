@@ -0,0 +1,191 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_dictionary_bench.c
+ *      Lookup latency of the native dictionary and of cracklib
+ *
+ * Looks up every line of the passwords file in the native dictionary and,
+ * when built with cracklib and given its dictionary, with FascistCheck()
+ * (opens the dictionary on every call) and FascistLook() (dictionary kept
+ * open, as password_policy.dictionary_engine = cracklib does).
+ *
+ *   passwordpolicy_dictionary_bench native_file [cracklib_path] passwords
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef USE_CRACKLIB
+#include <crack.h>
+#include <packer.h>
+#endif
+
+#include "passwordpolicy_dictionary_format.h"
+
+#define DICTIONARY_BENCH_MAX_LINE 1024
+#define DICTIONARY_BENCH_ROUNDS 5
+
+static const char *progname = "passwordpolicy_dictionary_bench";
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: %s native_file [cracklib_path] passwords\n", progname);
+  exit(2);
+}
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * @brief Read the passwords, one per line
+ **/
+static char **read_passwords(const char *path, size_t *num)
+{
+  char line[DICTIONARY_BENCH_MAX_LINE];
+  size_t len, capacity = 1024;
+  char **passwords = malloc(capacity * sizeof(char *));
+  FILE *file = fopen(path, "r");
+
+  if (file == NULL)
+  {
+    fprintf(stderr, "%s: could not open \"%s\": %s\n", progname, path, strerror(errno));
+    exit(1);
+  }
+  *num = 0;
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    len = strcspn(line, "\r\n");
+    line[len] = '\0';
+    if (*num == capacity)
+    {
+      capacity *= 2;
+      passwords = realloc(passwords, capacity * sizeof(char *));
+    }
+    if (passwords == NULL || (passwords[*num] = strdup(line)) == NULL)
+    {
+      fprintf(stderr, "%s: out of memory reading \"%s\"\n", progname, path);
+      exit(1);
+    }
+    (*num)++;
+  }
+  fclose(file);
+  return passwords;
+}
+
+static void report(const char *engine, size_t found, size_t num, double elapsed)
+{
+  printf("%-12s %10zu lookups %10zu found %10.0f ns/lookup\n", engine, num, found,
+         num > 0 ? elapsed * 1e9 / num : 0.0);
+}
+
+static void bench_native(const char *path, char **passwords, size_t num)
+{
+  int fd, round;
+  size_t i, len, found = 0;
+  struct stat st;
+  void *addr;
+  const PasswordPolicyDictionaryHeader *header;
+  const uint32_t *pilots;
+  char word[DICTIONARY_BENCH_MAX_LINE];
+  double start;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0 || fstat(fd, &st) < 0)
+  {
+    fprintf(stderr, "%s: could not open \"%s\": %s\n", progname, path, strerror(errno));
+    exit(1);
+  }
+  addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  header = addr;
+  if (addr == MAP_FAILED || (size_t)st.st_size < sizeof(*header) || header->magic != PASSWORDPOLICY_DICTIONARY_MAGIC)
+  {
+    fprintf(stderr, "%s: invalid dictionary \"%s\"\n", progname, path);
+    exit(1);
+  }
+  pilots = (const uint32_t *)(header + 1);
+
+  start = now();
+  for (round = 0; round < DICTIONARY_BENCH_ROUNDS; round++)
+  {
+    for (i = 0; i < num; i++)
+    {
+      len = passwordpolicy_dictionary_normalize(passwords[i], strlen(passwords[i]), word);
+      found += passwordpolicy_dictionary_contains(word, len, header, pilots, pilots + header->bucket_count);
+    }
+  }
+  report("native", found / DICTIONARY_BENCH_ROUNDS, num, (now() - start) / DICTIONARY_BENCH_ROUNDS);
+  munmap(addr, st.st_size);
+}
+
+#ifdef USE_CRACKLIB
+static void bench_cracklib(const char *path, char **passwords, size_t num)
+{
+  size_t i, found = 0;
+  char word[DICTIONARY_BENCH_MAX_LINE];
+  PWDICT *pwp;
+  double start;
+
+  start = now();
+  for (i = 0; i < num; i++)
+    found += FascistCheck(passwords[i], path) != NULL;
+  report("FascistCheck", found, num, now() - start);
+
+  pwp = PWOpen(path, "r");
+  if (pwp == NULL)
+  {
+    fprintf(stderr, "%s: could not open \"%s\"\n", progname, path);
+    exit(1);
+  }
+  found = 0;
+  start = now();
+  for (i = 0; i < num; i++)
+  {
+    strcpy(word, passwords[i]);
+    found += FascistLook(pwp, word) != NULL;
+  }
+  report("FascistLook", found, num, now() - start);
+  PWClose(pwp);
+}
+#endif
+
+int main(int argc, char **argv)
+{
+  size_t num;
+  char **passwords;
+
+  if (argc != 3 && argc != 4)
+    usage();
+#ifndef USE_CRACKLIB
+  if (argc == 4)
+  {
+    fprintf(stderr, "%s: built without cracklib\n", progname);
+    exit(2);
+  }
+#endif
+
+  passwords = read_passwords(argv[argc - 1], &num);
+  bench_native(argv[1], passwords, num);
+#ifdef USE_CRACKLIB
+  if (argc == 4)
+    bench_cracklib(argv[2], passwords, num);
+#endif
+  return 0;
+}
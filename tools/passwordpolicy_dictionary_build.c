@@ -0,0 +1,321 @@
+/*-------------------------------------------------------------------------
+ *
+ * passwordpolicy_dictionary_build.c
+ *      Offline builder of the native dictionary
+ *
+ * Reads words, one per line, and writes the file used by
+ * password_policy.dictionary_path with password_policy.dictionary_engine set
+ * to native.
+ *
+ *   passwordpolicy_dictionary_build input [input ...] output
+ *
+ * The words are normalized like the passwords being checked and indexed by a
+ * minimal perfect hash function, about 5 bytes per word.
+ *
+ * Copyright (c) 2024, Francisco Miguel Biete Banon
+ *
+ * This code is released under the PostgreSQL licence, as given at
+ *  http://www.postgresql.org/about/licence/
+ *-------------------------------------------------------------------------
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "passwordpolicy_dictionary_format.h"
+
+#define DICTIONARY_BUILD_MAX_ITERATIONS 100
+#define DICTIONARY_BUILD_MAX_LINE 1024
+/* average words per bucket, more words per bucket make a smaller file and a slower build */
+#define DICTIONARY_BUILD_BUCKET_SIZE 4
+
+static const char *progname = "passwordpolicy_dictionary_build";
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: %s input [input ...] output\n", progname);
+  exit(2);
+}
+
+static void *xmalloc(size_t size)
+{
+  void *ptr = calloc(1, size > 0 ? size : 1);
+
+  if (ptr == NULL)
+  {
+    fprintf(stderr, "%s: out of memory allocating %zu bytes\n", progname, size);
+    exit(1);
+  }
+  return ptr;
+}
+
+static int hash_cmp(const void *a, const void *b)
+{
+  uint64_t ha = *(const uint64_t *)a, hb = *(const uint64_t *)b;
+
+  return (ha > hb) - (ha < hb);
+}
+
+static uint64_t splitmix64(uint64_t *seed)
+{
+  uint64_t z = (*seed += UINT64_C(0x9E3779B97F4A7C15));
+
+  z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return z ^ (z >> 31);
+}
+
+/*
+ * @brief Read and normalize the words of the input file, short words are skipped
+ **/
+static void read_words(const char *path, char ***words, size_t **lengths,
+                       uint64_t *num, uint64_t *capacity)
+{
+  char line[DICTIONARY_BUILD_MAX_LINE], normalized[DICTIONARY_BUILD_MAX_LINE];
+  size_t len;
+  int c;
+  uint64_t skipped = 0;
+  FILE *file;
+
+  file = (strcmp(path, "-") == 0) ? stdin : fopen(path, "r");
+  if (file == NULL)
+  {
+    fprintf(stderr, "%s: could not open \"%s\": %s\n", progname, path, strerror(errno));
+    exit(1);
+  }
+
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    len = strlen(line);
+    if (len > 0 && line[len - 1] != '\n' && !feof(file))
+    {
+      /* too long to be a password */
+      while ((c = fgetc(file)) != EOF && c != '\n')
+        ;
+      skipped++;
+      continue;
+    }
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+      len--;
+
+    len = passwordpolicy_dictionary_normalize(line, len, normalized);
+    if (len < PASSWORDPOLICY_DICTIONARY_MIN_WORD)
+    {
+      skipped++;
+      continue;
+    }
+
+    if (*num == *capacity)
+    {
+      *capacity *= 2;
+      *words = realloc(*words, *capacity * sizeof(char *));
+      *lengths = realloc(*lengths, *capacity * sizeof(size_t));
+      if (*words == NULL || *lengths == NULL)
+      {
+        fprintf(stderr, "%s: out of memory reading \"%s\"\n", progname, path);
+        exit(1);
+      }
+    }
+    (*words)[*num] = xmalloc(len);
+    memcpy((*words)[*num], normalized, len);
+    (*lengths)[*num] = len;
+    (*num)++;
+  }
+  if (ferror(file))
+  {
+    fprintf(stderr, "%s: could not read \"%s\": %s\n", progname, path, strerror(errno));
+    exit(1);
+  }
+  if (file != stdin)
+    fclose(file);
+
+  if (skipped > 0)
+    fprintf(stderr, "%s: %llu short or invalid lines of \"%s\" skipped\n", progname, (unsigned long long)skipped, path);
+}
+
+/*
+ * @brief Find the pilot of every bucket, largest buckets first
+ * @return false if a bucket has no pilot, the build must be tried with another seed
+ **/
+static bool find_pilots(const uint64_t *hashes, const PasswordPolicyDictionaryHeader *header, uint32_t *pilots)
+{
+  uint32_t count = header->count, bucket_count = header->bucket_count;
+  uint32_t *start = xmalloc(((uint64_t)bucket_count + 1) * sizeof(uint32_t));
+  uint32_t *order = xmalloc((uint64_t)bucket_count * sizeof(uint32_t));
+  uint32_t *slots = NULL;
+  uint8_t *taken = xmalloc((uint64_t)count / 8 + 1);
+  uint32_t i, j, k, b, size, max_size = 0, pilot, slot, *size_start;
+  bool ok = true;
+
+  /* the hashes are sorted, so are their buckets */
+  for (i = 0, b = 0; i < count; i++)
+  {
+    while (b <= passwordpolicy_dictionary_bucket(hashes[i], header))
+      start[b++] = i;
+  }
+  while (b <= bucket_count)
+    start[b++] = count;
+  for (b = 0; b < bucket_count; b++)
+  {
+    if (start[b + 1] - start[b] > max_size)
+      max_size = start[b + 1] - start[b];
+  }
+
+  /* counting sort of the buckets by decreasing size */
+  size_start = xmalloc(((uint64_t)max_size + 2) * sizeof(uint32_t));
+  for (b = 0; b < bucket_count; b++)
+    size_start[max_size - (start[b + 1] - start[b]) + 1]++;
+  for (i = 1; i <= max_size + 1; i++)
+    size_start[i] += size_start[i - 1];
+  for (b = 0; b < bucket_count; b++)
+    order[size_start[max_size - (start[b + 1] - start[b])]++] = b;
+  slots = xmalloc(((uint64_t)max_size + 1) * sizeof(uint32_t));
+
+  for (i = 0; i < bucket_count && ok; i++)
+  {
+    b = order[i];
+    size = start[b + 1] - start[b];
+    if (size == 0)
+      break;
+    for (pilot = 0;; pilot++)
+    {
+      for (j = 0; j < size; j++)
+      {
+        slot = passwordpolicy_dictionary_slot(hashes[start[b] + j], pilot, header);
+        if (taken[slot >> 3] & (1 << (slot & 7)))
+          break;
+        for (k = 0; k < j; k++)
+        {
+          if (slots[k] == slot)
+            break;
+        }
+        if (k < j)
+          break;
+        slots[j] = slot;
+      }
+      if (j == size)
+        break;
+      if (pilot == UINT32_MAX)
+      {
+        ok = false;
+        break;
+      }
+    }
+    if (!ok)
+      break;
+    pilots[b] = pilot;
+    for (j = 0; j < size; j++)
+      taken[slots[j] >> 3] |= (uint8_t)(1 << (slots[j] & 7));
+  }
+
+  free(start);
+  free(order);
+  free(slots);
+  free(taken);
+  free(size_start);
+  return ok;
+}
+
+static void write_all(FILE *file, const char *path, const void *data, size_t size)
+{
+  if (size > 0 && fwrite(data, size, 1, file) != 1)
+  {
+    fprintf(stderr, "%s: could not write \"%s\": %s\n", progname, path, strerror(errno));
+    exit(1);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int argi, loop;
+  uint64_t i, num = 0, capacity = 1 << 16, count, rng = UINT64_C(0x2545f4914f6cdd1d);
+  uint64_t *hashes;
+  uint32_t *pilots = NULL, *fingerprints;
+  char **words;
+  size_t *lengths;
+  const char *output;
+  PasswordPolicyDictionaryHeader header;
+  FILE *file;
+
+  if (argc < 3)
+    usage();
+  output = argv[argc - 1];
+
+  words = xmalloc(capacity * sizeof(char *));
+  lengths = xmalloc(capacity * sizeof(size_t));
+  for (argi = 1; argi < argc - 1; argi++)
+    read_words(argv[argi], &words, &lengths, &num, &capacity);
+  if (num > UINT32_MAX)
+  {
+    fprintf(stderr, "%s: too many words for a dictionary\n", progname);
+    exit(1);
+  }
+
+  memset(&header, 0, sizeof(header));
+  header.magic = PASSWORDPOLICY_DICTIONARY_MAGIC;
+  header.version = PASSWORDPOLICY_DICTIONARY_VERSION;
+
+  hashes = xmalloc(num * sizeof(uint64_t));
+  for (loop = 0;; loop++)
+  {
+    if (loop + 1 > DICTIONARY_BUILD_MAX_ITERATIONS)
+    {
+      fprintf(stderr, "%s: could not build the dictionary\n", progname);
+      exit(1);
+    }
+
+    header.seed = splitmix64(&rng);
+    for (i = 0; i < num; i++)
+      hashes[i] = passwordpolicy_dictionary_hash(words[i], lengths[i], header.seed);
+
+    /* the same word in several lists, or a word and its variants */
+    qsort(hashes, num, sizeof(uint64_t), hash_cmp);
+    for (i = 0, count = 0; i < num; i++)
+    {
+      if (count == 0 || hashes[count - 1] != hashes[i])
+        hashes[count++] = hashes[i];
+    }
+
+    header.count = (uint32_t)count;
+    header.bucket_count = (uint32_t)((count + DICTIONARY_BUILD_BUCKET_SIZE - 1) / DICTIONARY_BUILD_BUCKET_SIZE);
+    if (header.bucket_count == 0)
+      header.bucket_count = 1;
+    free(pilots);
+    pilots = xmalloc((uint64_t)header.bucket_count * sizeof(uint32_t));
+    if (find_pilots(hashes, &header, pilots))
+      break;
+  }
+
+  fingerprints = xmalloc(count * sizeof(uint32_t));
+  for (i = 0; i < count; i++)
+    fingerprints[passwordpolicy_dictionary_slot(hashes[i], pilots[passwordpolicy_dictionary_bucket(hashes[i], &header)], &header)] =
+        (uint32_t)hashes[i];
+
+  file = fopen(output, "wb");
+  if (file == NULL)
+  {
+    fprintf(stderr, "%s: could not create \"%s\": %s\n", progname, output, strerror(errno));
+    exit(1);
+  }
+  write_all(file, output, &header, sizeof(header));
+  write_all(file, output, pilots, (size_t)header.bucket_count * sizeof(uint32_t));
+  write_all(file, output, fingerprints, count * sizeof(uint32_t));
+  if (fclose(file) != 0)
+  {
+    fprintf(stderr, "%s: could not write \"%s\": %s\n", progname, output, strerror(errno));
+    exit(1);
+  }
+
+  for (i = 0; i < num; i++)
+    free(words[i]);
+  free(words);
+  free(lengths);
+  free(hashes);
+  free(pilots);
+  free(fingerprints);
+
+  fprintf(stderr, "%s: %llu words written to \"%s\"\n", progname, (unsigned long long)count, output);
+  return 0;
+}